@@ -0,0 +1,49 @@
+# Image processing: raylib implementation vs SIMD kernels on the worker pool
+#
+#   mix run bench/image_process.exs
+
+use Zexray.Enum
+
+alias Zexray.Image
+
+inputs = %{
+  "1024x1024" => Image.gen_white_noise(1024, 1024, 0.5, :value),
+  "2048x2048" => Image.gen_white_noise(2048, 2048, 0.5, :value)
+}
+
+operations = [
+  {"format rgba8 -> r5g6b5",
+   fn image -> Image.format(image, enum_pixel_format(:uncompressed_r5g6b5), :resource) end},
+  {"format rgba8 -> r8g8b8",
+   fn image -> Image.format(image, enum_pixel_format(:uncompressed_r8g8b8), :resource) end},
+  {"format rgba8 -> r4g4b4a4",
+   fn image -> Image.format(image, enum_pixel_format(:uncompressed_r4g4b4a4), :resource) end},
+  {"mipmaps", fn image -> Image.mipmaps(image, :resource) end},
+  {"alpha premultiply", fn image -> Image.alpha_premultiply(image, :resource) end},
+  {"format batch x8 rgba8 -> r5g6b5",
+   fn image ->
+     image
+     |> List.duplicate(8)
+     |> Image.format_batch(enum_pixel_format(:uncompressed_r5g6b5), :resource)
+   end}
+]
+
+jobs =
+  for {mode, fast_path} <- [{"raylib", false}, {"fast path", true}],
+      {name, func} <- operations,
+      into: %{} do
+    before_scenario = fn input ->
+      :ok = Image.set_fast_path(fast_path)
+      input
+    end
+
+    {"#{name} (#{mode})", {func, before_scenario: before_scenario}}
+  end
+
+Benchee.run(jobs,
+  inputs: inputs,
+  time: 5,
+  memory_time: 0
+)
+
+Image.set_fast_path(true)
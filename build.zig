@@ -28,6 +28,7 @@ pub fn build(b: *std.Build) !void {
     const options = b.addOptions();
     options.addOption(bool, "trace_log", raylib_trace_log);
     options.addOption(bool, "trace_log_debug", raylib_trace_log_debug);
+    options.addOption(bool, "platform_glfw", platform == PlatformBackend.glfw);
 
     // depedency
 
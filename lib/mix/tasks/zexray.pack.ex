@@ -0,0 +1,120 @@
+defmodule Mix.Tasks.Zexray.Pack do
+  @shortdoc "Builds an asset pack from a manifest"
+
+  @moduledoc """
+  Builds an asset pack from a manifest, see `Zexray.AssetPack`
+
+  ```
+  mix zexray.pack assets/manifest.exs priv/assets.pack
+  ```
+
+  The manifest is an Elixir script returning a list of assets,
+  the paths are relative to the manifest directory:
+
+  ```
+  [
+    {"player", :texture, "player.png", format: :uncompressed_r8g8b8a8, mipmaps: true},
+    {"tree", :mesh, "tree.obj", mesh: 0},
+    {"ui", :font, "ui.ttf", size: 32},
+    {"hit", :sound, "hit.wav"}
+  ]
+  ```
+
+  ## Options
+
+  | type       | option     | description                                        |
+  | ---------- | ---------- | -------------------------------------------------- |
+  | `:texture` | `:format`  | Pixel format (see `Zexray.Enum.PixelFormat`)       |
+  | `:texture` | `:mipmaps` | Generate the mipmaps (default `false`)             |
+  | `:mesh`    | `:mesh`    | Index of the mesh in the model (default `0`)       |
+  | `:font`    | `:size`    | Font size in pixels (default `32`)                 |
+
+  NOTE: A hidden window is opened, the models and fonts are loaded through OpenGL
+  """
+
+  use Mix.Task
+
+  use Zexray.Enum
+
+  require Zexray.Type.Model
+
+  @impl true
+  def run(args) do
+    {manifest, output} =
+      case args do
+        [manifest, output] -> {manifest, output}
+        _ -> Mix.raise("Usage: mix zexray.pack MANIFEST OUTPUT")
+      end
+
+    Mix.Task.run("compile")
+
+    {assets, _binding} = Code.eval_file(manifest)
+    base_dir = Path.dirname(manifest)
+
+    Zexray.Window.set_config_flags(enum_config_flag(:window_hidden))
+
+    Zexray.Window.with_window(1, 1, "zexray.pack", fn ->
+      entries = Enum.map(assets, &load_asset(&1, base_dir))
+
+      :ok = Zexray.AssetPack.export(output, entries)
+    end)
+
+    Mix.shell().info("Packed #{length(assets)} assets into #{output}")
+  end
+
+  defp load_asset({name, type, path}, base_dir), do: load_asset({name, type, path, []}, base_dir)
+
+  defp load_asset({name, :texture, path, opts}, base_dir) do
+    image = Zexray.Image.load(Path.join(base_dir, path), :value)
+
+    image =
+      case Keyword.get(opts, :format) do
+        nil -> image
+        format -> Zexray.Image.format(image, Zexray.Enum.PixelFormat.value(format), :value)
+      end
+
+    image =
+      if Keyword.get(opts, :mipmaps, false) do
+        Zexray.Image.mipmaps(image, :value)
+      else
+        image
+      end
+
+    {name, :texture, image}
+  end
+
+  defp load_asset({name, :mesh, path, opts}, base_dir) do
+    model = Zexray.Shape3D.load_model(Path.join(base_dir, path), :value)
+    meshes = Zexray.Type.Model.t(model, :meshes)
+
+    mesh =
+      Enum.at(meshes, Keyword.get(opts, :mesh, 0)) ||
+        Mix.raise("Mesh #{Keyword.get(opts, :mesh, 0)} not found in #{path}")
+
+    {name, :mesh, mesh}
+  end
+
+  defp load_asset({name, :font, path, opts}, base_dir) do
+    # Resource to keep the atlas texture alive until the pack is written
+    font =
+      Zexray.Font.load_ex(
+        Path.join(base_dir, path),
+        Keyword.get(opts, :size, 32),
+        [],
+        enum_font_type(:default),
+        :resource
+      )
+
+    {name, :font, font}
+  end
+
+  defp load_asset({name, :sound, path, _opts}, base_dir) do
+    wave = Zexray.Audio.load_wave(Path.join(base_dir, path), :value)
+
+    {name, :sound, wave}
+  end
+
+  defp load_asset(asset, _base_dir) do
+    Mix.raise("Invalid asset #{inspect(asset)}")
+  end
+end
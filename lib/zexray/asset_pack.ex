@@ -0,0 +1,144 @@
+defmodule Zexray.AssetPack do
+  @moduledoc """
+  Asset pack
+
+  Single file with pre-decoded assets (textures in their GPU format with mipmaps,
+  mesh vertex arrays, baked fonts and PCM sounds) and an index by name.
+
+  The pack is memory mapped, loading an asset does not decode anything:
+  textures and font atlases are uploaded straight from the mapped file.
+
+  Packs are built offline with `mix zexray.pack` or at runtime with `export/2`.
+
+  ```
+  pack = Zexray.AssetPack.load("assets.pack")
+
+  texture = Zexray.AssetPack.load_texture(pack, "player")
+  font = Zexray.AssetPack.load_font(pack, "ui")
+  ```
+  """
+
+  alias Zexray.NIF
+
+  ################
+  #  Asset pack  #
+  ################
+
+  @doc """
+  Load an asset pack, the file is memory mapped and only the index is read
+
+  `Zexray.Resource.free!/1` unmaps the file, the pack functions raise an
+  `ArgumentError` afterwards (the assets already loaded are not affected).
+  """
+  @doc group: :asset_pack
+  @spec load(file_name :: binary) :: Zexray.Type.AssetPack.t_resource()
+  defdelegate load(file_name), to: NIF, as: :load_asset_pack
+
+  @doc """
+  Get the assets of a pack as a list of `{name, type}`
+  """
+  @doc group: :asset_pack
+  @spec entries(pack :: Zexray.Type.AssetPack.t_resource()) :: [
+          {binary, :texture | :mesh | :font | :sound}
+        ]
+  defdelegate entries(pack), to: NIF, as: :get_asset_pack_entries
+
+  @doc """
+  Write an asset pack from decoded assets
+
+  The entries are a list of `{name, type, value}`:
+
+  - `{name, :texture, image}`: pixel data written as is (convert the format and generate the mipmaps before)
+  - `{name, :mesh, mesh}`: CPU vertex arrays
+  - `{name, :font, font}`: atlas read back from the font texture (requires the window to be initialized), recs and glyph infos
+  - `{name, :sound, wave}`: PCM data written as is
+  """
+  @doc group: :asset_pack
+  @spec export(
+          file_name :: binary,
+          entries :: [
+            {binary, :texture, Zexray.Type.Image.t_all()}
+            | {binary, :mesh, Zexray.Type.Mesh.t_all()}
+            | {binary, :font, Zexray.Type.Font.t_all()}
+            | {binary, :sound, Zexray.Type.Wave.t_all()}
+          ]
+        ) :: :ok
+  defdelegate export(
+                file_name,
+                entries
+              ),
+              to: NIF,
+              as: :export_asset_pack
+
+  ###################
+  #  Asset loading  #
+  ###################
+
+  @doc """
+  Load a texture from an asset pack
+  """
+  @doc group: :asset_loading
+  @spec load_texture(
+          pack :: Zexray.Type.AssetPack.t_resource(),
+          name :: binary,
+          return :: :auto | :value | :resource
+        ) :: Zexray.Type.Texture2D.t_nif()
+  defdelegate load_texture(
+                pack,
+                name,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :load_texture_from_asset_pack
+
+  @doc """
+  Load a mesh from an asset pack and upload it
+  """
+  @doc group: :asset_loading
+  @spec load_mesh(
+          pack :: Zexray.Type.AssetPack.t_resource(),
+          name :: binary,
+          return :: :auto | :value | :resource
+        ) :: Zexray.Type.Mesh.t_nif()
+  defdelegate load_mesh(
+                pack,
+                name,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :load_mesh_from_asset_pack
+
+  @doc """
+  Load a baked font from an asset pack
+  """
+  @doc group: :asset_loading
+  @spec load_font(
+          pack :: Zexray.Type.AssetPack.t_resource(),
+          name :: binary,
+          return :: :auto | :value | :resource
+        ) :: Zexray.Type.Font.t_nif()
+  defdelegate load_font(
+                pack,
+                name,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :load_font_from_asset_pack
+
+  @doc """
+  Load a sound from an asset pack
+  """
+  @doc group: :asset_loading
+  @spec load_sound(
+          pack :: Zexray.Type.AssetPack.t_resource(),
+          name :: binary,
+          return :: :auto | :value | :resource
+        ) :: Zexray.Type.Sound.t_nif()
+  defdelegate load_sound(
+                pack,
+                name,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :load_sound_from_asset_pack
+end
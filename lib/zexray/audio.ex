@@ -1121,6 +1121,108 @@ defmodule Zexray.Audio do
               to: NIF,
               as: :get_wave_info
 
+  @doc """
+  Resample many waves to the same sample rate in one call, the waves are processed in parallel
+
+  `quality` is `:linear`, `:cubic` (Catmull-Rom) or `:sinc` (windowed sinc, no aliasing when downsampling)
+  """
+  @doc group: :sound
+  @spec wave_resample_batch(
+          waves :: [Zexray.Type.Wave.t_all()],
+          sample_rate :: non_neg_integer,
+          quality :: :linear | :cubic | :sinc,
+          return :: :auto | :value | :resource
+        ) :: [Zexray.Type.Wave.t_nif()]
+  defdelegate wave_resample_batch(
+                waves,
+                sample_rate,
+                quality \\ :cubic,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :wave_resample_batch
+
+  @doc """
+  Change the channel count of many waves in one call, the waves are processed in parallel
+
+  Upmixing repeats the source channels in order, downmixing averages the source channels folded onto each channel
+  """
+  @doc group: :sound
+  @spec wave_remix_batch(
+          waves :: [Zexray.Type.Wave.t_all()],
+          channels :: non_neg_integer,
+          return :: :auto | :value | :resource
+        ) :: [Zexray.Type.Wave.t_nif()]
+  defdelegate wave_remix_batch(
+                waves,
+                channels,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :wave_remix_batch
+
+  @doc """
+  Scale many waves so that their peak reaches the same level in one call, the waves are processed in parallel
+  """
+  @doc group: :sound
+  @spec wave_normalize_batch(
+          waves :: [Zexray.Type.Wave.t_all()],
+          peak :: float,
+          return :: :auto | :value | :resource
+        ) :: [Zexray.Type.Wave.t_nif()]
+  defdelegate wave_normalize_batch(
+                waves,
+                peak \\ 1.0,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :wave_normalize_batch
+
+  @doc """
+  Remove the leading and trailing frames below a threshold of many waves in one call, the waves are processed in parallel
+  """
+  @doc group: :sound
+  @spec wave_trim_silence_batch(
+          waves :: [Zexray.Type.Wave.t_all()],
+          threshold :: float,
+          return :: :auto | :value | :resource
+        ) :: [Zexray.Type.Wave.t_nif()]
+  defdelegate wave_trim_silence_batch(
+                waves,
+                threshold \\ 0.001,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :wave_trim_silence_batch
+
+  @doc """
+  Get the peak and the RMS level of many waves in one call, 1.0 is full scale
+  """
+  @doc group: :sound
+  @spec get_wave_levels_batch(waves :: [Zexray.Type.Wave.t_all()]) :: [
+          %{peak: float, rms: float}
+        ]
+  def get_wave_levels_batch(waves) do
+    waves
+    |> NIF.get_wave_levels_batch()
+    |> Enum.map(fn {peak, rms} -> %{peak: peak, rms: rms} end)
+  end
+
+  @doc """
+  Mix waves into a new wave as long as the longest one, each wave is scaled by its gain (1.0 when no gains are given)
+
+  The waves must share the sample rate and the channel count, the sample size of the first wave is used
+  """
+  @doc group: :sound
+  @spec wave_mix(
+          waves :: [Zexray.Type.Wave.t_all()],
+          gains :: [float] | nil,
+          return :: :auto | :value | :resource
+        ) :: Zexray.Type.Wave.t_nif()
+  def wave_mix(waves, gains \\ nil, return \\ :auto) do
+    NIF.wave_mix(waves, gains || List.duplicate(1.0, length(waves)), return)
+  end
+
   @doc """
   Get wave data size in bytes
   """
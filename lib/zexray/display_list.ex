@@ -0,0 +1,92 @@
+defmodule Zexray.DisplayList do
+  @moduledoc """
+  Display lists
+
+  Draw calls (shapes, splines, text, textures) made between `begin_record/1` and
+  `end_record/1` are captured natively from the rlgl batch, already tessellated, instead
+  of being drawn. The display list resource replays them with one `draw/3` call, the
+  arguments are not decoded and the curves are not tessellated again.
+
+  With `static: true` the triangles are moved to static vertex buffers drawn with
+  `DrawMesh`, lines are always replayed through the batch.
+
+  ```elixir
+  Zexray.Drawing.begin_drawing()
+
+  Zexray.DisplayList.begin_record()
+  draw_background()
+  list = Zexray.DisplayList.end_record(static: true)
+
+  Zexray.DisplayList.draw(list)
+  Zexray.Drawing.end_drawing()
+  ```
+
+  NOTE: Record between `Zexray.Drawing.begin_drawing/0` and `Zexray.Drawing.end_drawing/0`.
+  Draw calls past `max_vertices`, past 256 texture and mode changes, or flushing the batch
+  (scissor, blend mode, mode end, meshes) draw the calls recorded so far to the screen and
+  `end_record/1` raises a `RuntimeError`. The positions are recorded with the transform active at that time,
+  the camera is applied when the list is drawn.
+  """
+
+  alias Zexray.NIF
+
+  ###############
+  #  Recording  #
+  ###############
+
+  @doc """
+  Record the following draw calls instead of drawing them
+  """
+  @spec begin_record(max_vertices :: non_neg_integer) :: :ok
+  defdelegate begin_record(max_vertices \\ 65536), to: NIF, as: :begin_display_list_record
+
+  @doc """
+  Stop recording and return the display list
+
+  ## Options
+
+  - `:static` - move the triangles to static vertex buffers (default `false`)
+  """
+  @spec end_record(opts :: [{:static, boolean}]) :: Zexray.Type.DisplayList.t_resource()
+  def end_record(opts \\ []) do
+    NIF.end_display_list_record(Keyword.get(opts, :static, false))
+  end
+
+  @doc """
+  Check if draw calls are being recorded
+  """
+  @spec recording?() :: boolean
+  defdelegate recording?(), to: NIF, as: :is_display_list_recording
+
+  #############
+  #  Drawing  #
+  #############
+
+  @doc """
+  Draw a display list under a transform with a tint (`nil` for none)
+  """
+  @spec draw(
+          list :: Zexray.Type.DisplayList.t_resource(),
+          transform :: Zexray.Type.Matrix.t_all() | nil,
+          tint :: Zexray.Type.Color.t_all() | nil
+        ) :: :ok
+  defdelegate draw(list, transform \\ nil, tint \\ nil), to: NIF, as: :draw_display_list
+
+  @doc """
+  Get the size of a display list
+  """
+  @spec info(list :: Zexray.Type.DisplayList.t_resource()) :: %{
+          vertex_count: non_neg_integer,
+          draw_call_count: non_neg_integer,
+          static_draw_call_count: non_neg_integer
+        }
+  def info(list) do
+    {vertex_count, draw_call_count, static_draw_call_count} = NIF.get_display_list_info(list)
+
+    %{
+      vertex_count: vertex_count,
+      draw_call_count: draw_call_count,
+      static_draw_call_count: static_draw_call_count
+    }
+  end
+end
@@ -141,12 +141,45 @@ defmodule Zexray.Drawing do
     end
   end
 
+  @doc """
+  Run function with custom shader drawing, uploading the dirty uniforms of the uniform set
+  """
+  @spec with_shader_mode(
+          shader :: Zexray.Type.Shader.t_all(),
+          uniform_set :: Zexray.Type.UniformSet.t_resource(),
+          func :: (-> any)
+        ) :: any
+  def with_shader_mode(shader, uniform_set, func) when is_function(func) do
+    try do
+      begin_shader_mode(shader, uniform_set)
+      func.()
+    after
+      end_shader_mode()
+    end
+  end
+
   @doc """
   Begin custom shader drawing
   """
   @spec begin_shader_mode(shader :: Zexray.Type.Shader.t_all()) :: :ok
   defdelegate begin_shader_mode(shader), to: NIF, as: :begin_shader_mode
 
+  @doc """
+  Begin custom shader drawing and upload the dirty uniforms of the uniform set
+
+  The uniform set must be loaded for the shader (`ArgumentError` otherwise).
+  """
+  @spec begin_shader_mode(
+          shader :: Zexray.Type.Shader.t_all(),
+          uniform_set :: Zexray.Type.UniformSet.t_resource()
+        ) :: :ok
+  defdelegate begin_shader_mode(
+                shader,
+                uniform_set
+              ),
+              to: NIF,
+              as: :begin_shader_mode
+
   @doc """
   End custom shader drawing (use default shader)
   """
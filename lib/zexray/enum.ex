@@ -33,6 +33,7 @@ defmodule Zexray.Enum do
           CubemapLayout,
           CullMode,
           DrawMode,
+          EventType,
           FontType,
           FramebufferAttachTextureType,
           FramebufferAttachType,
@@ -60,6 +61,7 @@ defmodule Zexray.Enum do
           GuiTextAlignment,
           GuiTextAlignmentVertical,
           GuiTextWrapMode,
+          InputSnapshotPart,
           KeyboardKey,
           MaterialMapIndex,
           MatrixMode,
@@ -73,7 +75,8 @@ defmodule Zexray.Enum do
           ShaderUniformDataType,
           TextureFilter,
           TextureWrap,
-          TraceLogLevel
+          TraceLogLevel,
+          VertexLayout
         }
 
         require Zexray.Enum
@@ -143,6 +146,12 @@ defmodule Zexray.Enum do
     end
   end
 
+  defmacro enum_event_type(value) do
+    quote do
+      Zexray.Enum.EventType.enum(unquote(value))
+    end
+  end
+
   defmacro enum_font_type(value) do
     quote do
       Zexray.Enum.FontType.enum(unquote(value))
@@ -305,6 +314,12 @@ defmodule Zexray.Enum do
     end
   end
 
+  defmacro enum_input_snapshot_part(value) do
+    quote do
+      Zexray.Enum.InputSnapshotPart.enum(unquote(value))
+    end
+  end
+
   defmacro enum_keyboard_key(value) do
     quote do
       Zexray.Enum.KeyboardKey.enum(unquote(value))
@@ -388,4 +403,10 @@ defmodule Zexray.Enum do
       Zexray.Enum.TraceLogLevel.enum(unquote(value))
     end
   end
+
+  defmacro enum_vertex_layout(value) do
+    quote do
+      Zexray.Enum.VertexLayout.enum(unquote(value))
+    end
+  end
 end
@@ -0,0 +1,37 @@
+defmodule Zexray.Enum.EventType do
+  @moduledoc """
+  Event types
+
+  NOTE: Every bit registers one type (use it with bit masks)
+
+  ## Values
+
+  |    id | name          | message                                                      |
+  | ----- | ------------- | ------------------------------------------------------------ |
+  | 0x001 | :key          | `{:key, key, :press / :release / :repeat, modifiers}`        |
+  | 0x002 | :char         | `{:char, codepoint}`                                         |
+  | 0x004 | :mouse_button | `{:mouse_button, button, :press / :release, modifiers}`      |
+  | 0x008 | :mouse_move   | `{:mouse_move, x, y}`                                        |
+  | 0x010 | :mouse_wheel  | `{:mouse_wheel, x, y}`                                       |
+  | 0x020 | :gamepad      | `{:gamepad, gamepad, :connected / :disconnected}`            |
+  | 0x040 | :resize       | `{:resize, width, height}`                                   |
+  | 0x080 | :focus        | `{:focus, focused}`                                          |
+  | 0x100 | :file_drop    | `{:file_drop, paths}`                                        |
+  | 0x200 | :close        | `:close`                                                     |
+  """
+
+  use Zexray.Enum.EnumBase,
+    prefix: "event_type",
+    values: %{
+      key: 0x001,
+      char: 0x002,
+      mouse_button: 0x004,
+      mouse_move: 0x008,
+      mouse_wheel: 0x010,
+      gamepad: 0x020,
+      resize: 0x040,
+      focus: 0x080,
+      file_drop: 0x100,
+      close: 0x200
+    }
+end
@@ -0,0 +1,27 @@
+defmodule Zexray.Enum.InputSnapshotPart do
+  @moduledoc """
+  Input snapshot parts
+
+  NOTE: Every bit registers one part (use it with bit masks)
+
+  ## Values
+
+  |   id | name      | description                                            |
+  | ---- | --------- | ------------------------------------------------------ |
+  | 0x01 | :keyboard | Keys down/previous bitsets and keys pressed queue      |
+  | 0x02 | :chars    | Chars pressed queue                                    |
+  | 0x04 | :mouse    | Mouse position, delta, wheel and buttons               |
+  | 0x08 | :gamepads | Buttons and axes of the available gamepads             |
+  | 0x10 | :touch    | Touch points                                           |
+  """
+
+  use Zexray.Enum.EnumBase,
+    prefix: "input_snapshot_part",
+    values: %{
+      keyboard: 0x01,
+      chars: 0x02,
+      mouse: 0x04,
+      gamepads: 0x08,
+      touch: 0x10
+    }
+end
@@ -0,0 +1,27 @@
+defmodule Zexray.Enum.VertexLayout do
+  @moduledoc """
+  Packed vertex binary layout (attributes are interleaved in this order, native endianness)
+
+  NOTE: Every bit registers one attribute (use it with bit masks), exactly one position is required
+
+  ## Values
+
+  |   id | name       | description              |
+  | ---- | ---------- | ------------------------ |
+  | 0x01 | :position2 | Position - 2 float       |
+  | 0x02 | :position3 | Position - 3 float       |
+  | 0x04 | :texcoord  | Texture coord - 2 float  |
+  | 0x08 | :normal    | Normal - 3 float         |
+  | 0x10 | :color     | Color - 4 unsigned byte  |
+  """
+
+  use Zexray.Enum.EnumBase,
+    prefix: "vertex_layout",
+    values: %{
+      position2: 0x01,
+      position3: 0x02,
+      texcoord: 0x04,
+      normal: 0x08,
+      color: 0x10
+    }
+end
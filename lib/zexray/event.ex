@@ -0,0 +1,103 @@
+defmodule Zexray.Event do
+  @moduledoc """
+  Event
+
+  Window and input events pushed to a process instead of polled every frame.
+
+  The GLFW callbacks write the events to a lock-free queue, a native thread sends
+  them in batches as `{:zexray_events, events}` messages (see `Zexray.Enum.EventType`
+  for the event formats). Consecutive mouse moves are coalesced to the last position.
+
+  Combined with `wait/1` (or `Zexray.Window.enable_event_waiting/0`) an idle app
+  does not use CPU until input arrives:
+
+  ```
+  Zexray.Event.subscribe()
+
+  # ...
+
+  Zexray.Event.wait()
+
+  receive do
+    {:zexray_events, events} -> # ...
+  end
+  ```
+
+  NOTE: Only supported by the desktop GLFW platform
+  """
+
+  alias Zexray.NIF
+
+  @type event ::
+          {:key, key :: integer, action :: :press | :release | :repeat, modifiers :: integer}
+          | {:char, codepoint :: integer}
+          | {:mouse_button, button :: integer, action :: :press | :release, modifiers :: integer}
+          | {:mouse_move, x :: float, y :: float}
+          | {:mouse_wheel, x :: float, y :: float}
+          | {:gamepad, gamepad :: integer, state :: :connected | :disconnected}
+          | {:resize, width :: integer, height :: integer}
+          | {:focus, focused :: boolean}
+          | {:file_drop, paths :: [binary]}
+          | :close
+
+  ########################
+  #  Event subscription  #
+  ########################
+
+  @doc """
+  Send the window and input events to a process (the caller by default)
+
+  `types` selects the events sent (see `Zexray.Enum.EventType`), all by default.
+
+  NOTE: Replaces the previous subscription, the window must be initialized
+  (subscribe again after the window is re-created)
+  """
+  @doc group: :event_subscription
+  @spec subscribe(pid :: pid, types :: Zexray.Enum.EventType.t_all_flag()) :: :ok
+  def subscribe(pid \\ self(), types \\ :all) do
+    NIF.subscribe_events(pid, Zexray.Enum.EventType.value_flag(types))
+  end
+
+  @doc """
+  Stop sending events, the pending events are dropped
+  """
+  @doc group: :event_subscription
+  @spec unsubscribe() :: :ok
+  defdelegate unsubscribe(), to: NIF, as: :unsubscribe_events
+
+  @doc """
+  Block until events arrive or the timeout (in seconds) expires
+
+  The subscribed process receives the events while waiting.
+
+  NOTE: The raylib input state is not advanced, use it while idle between frames.
+  Call it from the process owning the window (the one drawing the frames),
+  the window events must not be processed by two processes at once.
+  """
+  @doc group: :event_subscription
+  @spec wait(timeout :: number | nil) :: :ok
+  defdelegate wait(timeout \\ nil), to: NIF, as: :wait_events
+
+  @doc """
+  Wake up a pending `wait/1` (from any process)
+  """
+  @doc group: :event_subscription
+  @spec wake() :: :ok
+  defdelegate wake(), to: NIF, as: :wake_events
+
+  @doc """
+  Get the event statistics
+
+  `dropped` counts the events lost because the queue was full.
+  """
+  @doc group: :event_subscription
+  @spec stats() :: %{
+          events: non_neg_integer,
+          messages: non_neg_integer,
+          dropped: non_neg_integer
+        }
+  def stats() do
+    {events, messages, dropped} = NIF.get_event_stats()
+    %{events: events, messages: messages, dropped: dropped}
+  end
+end
@@ -0,0 +1,151 @@
+defmodule Zexray.FramePacer do
+  @moduledoc """
+  Frame pacing
+
+  With `custom_frame_control` enabled, `end_frame/1` replaces the
+  `Zexray.FrameControl.swap_screen_buffer/0`, `Zexray.FrameControl.wait_time/1` and
+  `Zexray.FrameControl.poll_input_events/0` calls with one native call. It sleeps
+  until shortly before the frame deadline, then yields and spins, so the frames end
+  within tens of microseconds of their deadline.
+
+  It also runs a fixed timestep accumulator: each frame returns the number of fixed
+  updates to run and the interpolation alpha between the last two states.
+
+  ```elixir
+  Zexray.FramePacer.configure(target_fps: 60, fixed_fps: 120)
+
+  loop = fn loop, state ->
+    Zexray.Drawing.begin_drawing()
+    draw(state)
+    Zexray.Drawing.end_drawing()
+
+    %{steps: steps, alpha: alpha} = Zexray.FramePacer.end_frame()
+    state = Enum.reduce(1..steps//1, state, fn _, state -> update(state, 1 / 120) end)
+
+    loop.(loop, %{state | alpha: alpha})
+  end
+  ```
+
+  NOTE: Without `custom_frame_control`, `Zexray.Drawing.end_drawing/0` already swaps,
+  waits and polls: set the target FPS to `0` and call `end_frame(swap: false, poll: false)`
+  """
+
+  alias Zexray.NIF
+
+  @type frame :: %{
+          steps: non_neg_integer,
+          alpha: float,
+          frame_time: float
+        }
+
+  @type stats :: %{
+          frames: non_neg_integer,
+          missed: non_neg_integer,
+          dropped_steps: non_neg_integer,
+          window_frames: non_neg_integer,
+          mean: float,
+          min: float,
+          max: float,
+          stddev: float,
+          jitter: float,
+          p50: float,
+          p99: float,
+          histogram: [{float, non_neg_integer}]
+        }
+
+  ############
+  #  Pacing  #
+  ############
+
+  @doc """
+  Set the frame pacing and the fixed timestep, the next frame starts a new schedule
+
+  ## Options
+
+  - `:target_fps` - frames per second, `0` for no pacing (default `60`)
+  - `:fixed_fps` - fixed updates per second, `0` for no fixed timestep (default `60`)
+  - `:max_steps` - fixed updates per frame at most, the time left is dropped (default `5`)
+  - `:spin_us` - time before the deadline waited without sleeping, in microseconds (default `1000`)
+  """
+  @spec configure(
+          opts :: [
+            {:target_fps, non_neg_integer}
+            | {:fixed_fps, non_neg_integer}
+            | {:max_steps, non_neg_integer}
+            | {:spin_us, non_neg_integer}
+          ]
+        ) :: :ok
+  def configure(opts \\ []) do
+    NIF.set_frame_pacer(
+      Keyword.get(opts, :target_fps, 60),
+      Keyword.get(opts, :fixed_fps, 60),
+      Keyword.get(opts, :max_steps, 5),
+      Keyword.get(opts, :spin_us, 1000)
+    )
+  end
+
+  @doc """
+  End a frame: swap the screen buffer, wait for the frame deadline and poll the input events
+
+  Returns the fixed updates to run (`:steps`), the interpolation alpha (`:alpha`)
+  and the seconds since the previous frame (`:frame_time`).
+
+  ## Options
+
+  - `:swap` - swap the screen buffer (default `true`)
+  - `:poll` - poll the input events (default `true`)
+  """
+  @spec end_frame(opts :: [{:swap, boolean} | {:poll, boolean}]) :: frame()
+  def end_frame(opts \\ []) do
+    {steps, alpha, frame_time} =
+      NIF.end_paced_frame(Keyword.get(opts, :swap, true), Keyword.get(opts, :poll, true))
+
+    %{steps: steps, alpha: alpha, frame_time: frame_time}
+  end
+
+  ###########
+  #  Stats  #
+  ###########
+
+  @doc """
+  Get the frame pacer stats
+
+  - `:frames` - frames ended
+  - `:missed` - frames ended after their deadline
+  - `:dropped_steps` - fixed updates dropped over `:max_steps`
+  - `:window_frames` - frames the times below are computed from (the last 256 at most)
+  - `:mean`, `:min`, `:max`, `:stddev`, `:p50`, `:p99` - frame times, in seconds
+  - `:jitter` - mean absolute deviation from the target frame time, in seconds
+  - `:histogram` - frame times as `{upper_bound, count}`, buckets of an eighth of the
+    target frame time (the last bucket counts all the longer frames)
+  """
+  @spec stats() :: stats()
+  def stats() do
+    {frames, missed, dropped_steps, window_frames, {mean, min, max, stddev, jitter, p50, p99},
+     {bucket_width, histogram}} = NIF.get_frame_pacer_stats()
+
+    %{
+      frames: frames,
+      missed: missed,
+      dropped_steps: dropped_steps,
+      window_frames: window_frames,
+      mean: mean,
+      min: min,
+      max: max,
+      stddev: stddev,
+      jitter: jitter,
+      p50: p50,
+      p99: p99,
+      histogram:
+        histogram
+        |> Enum.with_index(1)
+        |> Enum.map(fn {count, index} -> {index * bucket_width, count} end)
+    }
+  end
+
+  @doc """
+  Restart the counters and the frame time window
+  """
+  @spec reset_stats() :: :ok
+  defdelegate reset_stats(), to: NIF, as: :reset_frame_pacer_stats
+end
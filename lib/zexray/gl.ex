@@ -377,6 +377,29 @@ defmodule Zexray.Gl do
               to: NIF,
               as: :rl_color4
 
+  @doc """
+  Define many vertices from a packed binary
+
+  The binary holds interleaved vertices described by `layout` (see `Zexray.Enum.VertexLayout`),
+  floats and colors in native endianness, e.g. `<<x::float-32-native, y::float-32-native, r, g, b, a>>`.
+  The vertex count must be a multiple of the primitive size of `mode`.
+
+  Replaces the `begin_drawing/1`, `vertex*`, `end_drawing/0` calls, the render batch is flushed when it would overflow.
+  """
+  @doc group: :vertex_operation
+  @spec vertices(
+          mode :: Zexray.Enum.DrawMode.t(),
+          layout :: Zexray.Enum.VertexLayout.t() | non_neg_integer,
+          data :: binary
+        ) :: non_neg_integer
+  defdelegate vertices(
+                mode,
+                layout,
+                data
+              ),
+              to: NIF,
+              as: :rl_vertices
+
   #######################
   #  Render management  #
   #######################
@@ -366,6 +366,36 @@ defmodule Zexray.Guard do
   @doc group: :type
   defguard is_wave(value) when is_record(value, :wave, 6) or is_record(value, :wave_resource, 2)
 
+  @doc group: :type
+  defguard is_scene(value) when is_record(value, :scene_resource, 2)
+
+  @doc group: :type
+  defguard is_uniform_set(value) when is_record(value, :uniform_set_resource, 2)
+
+  @doc group: :type
+  defguard is_image_anim_stream(value) when is_record(value, :image_anim_stream_resource, 2)
+
+  @doc group: :type
+  defguard is_asset_pack(value) when is_record(value, :asset_pack_resource, 2)
+
+  @doc group: :type
+  defguard is_texture_stream(value) when is_record(value, :texture_stream_resource, 2)
+
+  @doc group: :type
+  defguard is_display_list(value) when is_record(value, :display_list_resource, 2)
+
+  @doc group: :type
+  defguard is_voice_pool(value) when is_record(value, :voice_pool_resource, 2)
+
+  @doc group: :type
+  defguard is_terrain(value) when is_record(value, :terrain_resource, 2)
+
+  @doc group: :type
+  defguard is_sprite_atlas(value) when is_record(value, :sprite_atlas_resource, 2)
+
+  @doc group: :type
+  defguard is_replay(value) when is_record(value, :replay_resource, 2)
+
   @doc group: :type
   defguard is_like_audio_info(value) when is_audio_info(value) or is_record_like(value, 5)
 
@@ -1052,4 +1052,49 @@ defmodule Zexray.Gui do
               ),
               to: NIF,
               as: :gui_color_panel_hsv
+
+  #######################
+  #  Declarative frame  #
+  #######################
+
+  @doc """
+  Run a whole frame of gui items in one call, returns the interactions as `[{id, value}]`
+
+  Items are run in order, containers run their children (positions relative to
+  the container origin for `:scroll_panel`, absolute otherwise):
+
+  - `:enable`, `:disable`, `:lock`, `:unlock`, `{:state, state}`, `{:style, control, property, value}`
+  - `{:panel, bounds, text, children}`, `{:group_box, bounds, text, children}`
+  - `{:window_box, id, bounds, title, children}` - reports `:closed`
+  - `{:scroll_panel, id, bounds, text, content, children}` - children are offset by
+    the scroll and clipped to the view (scroll panels must not be nested)
+  - `{:label, bounds, text}`, `{:status_bar, bounds, text}`, `{:dummy_rec, bounds, text}`, `{:line, bounds, text}`
+  - `{:button, id, bounds, text}`, `{:label_button, id, bounds, text}` - report `:pressed`
+  - `{:toggle, id, bounds, text, active}`, `{:check_box, id, bounds, text, checked}` - report the new boolean
+  - `{:toggle_group, id, bounds, text, active}`, `{:toggle_slider, ...}`, `{:combo_box, ...}`,
+    `{:dropdown_box, ...}`, `{:list_view, ...}` - report the new active index
+  - `{:spinner, id, bounds, text, value, min, max}`, `{:value_box, ...}` - report the new integer
+  - `{:slider, id, bounds, text_left, text_right, value, min, max}`, `{:slider_bar, ...}` - report the new float
+  - `{:progress_bar, bounds, text_left, text_right, value, min, max}`
+  - `{:text_box, id, bounds, text, size}` - reports the new text
+  - `{:color_picker, id, bounds, text, color}` - reports the new color
+
+  Only changes are reported. The id is any term, stable between frames: edit modes,
+  list view and scroll panel positions and text box buffers are kept natively by id
+  (a text box buffer is replaced only when the submitted text changes), states not
+  used for 120 frames are dropped.
+
+  An invalid item raises an `ArgumentError`, the gui state and lock set by the
+  items already run are restored.
+  """
+  @doc group: :frame
+  @spec frame(items :: list) :: [{term, term}]
+  defdelegate frame(items), to: NIF, as: :gui_frame
+
+  @doc """
+  Drop the states kept by `frame/1` (edit modes, text box buffers, scroll positions)
+  """
+  @doc group: :frame
+  @spec reset_frame() :: :ok
+  defdelegate reset_frame(), to: NIF, as: :gui_frame_reset
 end
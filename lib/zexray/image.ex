@@ -27,6 +27,25 @@ defmodule Zexray.Image do
               to: NIF,
               as: :image_get_data_size
 
+  @doc """
+  Enable the vectorized and multithreaded image processing (enabled by default)
+
+  `format/3`, `mipmaps/2` and `alpha_premultiply/2` use SIMD kernels split across
+  a worker pool for the formats with 8 bit channels (grayscale, gray alpha, R8G8B8
+  and R8G8B8A8) converted to those and the 16 bit formats. When disabled, or for the
+  other formats, the raylib implementation is used.
+  """
+  @doc group: :image
+  @spec set_fast_path(enabled :: boolean) :: :ok
+  defdelegate set_fast_path(enabled), to: NIF, as: :set_image_fast_path
+
+  @doc """
+  Check if the vectorized and multithreaded image processing is enabled
+  """
+  @doc group: :image
+  @spec fast_path?() :: boolean
+  defdelegate fast_path?(), to: NIF, as: :is_image_fast_path_enabled
+
   ###################
   #  Image loading  #
   ###################
@@ -177,6 +196,129 @@ defmodule Zexray.Image do
               to: NIF,
               as: :export_image_to_memory
 
+  ############################
+  #  Image animation stream  #
+  ############################
+
+  @doc """
+  Load an animated image stream from file (GIF)
+
+  Frames are decoded on demand into a ring of `ring_size` frames instead of
+  decoding the whole animation at once (see `load_anim/2`).
+
+  `Zexray.Resource.free!/1` releases the file data and the decoder buffers,
+  the stream functions raise an `ArgumentError` afterwards.
+  """
+  @doc group: :anim_stream
+  @spec load_anim_stream(
+          file_name :: binary,
+          ring_size :: pos_integer
+        ) :: Zexray.Type.ImageAnimStream.t_resource()
+  defdelegate load_anim_stream(
+                file_name,
+                ring_size \\ 2
+              ),
+              to: NIF,
+              as: :load_image_anim_stream
+
+  @doc """
+  Load an animated image stream from memory buffer, fileType refers to extension (only '.gif' is supported)
+  """
+  @doc group: :anim_stream
+  @spec load_anim_stream_from_memory(
+          file_type :: binary,
+          file_data :: binary,
+          ring_size :: pos_integer
+        ) :: Zexray.Type.ImageAnimStream.t_resource()
+  defdelegate load_anim_stream_from_memory(
+                file_type,
+                file_data,
+                ring_size \\ 2
+              ),
+              to: NIF,
+              as: :load_image_anim_stream_from_memory
+
+  @doc """
+  Get the animated image stream info
+  """
+  @doc group: :anim_stream
+  @spec anim_stream_info(stream :: Zexray.Type.ImageAnimStream.t_resource()) :: %{
+          width: non_neg_integer,
+          height: non_neg_integer,
+          frames: non_neg_integer,
+          frame: non_neg_integer
+        }
+  def anim_stream_info(stream) do
+    {width, height, frames, frame} = NIF.get_image_anim_stream_info(stream)
+    %{width: width, height: height, frames: frames, frame: frame}
+  end
+
+  @doc """
+  Get the animated image stream frame delays (in milliseconds)
+  """
+  @doc group: :anim_stream
+  @spec anim_stream_delays(stream :: Zexray.Type.ImageAnimStream.t_resource()) :: [
+          non_neg_integer
+        ]
+  defdelegate anim_stream_delays(stream), to: NIF, as: :get_image_anim_stream_delays
+
+  @doc """
+  Move the animated image stream to the next frame (looping), returns the frame index
+  """
+  @doc group: :anim_stream
+  @spec anim_stream_next_frame(stream :: Zexray.Type.ImageAnimStream.t_resource()) ::
+          non_neg_integer
+  defdelegate anim_stream_next_frame(stream), to: NIF, as: :image_anim_stream_next_frame
+
+  @doc """
+  Move the animated image stream to a frame
+
+  NOTE: Seeking backward out of the ring decodes again from the first frame
+  """
+  @doc group: :anim_stream
+  @spec anim_stream_seek(
+          stream :: Zexray.Type.ImageAnimStream.t_resource(),
+          frame :: non_neg_integer
+        ) :: :ok
+  defdelegate anim_stream_seek(
+                stream,
+                frame
+              ),
+              to: NIF,
+              as: :image_anim_stream_seek
+
+  @doc """
+  Get the current frame of the animated image stream as an image (R8G8B8A8)
+  """
+  @doc group: :anim_stream
+  @spec anim_stream_image(
+          stream :: Zexray.Type.ImageAnimStream.t_resource(),
+          return :: :auto | :value | :resource
+        ) :: Zexray.Type.Image.t_nif()
+  defdelegate anim_stream_image(
+                stream,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :get_image_anim_stream_image
+
+  @doc """
+  Update a texture with the current frame of the animated image stream, without copying it to Elixir
+
+  NOTE: The texture must have the size of the stream and the R8G8B8A8 pixel format
+  """
+  @doc group: :anim_stream
+  @spec update_texture_from_anim_stream(
+          texture :: Zexray.Type.Texture2D.t_all(),
+          stream :: Zexray.Type.ImageAnimStream.t_resource()
+        ) :: :ok
+  defdelegate update_texture_from_anim_stream(
+                texture,
+                stream
+              ),
+              to: NIF,
+              as: :update_texture_from_image_anim_stream
+
   ######################
   #  Image generation  #
   ######################
@@ -486,6 +628,23 @@ defmodule Zexray.Image do
               to: NIF,
               as: :image_format
 
+  @doc """
+  Convert many images to the same format in one call, the images are processed in parallel
+  """
+  @doc group: :manipulation
+  @spec format_batch(
+          images :: [Zexray.Type.Image.t_all()],
+          new_format :: Zexray.Enum.PixelFormat.t(),
+          return :: :auto | :value | :resource
+        ) :: [Zexray.Type.Image.t_nif()]
+  defdelegate format_batch(
+                images,
+                new_format,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :image_format_batch
+
   @doc """
   Convert image to POT (power-of-two)
   """
@@ -700,6 +859,21 @@ defmodule Zexray.Image do
               to: NIF,
               as: :image_mipmaps
 
+  @doc """
+  Compute all mipmap levels for many images in one call, the images are processed in parallel
+  """
+  @doc group: :manipulation
+  @spec mipmaps_batch(
+          images :: [Zexray.Type.Image.t_all()],
+          return :: :auto | :value | :resource
+        ) :: [Zexray.Type.Image.t_nif()]
+  defdelegate mipmaps_batch(
+                images,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :image_mipmaps_batch
+
   @doc """
   Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
   """
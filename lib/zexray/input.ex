@@ -0,0 +1,117 @@
+defmodule Zexray.Input do
+  @moduledoc """
+  Input
+
+  Whole-frame input state in one call, instead of one call per key, button or axis.
+
+  ```
+  snapshot = Zexray.Input.snapshot()
+
+  if Zexray.Input.key_pressed?(snapshot, enum_keyboard_key(:space)) do
+    # ...
+  end
+  ```
+  """
+
+  import Bitwise
+
+  alias Zexray.NIF
+
+  @type t :: %{
+          optional(:keys_down) => binary,
+          optional(:keys_down_previous) => binary,
+          optional(:keys_pressed) => [integer],
+          optional(:chars_pressed) => [integer],
+          optional(:mouse) =>
+            {x :: float, y :: float, delta_x :: float, delta_y :: float, wheel_x :: float,
+             wheel_y :: float, buttons_down :: non_neg_integer,
+             buttons_down_previous :: non_neg_integer},
+          optional(:gamepads) => [
+            {gamepad :: integer, buttons_down :: non_neg_integer,
+             buttons_down_previous :: non_neg_integer, axes :: [float]}
+          ],
+          optional(:touch) => [{id :: integer, x :: float, y :: float}]
+        }
+
+  ####################
+  #  Input snapshot  #
+  ####################
+
+  @doc """
+  Get the input state of the frame
+
+  `parts` selects what is encoded (see `Zexray.Enum.InputSnapshotPart`), all by default.
+
+  The keyboard state is returned as bitsets of the keys down this frame and the previous frame
+  (bit = key code, least significant bit first), the mouse and gamepad buttons as bit masks.
+
+  NOTE: The keys pressed and chars pressed queues are consumed
+  """
+  @doc group: :input_snapshot
+  @spec snapshot(parts :: Zexray.Enum.InputSnapshotPart.t_all_flag()) :: t
+  def snapshot(parts \\ :all) do
+    parts
+    |> Zexray.Enum.InputSnapshotPart.value_flag()
+    |> NIF.get_input_snapshot()
+  end
+
+  @doc """
+  Check if a key is being pressed
+  """
+  @doc group: :input_snapshot
+  @spec key_down?(snapshot :: t, key :: Zexray.Enum.KeyboardKey.t_free()) :: boolean
+  def key_down?(%{keys_down: keys_down}, key), do: bit_set?(keys_down, key)
+
+  @doc """
+  Check if a key has been pressed once
+  """
+  @doc group: :input_snapshot
+  @spec key_pressed?(snapshot :: t, key :: Zexray.Enum.KeyboardKey.t_free()) :: boolean
+  def key_pressed?(%{keys_down: keys_down, keys_down_previous: keys_down_previous}, key) do
+    bit_set?(keys_down, key) and not bit_set?(keys_down_previous, key)
+  end
+
+  @doc """
+  Check if a key has been released once
+  """
+  @doc group: :input_snapshot
+  @spec key_released?(snapshot :: t, key :: Zexray.Enum.KeyboardKey.t_free()) :: boolean
+  def key_released?(%{keys_down: keys_down, keys_down_previous: keys_down_previous}, key) do
+    not bit_set?(keys_down, key) and bit_set?(keys_down_previous, key)
+  end
+
+  @doc """
+  Check if a mouse button is being pressed
+  """
+  @doc group: :input_snapshot
+  @spec mouse_button_down?(snapshot :: t, button :: Zexray.Enum.MouseButton.t()) :: boolean
+  def mouse_button_down?(%{mouse: mouse}, button) do
+    (elem(mouse, 6) &&& 1 <<< button) != 0
+  end
+
+  @doc """
+  Check if a gamepad button is being pressed
+  """
+  @doc group: :input_snapshot
+  @spec gamepad_button_down?(
+          snapshot :: t,
+          gamepad :: integer,
+          button :: Zexray.Enum.GamepadButton.t()
+        ) :: boolean
+  def gamepad_button_down?(%{gamepads: gamepads}, gamepad, button) do
+    case List.keyfind(gamepads, gamepad, 0) do
+      {_gamepad, buttons_down, _buttons_down_previous, _axes} ->
+        (buttons_down &&& 1 <<< button) != 0
+
+      nil ->
+        false
+    end
+  end
+
+  defp bit_set?(bits, index) when index >= 0 and index < bit_size(bits) do
+    <<_::binary-size(div(index, 8)), byte, _::binary>> = bits
+    (byte >>> rem(index, 8) &&& 1) == 1
+  end
+
+  defp bit_set?(_bits, _index), do: false
+end
@@ -0,0 +1,160 @@
+defmodule Zexray.Memory do
+  @moduledoc """
+  Native memory accounting
+
+  Every native allocation (raylib, stb_truetype, raygui and the NIF code) is counted
+  per subsystem, and every resource is counted per type with an estimate of the
+  memory its value holds (CPU side and GPU side for textures, render textures,
+  fonts, meshes and models).
+
+  The counters are updated with relaxed atomics, they are always enabled.
+
+  ## Reclaiming
+
+  When a resource is garbage collected without `Zexray.Resource.free/1`, its payload
+  (GL objects, pixels, vertices, samples) is queued instead of leaking:
+
+  - GL payloads (textures, render textures, fonts, meshes, models, shaders) are
+    released after `Zexray.Drawing.end_drawing/0` and before `Zexray.Window.close/0`
+  - CPU payloads (images, waves, model animations, file path lists, automation
+    event lists) are released after each frame within a time budget (see
+    `set_reclaim_frame_budget/1`) or with `reclaim/1`
+
+  GL payloads of resources garbage collected after `Zexray.Window.close/0` are
+  discarded, the GL objects went away with the context (and their ids may be
+  reused by the next window).
+
+  NOTE: A resource owns its payload, values sharing it (read with `Zexray.Resource.content/1`)
+  must not outlive the resource, `Zexray.Shape3D.load_model_from_mesh/2` copies the mesh
+  and `Zexray.Font.get_default/1` or `Zexray.Gui.get_font/1` resources do not own the font
+
+  NOTE: Resources made from values with `Zexray.Resource.new/1` do not own their GL
+  objects (textures, render textures, fonts, meshes, shaders, models), the same ids
+  may be held by a model, a material or another resource. They are not reclaimed,
+  free them with `Zexray.Resource.free/1`
+  """
+
+  alias Zexray.NIF
+
+  @type counter :: %{
+          bytes: non_neg_integer,
+          peak_bytes: non_neg_integer,
+          count: non_neg_integer,
+          peak_count: non_neg_integer,
+          total: non_neg_integer
+        }
+
+  @type census :: %{
+          live: non_neg_integer,
+          peak_live: non_neg_integer,
+          created: non_neg_integer,
+          cpu_bytes: non_neg_integer,
+          gpu_bytes: non_neg_integer
+        }
+
+  @type reclaim_queue :: %{
+          pending: non_neg_integer,
+          reclaimed: non_neg_integer
+        }
+
+  @type t :: %{
+          allocations: %{native: counter, zig: counter},
+          resources: %{atom => census},
+          gpu: %{bytes: non_neg_integer, peak_bytes: non_neg_integer},
+          reclaim: %{gpu: reclaim_queue, cpu: reclaim_queue}
+        }
+
+  ############
+  #  Memory  #
+  ############
+
+  @doc """
+  Get the native memory stats
+
+  - `:allocations` - bytes and allocations per subsystem, `:native` for raylib
+    and the bundled C libraries, `:zig` for the NIF code (`:total` counts all
+    the allocations made)
+  - `:resources` - per resource type (only the types created at least once),
+    the live resources and the memory held by their values
+  - `:gpu` - estimated GPU memory held by all the resources
+  - `:reclaim` - payloads of garbage collected resources waiting to be released
+    and released so far, per queue (`:gpu` and `:cpu`)
+
+  NOTE: A resource freed with `free_resource` only keeps its struct accounted until it is garbage collected
+  """
+  @spec stats() :: t()
+  def stats() do
+    {allocations, resources, {gpu_bytes, gpu_peak_bytes}, reclaim} = NIF.get_memory_stats()
+
+    %{
+      allocations:
+        Map.new(allocations, fn {subsystem, {bytes, peak_bytes, count, peak_count, total}} ->
+          {subsystem,
+           %{
+             bytes: bytes,
+             peak_bytes: peak_bytes,
+             count: count,
+             peak_count: peak_count,
+             total: total
+           }}
+        end),
+      resources:
+        Map.new(resources, fn {type, {live, peak_live, created, cpu_bytes, gpu_bytes}} ->
+          {type,
+           %{
+             live: live,
+             peak_live: peak_live,
+             created: created,
+             cpu_bytes: cpu_bytes,
+             gpu_bytes: gpu_bytes
+           }}
+        end),
+      gpu: %{bytes: gpu_bytes, peak_bytes: gpu_peak_bytes},
+      reclaim:
+        Map.new(reclaim, fn {kind, {pending, reclaimed}} ->
+          {kind, %{pending: pending, reclaimed: reclaimed}}
+        end)
+    }
+  end
+
+  @doc """
+  Restart the peak counters from the current values
+  """
+  @spec reset_peaks() :: :ok
+  defdelegate reset_peaks(), to: NIF, as: :reset_memory_peaks
+
+  ################
+  #  Reclaiming  #
+  ################
+
+  @doc """
+  Reclaim the payloads of garbage collected resources (enabled by default)
+
+  When disabled, the payloads of resources not freed explicitly leak.
+  """
+  @spec set_auto_reclaim(enabled :: boolean) :: :ok
+  defdelegate set_auto_reclaim(enabled), to: NIF, as: :set_resource_reclaim
+
+  @doc """
+  Check if the payloads of garbage collected resources are reclaimed
+  """
+  @spec auto_reclaim?() :: boolean
+  defdelegate auto_reclaim?(), to: NIF, as: :is_resource_reclaim_enabled
+
+  @doc """
+  Set the time (in microseconds) spent releasing CPU payloads at the end of each frame (default `1000`)
+  """
+  @spec set_reclaim_frame_budget(budget_us :: non_neg_integer) :: :ok
+  defdelegate set_reclaim_frame_budget(budget_us),
+    to: NIF,
+    as: :set_resource_reclaim_frame_budget
+
+  @doc """
+  Release the pending CPU payloads during `budget_us` microseconds at most,
+  returns the number of payloads released
+
+  Useful when nothing is drawn, the GL payloads wait for the next frame.
+  """
+  @spec reclaim(budget_us :: non_neg_integer) :: non_neg_integer
+  defdelegate reclaim(budget_us \\ 1000), to: NIF, as: :reclaim_resources
+end
@@ -59,66 +59,90 @@ defmodule Zexray.NIF do
   end
 
   use Zexray.NIF.Resource
+  use Zexray.NIF.AssetPack
   use Zexray.NIF.Audio
   use Zexray.NIF.Camera
   use Zexray.NIF.Color
   use Zexray.NIF.Constant
   use Zexray.NIF.Cursor
+  use Zexray.NIF.DisplayList
   use Zexray.NIF.Drawing
+  use Zexray.NIF.Event
   use Zexray.NIF.FileSystem
   use Zexray.NIF.Font
   use Zexray.NIF.FrameControl
+  use Zexray.NIF.FramePacer
   use Zexray.NIF.Gamepad
   use Zexray.NIF.Gesture
   use Zexray.NIF.Gl
   use Zexray.NIF.Gui
   use Zexray.NIF.Image
+  use Zexray.NIF.Input
   use Zexray.NIF.Keyboard
+  use Zexray.NIF.Memory
   use Zexray.NIF.Monitor
   use Zexray.NIF.Mouse
+  use Zexray.NIF.Noise
   use Zexray.NIF.Random
+  use Zexray.NIF.Replay
+  use Zexray.NIF.Scene
   use Zexray.NIF.ScreenSpace
   use Zexray.NIF.Shader
   use Zexray.NIF.Shape
   use Zexray.NIF.Shape3D
+  use Zexray.NIF.SpriteAtlas
+  use Zexray.NIF.Terrain
   use Zexray.NIF.Text
   use Zexray.NIF.Texture
   use Zexray.NIF.Timing
   use Zexray.NIF.Touch
   use Zexray.NIF.TraceLog
   use Zexray.NIF.Util
+  use Zexray.NIF.VoicePool
   use Zexray.NIF.Vr
   use Zexray.NIF.Window
 
   @nifs @nifs_resource ++
+          @nifs_asset_pack ++
           @nifs_audio ++
           @nifs_camera ++
           @nifs_color ++
           @nifs_constant ++
           @nifs_cursor ++
+          @nifs_display_list ++
           @nifs_drawing ++
+          @nifs_event ++
           @nifs_file_system ++
           @nifs_font ++
           @nifs_frame_control ++
+          @nifs_frame_pacer ++
           @nifs_gamepad ++
           @nifs_gesture ++
           @nifs_gl ++
           @nifs_gui ++
           @nifs_image ++
+          @nifs_input ++
           @nifs_keyboard ++
+          @nifs_memory ++
           @nifs_monitor ++
           @nifs_mouse ++
+          @nifs_noise ++
           @nifs_random ++
+          @nifs_replay ++
+          @nifs_scene ++
           @nifs_screen_space ++
           @nifs_shader ++
           @nifs_shape ++
           @nifs_shape_3d ++
+          @nifs_sprite_atlas ++
+          @nifs_terrain ++
           @nifs_text ++
           @nifs_texture ++
           @nifs_timing ++
           @nifs_touch ++
           @nifs_trace_log ++
           @nifs_util ++
+          @nifs_voice_pool ++
           @nifs_vr ++
           @nifs_window
 end
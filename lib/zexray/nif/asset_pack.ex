@@ -0,0 +1,124 @@
+defmodule Zexray.NIF.AssetPack do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_asset_pack [
+        # Asset pack
+        load_asset_pack: 1,
+        get_asset_pack_entries: 1,
+        export_asset_pack: 2,
+
+        # Asset loading
+        load_texture_from_asset_pack: 2,
+        load_texture_from_asset_pack: 3,
+        load_mesh_from_asset_pack: 2,
+        load_mesh_from_asset_pack: 3,
+        load_font_from_asset_pack: 2,
+        load_font_from_asset_pack: 3,
+        load_sound_from_asset_pack: 2,
+        load_sound_from_asset_pack: 3
+      ]
+
+      ################
+      #  Asset pack  #
+      ################
+
+      @doc """
+      Load an asset pack, the file is memory mapped and only the index is read
+      """
+      @doc group: :asset_pack
+      @spec load_asset_pack(file_name :: binary) :: tuple
+      def load_asset_pack(_file_name), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the assets of a pack as a list of `{name, type}`
+      """
+      @doc group: :asset_pack
+      @spec get_asset_pack_entries(pack :: tuple) :: [{binary, :texture | :mesh | :font | :sound}]
+      def get_asset_pack_entries(_pack), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Write an asset pack from a list of `{name, type, value}`
+      """
+      @doc group: :asset_pack
+      @spec export_asset_pack(
+              file_name :: binary,
+              entries :: [{binary, :texture | :mesh | :font | :sound, tuple}]
+            ) :: :ok
+      def export_asset_pack(
+            _file_name,
+            _entries
+          ),
+          do: :erlang.nif_error(:undef)
+
+      ###################
+      #  Asset loading  #
+      ###################
+
+      @doc """
+      Load a texture from an asset pack
+      """
+      @doc group: :asset_loading
+      @spec load_texture_from_asset_pack(
+              pack :: tuple,
+              name :: binary,
+              return :: :auto | :value | :resource
+            ) :: tuple
+      def load_texture_from_asset_pack(
+            _pack,
+            _name,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Load a mesh from an asset pack
+      """
+      @doc group: :asset_loading
+      @spec load_mesh_from_asset_pack(
+              pack :: tuple,
+              name :: binary,
+              return :: :auto | :value | :resource
+            ) :: tuple
+      def load_mesh_from_asset_pack(
+            _pack,
+            _name,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Load a font from an asset pack
+      """
+      @doc group: :asset_loading
+      @spec load_font_from_asset_pack(
+              pack :: tuple,
+              name :: binary,
+              return :: :auto | :value | :resource
+            ) :: tuple
+      def load_font_from_asset_pack(
+            _pack,
+            _name,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Load a sound from an asset pack
+      """
+      @doc group: :asset_loading
+      @spec load_sound_from_asset_pack(
+              pack :: tuple,
+              name :: binary,
+              return :: :auto | :value | :resource
+            ) :: tuple
+      def load_sound_from_asset_pack(
+            _pack,
+            _name,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+    end
+  end
+end
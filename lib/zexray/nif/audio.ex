@@ -67,6 +67,17 @@ defmodule Zexray.NIF.Audio do
         load_wave_samples_ex: 4,
         get_wave_info: 1,
         get_wave_info: 2,
+        wave_resample_batch: 3,
+        wave_resample_batch: 4,
+        wave_remix_batch: 2,
+        wave_remix_batch: 3,
+        wave_normalize_batch: 2,
+        wave_normalize_batch: 3,
+        wave_trim_silence_batch: 2,
+        wave_trim_silence_batch: 3,
+        get_wave_levels_batch: 1,
+        wave_mix: 2,
+        wave_mix: 3,
 
         # Sound stream management
         load_sound_stream: 1,
@@ -801,6 +812,95 @@ defmodule Zexray.NIF.Audio do
           ),
           do: :erlang.nif_error(:undef)
 
+      @doc """
+      Resample many waves to the same sample rate in one call, the waves are processed in parallel
+      """
+      @doc group: :sound_management
+      @spec wave_resample_batch(
+              waves :: [tuple],
+              sample_rate :: non_neg_integer,
+              quality :: :linear | :cubic | :sinc,
+              return :: :auto | :value | :resource
+            ) :: [tuple]
+      def wave_resample_batch(
+            _waves,
+            _sample_rate,
+            _quality,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Change the channel count of many waves in one call, the waves are processed in parallel
+      """
+      @doc group: :sound_management
+      @spec wave_remix_batch(
+              waves :: [tuple],
+              channels :: non_neg_integer,
+              return :: :auto | :value | :resource
+            ) :: [tuple]
+      def wave_remix_batch(
+            _waves,
+            _channels,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Scale many waves so that their peak reaches the same level in one call, the waves are processed in parallel
+      """
+      @doc group: :sound_management
+      @spec wave_normalize_batch(
+              waves :: [tuple],
+              peak :: float,
+              return :: :auto | :value | :resource
+            ) :: [tuple]
+      def wave_normalize_batch(
+            _waves,
+            _peak,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Remove the leading and trailing frames below a threshold of many waves in one call, the waves are processed in parallel
+      """
+      @doc group: :sound_management
+      @spec wave_trim_silence_batch(
+              waves :: [tuple],
+              threshold :: float,
+              return :: :auto | :value | :resource
+            ) :: [tuple]
+      def wave_trim_silence_batch(
+            _waves,
+            _threshold,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the levels of many waves in one call, returns a list of {peak, rms}
+      """
+      @doc group: :sound_management
+      @spec get_wave_levels_batch(waves :: [tuple]) :: [{float, float}]
+      def get_wave_levels_batch(_waves), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Mix waves (same sample rate and channels) into a new wave as long as the longest one, each wave scaled by its gain
+      """
+      @doc group: :sound_management
+      @spec wave_mix(
+              waves :: [tuple],
+              gains :: [float],
+              return :: :auto | :value | :resource
+            ) :: tuple
+      def wave_mix(
+            _waves,
+            _gains,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
       #############################
       #  Sound stream management  #
       #############################
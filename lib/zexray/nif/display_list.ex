@@ -0,0 +1,71 @@
+defmodule Zexray.NIF.DisplayList do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_display_list [
+        # Recording
+        begin_display_list_record: 1,
+        end_display_list_record: 1,
+        is_display_list_recording: 0,
+
+        # Drawing
+        draw_display_list: 3,
+        get_display_list_info: 1
+      ]
+
+      ###############
+      #  Recording  #
+      ###############
+
+      @doc """
+      Record the following draw calls instead of drawing them
+      """
+      @doc group: :display_list_recording
+      @spec begin_display_list_record(max_vertices :: non_neg_integer) :: :ok
+      def begin_display_list_record(_max_vertices), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Stop recording, returns the display list resource
+      """
+      @doc group: :display_list_recording
+      @spec end_display_list_record(upload_static :: boolean) :: tuple
+      def end_display_list_record(_upload_static), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Check if draw calls are being recorded
+      """
+      @doc group: :display_list_recording
+      @spec is_display_list_recording() :: boolean
+      def is_display_list_recording(), do: :erlang.nif_error(:undef)
+
+      #############
+      #  Drawing  #
+      #############
+
+      @doc """
+      Draw a display list under a transform with a tint (`nil` for none)
+      """
+      @doc group: :display_list_drawing
+      @spec draw_display_list(
+              list :: tuple,
+              transform :: tuple | nil,
+              tint :: tuple | nil
+            ) :: :ok
+      def draw_display_list(
+            _list,
+            _transform,
+            _tint
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the size of a display list as `{vertex_count, draw_call_count, static_draw_call_count}`
+      """
+      @doc group: :display_list_drawing
+      @spec get_display_list_info(list :: tuple) ::
+              {non_neg_integer, non_neg_integer, non_neg_integer}
+      def get_display_list_info(_list), do: :erlang.nif_error(:undef)
+    end
+  end
+end
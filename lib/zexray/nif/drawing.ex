@@ -15,6 +15,7 @@ defmodule Zexray.NIF.Drawing do
         begin_texture_mode: 1,
         end_texture_mode: 0,
         begin_shader_mode: 1,
+        begin_shader_mode: 2,
         end_shader_mode: 0,
         begin_blend_mode: 1,
         end_blend_mode: 0,
@@ -149,6 +150,25 @@ defmodule Zexray.NIF.Drawing do
       @spec begin_shader_mode(shader :: tuple) :: :ok
       def begin_shader_mode(_shader), do: :erlang.nif_error(:undef)
 
+      @doc """
+      Begin custom shader drawing and upload the dirty uniforms of the uniform set
+
+      ```c
+      // raylib.h
+      RLAPI void BeginShaderMode(Shader shader);
+      ```
+      """
+      @doc group: :drawing
+      @spec begin_shader_mode(
+              shader :: tuple,
+              uniform_set :: tuple
+            ) :: :ok
+      def begin_shader_mode(
+            _shader,
+            _uniform_set
+          ),
+          do: :erlang.nif_error(:undef)
+
       @doc """
       End custom shader drawing (use default shader)
 
@@ -0,0 +1,61 @@
+defmodule Zexray.NIF.Event do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_event [
+        # Event subscription
+        subscribe_events: 1,
+        subscribe_events: 2,
+        unsubscribe_events: 0,
+        wait_events: 0,
+        wait_events: 1,
+        wake_events: 0,
+        get_event_stats: 0
+      ]
+
+      ########################
+      #  Event subscription  #
+      ########################
+
+      @doc """
+      Send window and input events to a pid as `{:zexray_events, events}` messages (types selected by the mask, all by default)
+
+      NOTE: Replaces the previous subscription, the window must be initialized
+      """
+      @doc group: :event_subscription
+      @spec subscribe_events(pid :: pid, mask :: non_neg_integer) :: :ok
+      def subscribe_events(_pid, _mask \\ 0x3FF), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Stop sending events, the pending events are dropped
+      """
+      @doc group: :event_subscription
+      @spec unsubscribe_events() :: :ok
+      def unsubscribe_events(), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Wait for events (timeout in seconds, nil = no timeout), the window callbacks are called
+      """
+      @doc group: :event_subscription
+      @spec wait_events(timeout :: number | nil) :: :ok
+      def wait_events(_timeout \\ nil), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Wake up a pending wait_events
+      """
+      @doc group: :event_subscription
+      @spec wake_events() :: :ok
+      def wake_events(), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the event statistics: {events sent, messages sent, events dropped}
+      """
+      @doc group: :event_subscription
+      @spec get_event_stats() ::
+              {events :: non_neg_integer, messages :: non_neg_integer,
+               dropped :: non_neg_integer}
+      def get_event_stats(), do: :erlang.nif_error(:undef)
+    end
+  end
+end
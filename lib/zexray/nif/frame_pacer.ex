@@ -0,0 +1,68 @@
+defmodule Zexray.NIF.FramePacer do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_frame_pacer [
+        # Pacing
+        set_frame_pacer: 4,
+        end_paced_frame: 2,
+
+        # Stats
+        get_frame_pacer_stats: 0,
+        reset_frame_pacer_stats: 0
+      ]
+
+      ############
+      #  Pacing  #
+      ############
+
+      @doc """
+      Set the frame pacing and the fixed timestep (`0` for none)
+      """
+      @doc group: :frame_pacer_pacing
+      @spec set_frame_pacer(
+              target_fps :: non_neg_integer,
+              fixed_fps :: non_neg_integer,
+              max_steps :: non_neg_integer,
+              spin_us :: non_neg_integer
+            ) :: :ok
+      def set_frame_pacer(
+            _target_fps,
+            _fixed_fps,
+            _max_steps,
+            _spin_us
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      End a frame (swap, wait for the deadline, poll), returns `{fixed_steps, alpha, frame_time}`
+      """
+      @doc group: :frame_pacer_pacing
+      @spec end_paced_frame(swap :: boolean, poll :: boolean) ::
+              {non_neg_integer, float, float}
+      def end_paced_frame(_swap, _poll), do: :erlang.nif_error(:undef)
+
+      ###########
+      #  Stats  #
+      ###########
+
+      @doc """
+      Get the frame pacer stats as
+      `{frames, missed, dropped_steps, window_frames, {mean, min, max, stddev, jitter, p50, p99}, {bucket_width, histogram}}`
+      """
+      @doc group: :frame_pacer_stats
+      @spec get_frame_pacer_stats() ::
+              {non_neg_integer, non_neg_integer, non_neg_integer, non_neg_integer,
+               {float, float, float, float, float, float, float}, {float, [non_neg_integer]}}
+      def get_frame_pacer_stats(), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Restart the frame pacer counters and frame time window
+      """
+      @doc group: :frame_pacer_stats
+      @spec reset_frame_pacer_stats() :: :ok
+      def reset_frame_pacer_stats(), do: :erlang.nif_error(:undef)
+    end
+  end
+end
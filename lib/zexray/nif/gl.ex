@@ -30,6 +30,7 @@ defmodule Zexray.NIF.Gl do
         rl_color4_byte: 4,
         rl_color3: 3,
         rl_color4: 4,
+        rl_vertices: 3,
 
         # Render management
         rl_set_texture: 1
@@ -459,6 +460,24 @@ defmodule Zexray.NIF.Gl do
           ),
           do: :erlang.nif_error(:undef)
 
+      @doc """
+      Define many vertices from a packed binary (interleaved attributes, see `Zexray.Enum.VertexLayout`)
+
+      Returns the number of vertices drawn, the render batch is flushed when it would overflow
+      """
+      @doc group: :gl
+      @spec rl_vertices(
+              mode :: integer,
+              layout :: integer,
+              data :: binary
+            ) :: non_neg_integer
+      def rl_vertices(
+            _mode,
+            _layout,
+            _data
+          ),
+          do: :erlang.nif_error(:undef)
+
       #######################
       #  Render management  #
       #######################
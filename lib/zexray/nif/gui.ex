@@ -87,7 +87,11 @@ defmodule Zexray.NIF.Gui do
         gui_color_picker_hsv: 3,
         gui_color_picker_hsv: 4,
         gui_color_panel_hsv: 3,
-        gui_color_panel_hsv: 4
+        gui_color_panel_hsv: 4,
+
+        # Declarative frame
+        gui_frame: 1,
+        gui_frame_reset: 0
       ]
 
       ########################################
@@ -1260,6 +1264,24 @@ defmodule Zexray.NIF.Gui do
             _return \\ :auto
           ),
           do: :erlang.nif_error(:undef)
+
+      #######################
+      #  Declarative frame  #
+      #######################
+
+      @doc """
+      Run a list of gui items in order, returns the interactions as `[{id, value}]`
+      """
+      @doc group: :gui_frame
+      @spec gui_frame(items :: list) :: [{term, term}]
+      def gui_frame(_items), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Drop the states kept by `gui_frame` (edit modes, text box buffers, scroll positions)
+      """
+      @doc group: :gui_frame
+      @spec gui_frame_reset() :: :ok
+      def gui_frame_reset(), do: :erlang.nif_error(:undef)
     end
   end
 end
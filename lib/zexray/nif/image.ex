@@ -6,6 +6,8 @@ defmodule Zexray.NIF.Image do
       @nifs_image [
         # Image
         image_get_data_size: 4,
+        set_image_fast_path: 1,
+        is_image_fast_path_enabled: 0,
 
         # Image loading
         load_image: 1,
@@ -26,6 +28,19 @@ defmodule Zexray.NIF.Image do
         export_image: 2,
         export_image_to_memory: 2,
 
+        # Image animation stream
+        load_image_anim_stream: 1,
+        load_image_anim_stream: 2,
+        load_image_anim_stream_from_memory: 2,
+        load_image_anim_stream_from_memory: 3,
+        get_image_anim_stream_info: 1,
+        get_image_anim_stream_delays: 1,
+        image_anim_stream_next_frame: 1,
+        image_anim_stream_seek: 2,
+        get_image_anim_stream_image: 1,
+        get_image_anim_stream_image: 2,
+        update_texture_from_image_anim_stream: 2,
+
         # Image generation
         gen_image_color: 3,
         gen_image_color: 4,
@@ -59,6 +74,8 @@ defmodule Zexray.NIF.Image do
         image_text_ex: 6,
         image_format: 2,
         image_format: 3,
+        image_format_batch: 2,
+        image_format_batch: 3,
         image_to_pot: 2,
         image_to_pot: 3,
         image_crop: 2,
@@ -83,6 +100,8 @@ defmodule Zexray.NIF.Image do
         image_resize_canvas: 7,
         image_mipmaps: 1,
         image_mipmaps: 2,
+        image_mipmaps_batch: 1,
+        image_mipmaps_batch: 2,
         image_dither: 5,
         image_dither: 6,
         image_flip_vertical: 1,
@@ -189,6 +208,22 @@ defmodule Zexray.NIF.Image do
           ),
           do: :erlang.nif_error(:undef)
 
+      @doc """
+      Enable the vectorized and multithreaded image processing (enabled by default)
+
+      When disabled the raylib implementation is used
+      """
+      @doc group: :image
+      @spec set_image_fast_path(enabled :: boolean) :: :ok
+      def set_image_fast_path(_enabled), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Check if the vectorized and multithreaded image processing is enabled
+      """
+      @doc group: :image
+      @spec is_image_fast_path_enabled() :: boolean
+      def is_image_fast_path_enabled(), do: :erlang.nif_error(:undef)
+
       ###################
       #  Image loading  #
       ###################
@@ -381,6 +416,105 @@ defmodule Zexray.NIF.Image do
           ),
           do: :erlang.nif_error(:undef)
 
+      ############################
+      #  Image animation stream  #
+      ############################
+
+      @doc """
+      Load animated image stream from file (GIF), frames are decoded on demand into a ring of ring_size frames
+      """
+      @doc group: :image_animation_stream
+      @spec load_image_anim_stream(
+              file_name :: binary,
+              ring_size :: pos_integer
+            ) :: tuple
+      def load_image_anim_stream(
+            _file_name,
+            _ring_size \\ 2
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Load animated image stream from memory buffer, fileType refers to extension (only '.gif' is supported)
+      """
+      @doc group: :image_animation_stream
+      @spec load_image_anim_stream_from_memory(
+              file_type :: binary,
+              file_data :: binary,
+              ring_size :: pos_integer
+            ) :: tuple
+      def load_image_anim_stream_from_memory(
+            _file_type,
+            _file_data,
+            _ring_size \\ 2
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get animated image stream info: {width, height, frame count, current frame}
+      """
+      @doc group: :image_animation_stream
+      @spec get_image_anim_stream_info(stream :: tuple) ::
+              {width :: non_neg_integer, height :: non_neg_integer, frames :: non_neg_integer,
+               frame :: non_neg_integer}
+      def get_image_anim_stream_info(_stream), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get animated image stream frame delays (in milliseconds)
+      """
+      @doc group: :image_animation_stream
+      @spec get_image_anim_stream_delays(stream :: tuple) :: [non_neg_integer]
+      def get_image_anim_stream_delays(_stream), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Move animated image stream to the next frame (looping) and decode it, returns the frame index
+      """
+      @doc group: :image_animation_stream
+      @spec image_anim_stream_next_frame(stream :: tuple) :: non_neg_integer
+      def image_anim_stream_next_frame(_stream), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Move animated image stream to a frame and decode it
+      """
+      @doc group: :image_animation_stream
+      @spec image_anim_stream_seek(
+              stream :: tuple,
+              frame :: non_neg_integer
+            ) :: :ok
+      def image_anim_stream_seek(
+            _stream,
+            _frame
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the current frame of an animated image stream as an image (R8G8B8A8)
+      """
+      @doc group: :image_animation_stream
+      @spec get_image_anim_stream_image(
+              stream :: tuple,
+              return :: :auto | :value | :resource
+            ) :: tuple
+      def get_image_anim_stream_image(
+            _stream,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Update GPU texture with the current frame of an animated image stream (same size, R8G8B8A8 format)
+      """
+      @doc group: :image_animation_stream
+      @spec update_texture_from_image_anim_stream(
+              texture :: tuple,
+              stream :: tuple
+            ) :: :ok
+      def update_texture_from_image_anim_stream(
+            _texture,
+            _stream
+          ),
+          do: :erlang.nif_error(:undef)
+
       ######################
       #  Image generation  #
       ######################
@@ -750,6 +884,22 @@ defmodule Zexray.NIF.Image do
           ),
           do: :erlang.nif_error(:undef)
 
+      @doc """
+      Convert many images to the same format in one call, the images are processed in parallel
+      """
+      @doc group: :image_manipulation
+      @spec image_format_batch(
+              images :: [tuple],
+              new_format :: integer,
+              return :: :auto | :value | :resource
+            ) :: [tuple]
+      def image_format_batch(
+            _images,
+            _new_format,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
       @doc """
       Convert image to POT (power-of-two)
 
@@ -1012,6 +1162,20 @@ defmodule Zexray.NIF.Image do
           ),
           do: :erlang.nif_error(:undef)
 
+      @doc """
+      Compute all mipmap levels for many images in one call, the images are processed in parallel
+      """
+      @doc group: :image_manipulation
+      @spec image_mipmaps_batch(
+              images :: [tuple],
+              return :: :auto | :value | :resource
+            ) :: [tuple]
+      def image_mipmaps_batch(
+            _images,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
       @doc """
       Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 
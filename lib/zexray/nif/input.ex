@@ -0,0 +1,26 @@
+defmodule Zexray.NIF.Input do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_input [
+        # Input snapshot
+        get_input_snapshot: 0,
+        get_input_snapshot: 1
+      ]
+
+      ####################
+      #  Input snapshot  #
+      ####################
+
+      @doc """
+      Get the input state of the frame in one call (parts selected by the mask, all by default)
+
+      NOTE: The keys pressed and chars pressed queues are consumed
+      """
+      @doc group: :input_snapshot
+      @spec get_input_snapshot(mask :: non_neg_integer) :: map
+      def get_input_snapshot(_mask \\ 0x1F), do: :erlang.nif_error(:undef)
+    end
+  end
+end
@@ -0,0 +1,71 @@
+defmodule Zexray.NIF.Memory do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_memory [
+        # Memory
+        get_memory_stats: 0,
+        reset_memory_peaks: 0,
+
+        # Reclaiming
+        set_resource_reclaim: 1,
+        is_resource_reclaim_enabled: 0,
+        set_resource_reclaim_frame_budget: 1,
+        reclaim_resources: 1
+      ]
+
+      ############
+      #  Memory  #
+      ############
+
+      @doc """
+      Get the native memory stats as `{allocations, resources, gpu, reclaim}`
+      """
+      @doc group: :memory
+      @spec get_memory_stats() ::
+              {[{atom, tuple}], [{atom, tuple}], {non_neg_integer, non_neg_integer},
+               [{atom, tuple}]}
+      def get_memory_stats(), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Restart the peak counters from the current values
+      """
+      @doc group: :memory
+      @spec reset_memory_peaks() :: :ok
+      def reset_memory_peaks(), do: :erlang.nif_error(:undef)
+
+      ################
+      #  Reclaiming  #
+      ################
+
+      @doc """
+      Reclaim the payloads of garbage collected resources (enabled by default)
+      """
+      @doc group: :reclaiming
+      @spec set_resource_reclaim(enabled :: boolean) :: :ok
+      def set_resource_reclaim(_enabled), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Check if the payloads of garbage collected resources are reclaimed
+      """
+      @doc group: :reclaiming
+      @spec is_resource_reclaim_enabled() :: boolean
+      def is_resource_reclaim_enabled(), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Set the time (in microseconds) spent releasing CPU payloads at the end of each frame
+      """
+      @doc group: :reclaiming
+      @spec set_resource_reclaim_frame_budget(budget_us :: non_neg_integer) :: :ok
+      def set_resource_reclaim_frame_budget(_budget_us), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Release the pending CPU payloads during `budget_us` microseconds at most
+      """
+      @doc group: :reclaiming
+      @spec reclaim_resources(budget_us :: non_neg_integer) :: non_neg_integer
+      def reclaim_resources(_budget_us), do: :erlang.nif_error(:undef)
+    end
+  end
+end
@@ -0,0 +1,78 @@
+defmodule Zexray.NIF.Noise do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_noise [
+        # Noise generation
+        gen_noise_field: 4,
+        gen_image_noise: 3,
+        gen_image_noise: 4,
+        gen_mesh_heightmap_noise: 4,
+        gen_mesh_heightmap_noise: 5
+      ]
+
+      ######################
+      #  Noise generation  #
+      ######################
+
+      @doc """
+      Generate a noise field as a binary of packed native endian f32 values in [-1, 1]
+
+      `params` is `{kind, fractal, dimensions, seed, frequency, octaves, lacunarity, gain, warp_amplitude, warp_frequency, offset_x, offset_y, offset_z}`
+      """
+      @doc group: :noise_generation
+      @spec gen_noise_field(
+              width :: number,
+              height :: number,
+              depth :: number,
+              params :: tuple
+            ) :: binary
+      def gen_noise_field(
+            _width,
+            _height,
+            _depth,
+            _params
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Generate image: noise field (grayscale)
+      """
+      @doc group: :noise_generation
+      @spec gen_image_noise(
+              width :: number,
+              height :: number,
+              params :: tuple,
+              return :: :auto | :value | :resource
+            ) :: tuple
+      def gen_image_noise(
+            _width,
+            _height,
+            _params,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Generate heightmap mesh from a noise field
+      """
+      @doc group: :noise_generation
+      @spec gen_mesh_heightmap_noise(
+              width :: number,
+              height :: number,
+              params :: tuple,
+              size :: tuple,
+              return :: :auto | :value | :resource
+            ) :: tuple
+      def gen_mesh_heightmap_noise(
+            _width,
+            _height,
+            _params,
+            _size,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+    end
+  end
+end
@@ -0,0 +1,94 @@
+defmodule Zexray.NIF.Replay do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_replay [
+        # Loading
+        load_replay: 7,
+        rewind_replay: 1,
+
+        # Frames
+        begin_replay_frame: 1,
+        end_replay_frame: 1,
+
+        # Stats
+        get_replay_stats: 1,
+        get_replay_frames: 1
+      ]
+
+      #############
+      #  Loading  #
+      #############
+
+      @doc """
+      Load a replay from an automation event list (or the file it was exported to) rendering to a render texture, returns the replay resource
+      """
+      @doc group: :replay_loading
+      @spec load_replay(
+              events :: tuple | binary,
+              width :: integer,
+              height :: integer,
+              fixed_fps :: non_neg_integer,
+              frame_count :: non_neg_integer,
+              checksums :: boolean,
+              seed :: non_neg_integer | nil
+            ) :: tuple
+      def load_replay(
+            _events,
+            _width,
+            _height,
+            _fixed_fps,
+            _frame_count,
+            _checksums,
+            _seed
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Go back to the first frame of the replay, the frame times and checksums are cleared
+      """
+      @doc group: :replay_loading
+      @spec rewind_replay(replay :: tuple) :: :ok
+      def rewind_replay(_replay), do: :erlang.nif_error(:undef)
+
+      ############
+      #  Frames  #
+      ############
+
+      @doc """
+      Play the events of the next frame and start drawing to the replay render texture, returns `{frame, dt}` or `:done`
+      """
+      @doc group: :replay_frames
+      @spec begin_replay_frame(replay :: tuple) :: {non_neg_integer, float} | :done
+      def begin_replay_frame(_replay), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Stop drawing to the replay render texture and record the frame, returns the frame time
+      """
+      @doc group: :replay_frames
+      @spec end_replay_frame(replay :: tuple) :: float
+      def end_replay_frame(_replay), do: :erlang.nif_error(:undef)
+
+      ###########
+      #  Stats  #
+      ###########
+
+      @doc """
+      Get the frame time stats as `{frames, events, {total, mean, min, max, stddev, p50, p90, p99}}`
+      """
+      @doc group: :replay_stats
+      @spec get_replay_stats(replay :: tuple) ::
+              {non_neg_integer, non_neg_integer,
+               {float, float, float, float, float, float, float, float}}
+      def get_replay_stats(_replay), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the frames run so far as a list of `{frame_time, checksum}`
+      """
+      @doc group: :replay_stats
+      @spec get_replay_frames(replay :: tuple) :: [{float, non_neg_integer | nil}]
+      def get_replay_frames(_replay), do: :erlang.nif_error(:undef)
+    end
+  end
+end
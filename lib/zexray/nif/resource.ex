@@ -295,7 +295,37 @@ defmodule Zexray.NIF.Resource do
         automation_event_list_to_resource: 1,
         automation_event_list_from_resource: 1,
         automation_event_list_free_resource: 1,
-        automation_event_list_update_resource: 2
+        automation_event_list_update_resource: 2,
+
+        # Scene
+        scene_free_resource: 1,
+
+        # UniformSet
+        uniform_set_free_resource: 1,
+
+        # ImageAnimStream
+        image_anim_stream_free_resource: 1,
+
+        # AssetPack
+        asset_pack_free_resource: 1,
+
+        # TextureStream
+        texture_stream_free_resource: 1,
+
+        # DisplayList
+        display_list_free_resource: 1,
+
+        # VoicePool
+        voice_pool_free_resource: 1,
+
+        # Terrain
+        terrain_free_resource: 1,
+
+        # SpriteAtlas
+        sprite_atlas_free_resource: 1,
+
+        # Replay
+        replay_free_resource: 1
       ]
 
       #############
@@ -1620,6 +1650,86 @@ defmodule Zexray.NIF.Resource do
             _value
           ),
           do: :erlang.nif_error(:undef)
+
+      ###########
+      #  Scene  #
+      ###########
+
+      @doc group: :resource
+      @spec scene_free_resource(resource :: tuple) :: :ok
+      def scene_free_resource(_resource), do: :erlang.nif_error(:undef)
+
+      ################
+      #  UniformSet  #
+      ################
+
+      @doc group: :resource
+      @spec uniform_set_free_resource(resource :: tuple) :: :ok
+      def uniform_set_free_resource(_resource), do: :erlang.nif_error(:undef)
+
+      #####################
+      #  ImageAnimStream  #
+      #####################
+
+      @doc group: :resource
+      @spec image_anim_stream_free_resource(resource :: tuple) :: :ok
+      def image_anim_stream_free_resource(_resource), do: :erlang.nif_error(:undef)
+
+      ###############
+      #  AssetPack  #
+      ###############
+
+      @doc group: :resource
+      @spec asset_pack_free_resource(resource :: tuple) :: :ok
+      def asset_pack_free_resource(_resource), do: :erlang.nif_error(:undef)
+
+      ###################
+      #  TextureStream  #
+      ###################
+
+      @doc group: :resource
+      @spec texture_stream_free_resource(resource :: tuple) :: :ok
+      def texture_stream_free_resource(_resource), do: :erlang.nif_error(:undef)
+
+      #################
+      #  DisplayList  #
+      #################
+
+      @doc group: :resource
+      @spec display_list_free_resource(resource :: tuple) :: :ok
+      def display_list_free_resource(_resource), do: :erlang.nif_error(:undef)
+
+      ###############
+      #  VoicePool  #
+      ###############
+
+      @doc group: :resource
+      @spec voice_pool_free_resource(resource :: tuple) :: :ok
+      def voice_pool_free_resource(_resource), do: :erlang.nif_error(:undef)
+
+      #############
+      #  Terrain  #
+      #############
+
+      @doc group: :resource
+      @spec terrain_free_resource(resource :: tuple) :: :ok
+      def terrain_free_resource(_resource), do: :erlang.nif_error(:undef)
+
+      #################
+      #  SpriteAtlas  #
+      #################
+
+      @doc group: :resource
+      @spec sprite_atlas_free_resource(resource :: tuple) :: :ok
+      def sprite_atlas_free_resource(_resource), do: :erlang.nif_error(:undef)
+
+      ############
+      #  Replay  #
+      ############
+
+      @doc group: :resource
+      @spec replay_free_resource(resource :: tuple) :: :ok
+      def replay_free_resource(_resource), do: :erlang.nif_error(:undef)
     end
   end
 end
@@ -0,0 +1,213 @@
+defmodule Zexray.NIF.Scene do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_scene [
+        # Scene management
+        load_scene: 0,
+        scene_clear: 1,
+        get_scene_stats: 1,
+
+        # Scene nodes
+        scene_set_node_model: 6,
+        scene_set_node_mesh: 7,
+        scene_set_node_transform: 3,
+        scene_set_node_transforms: 2,
+        scene_set_node_parent: 3,
+        scene_set_node_tint: 3,
+        scene_set_node_visible: 3,
+        scene_remove_node: 2,
+
+        # Scene drawing
+        scene_draw: 2
+      ]
+
+      ######################
+      #  Scene management  #
+      ######################
+
+      @doc """
+      Load an empty scene
+      """
+      @doc group: :scene_management
+      @spec load_scene() :: tuple
+      def load_scene(), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Remove all the nodes from the scene
+      """
+      @doc group: :scene_management
+      @spec scene_clear(scene :: tuple) :: :ok
+      def scene_clear(_scene), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the scene statistics of the last draw `{nodes, drawn, culled, draw_calls}`
+      """
+      @doc group: :scene_management
+      @spec get_scene_stats(scene :: tuple) ::
+              {non_neg_integer, non_neg_integer, non_neg_integer, non_neg_integer}
+      def get_scene_stats(_scene), do: :erlang.nif_error(:undef)
+
+      #################
+      #  Scene nodes  #
+      #################
+
+      @doc """
+      Insert or replace a node drawing a model (the model must be a resource)
+      """
+      @doc group: :scene_nodes
+      @spec scene_set_node_model(
+              scene :: tuple,
+              id :: non_neg_integer,
+              parent :: non_neg_integer | nil,
+              transform :: tuple,
+              model :: tuple,
+              tint :: tuple
+            ) :: :ok
+      def scene_set_node_model(
+            _scene,
+            _id,
+            _parent,
+            _transform,
+            _model,
+            _tint
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Insert or replace a node drawing a mesh with a material (both must be resources)
+      """
+      @doc group: :scene_nodes
+      @spec scene_set_node_mesh(
+              scene :: tuple,
+              id :: non_neg_integer,
+              parent :: non_neg_integer | nil,
+              transform :: tuple,
+              mesh :: tuple,
+              material :: tuple,
+              tint :: tuple
+            ) :: :ok
+      def scene_set_node_mesh(
+            _scene,
+            _id,
+            _parent,
+            _transform,
+            _mesh,
+            _material,
+            _tint
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Set the node local transform (relative to the parent)
+      """
+      @doc group: :scene_nodes
+      @spec scene_set_node_transform(
+              scene :: tuple,
+              id :: non_neg_integer,
+              transform :: tuple
+            ) :: boolean
+      def scene_set_node_transform(
+            _scene,
+            _id,
+            _transform
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Set the local transform of many nodes at once
+      """
+      @doc group: :scene_nodes
+      @spec scene_set_node_transforms(
+              scene :: tuple,
+              transforms :: [{non_neg_integer, tuple}]
+            ) :: non_neg_integer
+      def scene_set_node_transforms(
+            _scene,
+            _transforms
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Set the node parent (nil for a root node)
+      """
+      @doc group: :scene_nodes
+      @spec scene_set_node_parent(
+              scene :: tuple,
+              id :: non_neg_integer,
+              parent :: non_neg_integer | nil
+            ) :: boolean
+      def scene_set_node_parent(
+            _scene,
+            _id,
+            _parent
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Set the node tint
+      """
+      @doc group: :scene_nodes
+      @spec scene_set_node_tint(
+              scene :: tuple,
+              id :: non_neg_integer,
+              tint :: tuple
+            ) :: boolean
+      def scene_set_node_tint(
+            _scene,
+            _id,
+            _tint
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Set the node visibility (hidden nodes hide their children)
+      """
+      @doc group: :scene_nodes
+      @spec scene_set_node_visible(
+              scene :: tuple,
+              id :: non_neg_integer,
+              visible :: boolean
+            ) :: boolean
+      def scene_set_node_visible(
+            _scene,
+            _id,
+            _visible
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Remove a node from the scene (the children become root nodes)
+      """
+      @doc group: :scene_nodes
+      @spec scene_remove_node(
+              scene :: tuple,
+              id :: non_neg_integer
+            ) :: boolean
+      def scene_remove_node(
+            _scene,
+            _id
+          ),
+          do: :erlang.nif_error(:undef)
+
+      ###################
+      #  Scene drawing  #
+      ###################
+
+      @doc """
+      Draw the visible nodes of the scene (frustum culled and sorted by material)
+      """
+      @doc group: :scene_drawing
+      @spec scene_draw(
+              scene :: tuple,
+              camera :: tuple
+            ) :: :ok
+      def scene_draw(
+            _scene,
+            _camera
+          ),
+          do: :erlang.nif_error(:undef)
+    end
+  end
+end
@@ -15,7 +15,17 @@ defmodule Zexray.NIF.Shader do
         set_shader_value: 4,
         set_shader_value_v: 4,
         set_shader_value_matrix: 3,
-        set_shader_value_texture: 3
+        set_shader_value_texture: 3,
+
+        # Uniform set
+        load_uniform_set: 2,
+        load_uniform_set: 3,
+        get_uniform_set_layout: 1,
+        update_uniform_set: 2,
+        set_uniform_set_values: 2,
+        apply_uniform_set: 1,
+        invalidate_uniform_set: 1,
+        get_uniform_set_stats: 1
       ]
 
       ############
@@ -201,6 +211,90 @@ defmodule Zexray.NIF.Shader do
             _texture
           ),
           do: :erlang.nif_error(:undef)
+
+      #################
+      #  Uniform set  #
+      #################
+
+      @doc """
+      Load a uniform set for the shader, resolving the uniform locations once
+
+      The uniforms are a list of `{name, uniform_type}` or `{name, uniform_type, count}`,
+      `uniform_type` is a shader uniform data type or `:matrix`.
+
+      If `binding` is set, the values are uploaded as one shader buffer bound to this index
+      (requires OpenGL 4.3, falls back to uniforms otherwise).
+      """
+      @doc group: :uniform_set
+      @spec load_uniform_set(
+              shader :: tuple,
+              uniforms :: [{binary | atom, integer | :matrix} | {binary | atom, integer | :matrix, pos_integer}],
+              binding :: non_neg_integer | nil
+            ) :: tuple
+      def load_uniform_set(
+            _shader,
+            _uniforms,
+            _binding \\ nil
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the uniform set layout, list of `{name, location, offset, size}` in the staging buffer order
+      """
+      @doc group: :uniform_set
+      @spec get_uniform_set_layout(uniform_set :: tuple) :: [
+              {binary, integer, non_neg_integer, non_neg_integer}
+            ]
+      def get_uniform_set_layout(_uniform_set), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Replace all the uniform values from a packed binary (staging buffer layout)
+      """
+      @doc group: :uniform_set
+      @spec update_uniform_set(
+              uniform_set :: tuple,
+              data :: binary
+            ) :: :ok
+      def update_uniform_set(
+            _uniform_set,
+            _data
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Set uniform values from a map or a keyword list of name => value
+      """
+      @doc group: :uniform_set
+      @spec set_uniform_set_values(
+              uniform_set :: tuple,
+              values :: map | keyword
+            ) :: :ok
+      def set_uniform_set_values(
+            _uniform_set,
+            _values
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Upload the dirty uniforms of the set to its shader, returns the number of uniforms uploaded
+      """
+      @doc group: :uniform_set
+      @spec apply_uniform_set(uniform_set :: tuple) :: non_neg_integer
+      def apply_uniform_set(_uniform_set), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Mark all the uniforms of the set dirty
+      """
+      @doc group: :uniform_set
+      @spec invalidate_uniform_set(uniform_set :: tuple) :: :ok
+      def invalidate_uniform_set(_uniform_set), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the uniform set statistics as `{uploads, skipped}`
+      """
+      @doc group: :uniform_set
+      @spec get_uniform_set_stats(uniform_set :: tuple) :: {non_neg_integer, non_neg_integer}
+      def get_uniform_set_stats(_uniform_set), do: :erlang.nif_error(:undef)
     end
   end
 end
@@ -0,0 +1,105 @@
+defmodule Zexray.NIF.SpriteAtlas do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_sprite_atlas [
+        # Loading
+        load_sprite_atlas: 5,
+        get_sprite_atlas_info: 1,
+        get_sprite_rec: 2,
+        get_sprite_rec: 3,
+
+        # Drawing
+        draw_sprite: 7,
+        draw_sprites: 2
+      ]
+
+      #############
+      #  Loading  #
+      #############
+
+      @doc """
+      Pack images in one texture, returns `{atlas, sprites}` with the source rectangle of each sprite (the id is the index)
+      """
+      @doc group: :sprite_atlas_loading
+      @spec load_sprite_atlas(
+              images :: [tuple],
+              padding :: non_neg_integer,
+              max_size :: pos_integer,
+              mipmaps :: boolean,
+              filter :: integer
+            ) :: {tuple, [tuple]}
+      def load_sprite_atlas(
+            _images,
+            _padding,
+            _max_size,
+            _mipmaps,
+            _filter
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the sprite atlas info as `{width, height, sprites, mipmaps, occupancy}`
+      """
+      @doc group: :sprite_atlas_loading
+      @spec get_sprite_atlas_info(atlas :: tuple) ::
+              {integer, integer, non_neg_integer, integer, float}
+      def get_sprite_atlas_info(_atlas), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the source rectangle of a sprite in the atlas texture
+      """
+      @doc group: :sprite_atlas_loading
+      @spec get_sprite_rec(
+              atlas :: tuple,
+              id :: non_neg_integer,
+              return :: :auto | :value | :resource
+            ) :: tuple
+      def get_sprite_rec(
+            _atlas,
+            _id,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+
+      #############
+      #  Drawing  #
+      #############
+
+      @doc """
+      Draw a sprite of the atlas, origin and rotation as in `draw_texture_pro`
+      """
+      @doc group: :sprite_atlas_drawing
+      @spec draw_sprite(
+              atlas :: tuple,
+              id :: non_neg_integer,
+              position :: tuple,
+              origin :: tuple,
+              rotation :: number,
+              scale :: number,
+              tint :: tuple
+            ) :: :ok
+      def draw_sprite(
+            _atlas,
+            _id,
+            _position,
+            _origin,
+            _rotation,
+            _scale,
+            _tint
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Draw many sprites of the atlas in one call, each sprite is `{id, x, y, rotation, scale, tint}`
+      """
+      @doc group: :sprite_atlas_drawing
+      @spec draw_sprites(
+              atlas :: tuple,
+              sprites :: [{non_neg_integer, number, number, number, number, tuple}]
+            ) :: :ok
+      def draw_sprites(_atlas, _sprites), do: :erlang.nif_error(:undef)
+    end
+  end
+end
@@ -0,0 +1,106 @@
+defmodule Zexray.NIF.Terrain do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_terrain [
+        # Loading
+        load_terrain: 6,
+
+        # Drawing
+        draw_terrain: 4,
+        get_terrain_stats: 1,
+
+        # Queries
+        get_terrain_height: 3,
+        get_terrain_normal: 3,
+        get_terrain_normal: 4
+      ]
+
+      #############
+      #  Loading  #
+      #############
+
+      @doc """
+      Load a terrain from a heightmap split in chunks with several levels of detail, returns the terrain resource
+      """
+      @doc group: :terrain_loading
+      @spec load_terrain(
+              heightmap :: tuple,
+              size :: tuple,
+              position :: tuple,
+              chunk_size :: pos_integer,
+              lod_levels :: pos_integer,
+              skirt_depth :: number
+            ) :: tuple
+      def load_terrain(
+            _heightmap,
+            _size,
+            _position,
+            _chunk_size,
+            _lod_levels,
+            _skirt_depth
+          ),
+          do: :erlang.nif_error(:undef)
+
+      #############
+      #  Drawing  #
+      #############
+
+      @doc """
+      Draw the visible chunks of a terrain with a material (`nil` for the default one)
+      """
+      @doc group: :terrain_drawing
+      @spec draw_terrain(
+              terrain :: tuple,
+              camera :: tuple,
+              material :: tuple | nil,
+              lod_distance :: number
+            ) :: :ok
+      def draw_terrain(
+            _terrain,
+            _camera,
+            _material,
+            _lod_distance
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the terrain statistics of the last draw as `{chunks, drawn, culled, triangles}`
+      """
+      @doc group: :terrain_drawing
+      @spec get_terrain_stats(terrain :: tuple) ::
+              {non_neg_integer, non_neg_integer, non_neg_integer, non_neg_integer}
+      def get_terrain_stats(_terrain), do: :erlang.nif_error(:undef)
+
+      #############
+      #  Queries  #
+      #############
+
+      @doc """
+      Get the terrain height at a world position
+      """
+      @doc group: :terrain_queries
+      @spec get_terrain_height(terrain :: tuple, x :: number, z :: number) :: float
+      def get_terrain_height(_terrain, _x, _z), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the terrain normal at a world position
+      """
+      @doc group: :terrain_queries
+      @spec get_terrain_normal(
+              terrain :: tuple,
+              x :: number,
+              z :: number,
+              return :: :auto | :value | :resource
+            ) :: tuple
+      def get_terrain_normal(
+            _terrain,
+            _x,
+            _z,
+            _return \\ :auto
+          ),
+          do: :erlang.nif_error(:undef)
+    end
+  end
+end
@@ -18,6 +18,13 @@ defmodule Zexray.NIF.Texture do
         update_texture: 2,
         update_texture_rec: 3,
 
+        # Texture streaming
+        load_texture_stream: 3,
+        load_texture_stream: 4,
+        update_texture_stream: 2,
+        get_texture_stream_texture: 1,
+        get_texture_stream_stats: 1,
+
         # Texture configuration
         gen_texture_mipmaps: 1,
         gen_texture_mipmaps: 2,
@@ -181,6 +188,58 @@ defmodule Zexray.NIF.Texture do
           ),
           do: :erlang.nif_error(:undef)
 
+      #######################
+      #  Texture streaming  #
+      #######################
+
+      @doc """
+      Load a texture updated every frame through a ring of pixel buffers (3 by default, up to 8)
+      """
+      @doc group: :texture_streaming
+      @spec load_texture_stream(
+              width :: integer,
+              height :: integer,
+              format :: integer,
+              buffers :: pos_integer
+            ) :: tuple
+      def load_texture_stream(
+            _width,
+            _height,
+            _format,
+            _buffers \\ 3
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Upload a frame to the texture stream, returns false if the frame was dropped (all the pixel buffers in use)
+      """
+      @doc group: :texture_streaming
+      @spec update_texture_stream(
+              stream :: tuple,
+              pixels :: binary
+            ) :: boolean
+      def update_texture_stream(
+            _stream,
+            _pixels
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the texture of the texture stream (owned by the stream, it must not be unloaded)
+      """
+      @doc group: :texture_streaming
+      @spec get_texture_stream_texture(stream :: tuple) :: tuple
+      def get_texture_stream_texture(_stream), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Get the texture stream statistics `{mode, uploaded, dropped, last_latency_us, average_latency_us}`
+      """
+      @doc group: :texture_streaming
+      @spec get_texture_stream_stats(stream :: tuple) ::
+              {:persistent | :mapped | :direct, non_neg_integer, non_neg_integer,
+               non_neg_integer, non_neg_integer}
+      def get_texture_stream_stats(_stream), do: :erlang.nif_error(:undef)
+
       ###########################
       #  Texture configuration  #
       ###########################
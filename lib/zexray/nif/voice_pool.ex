@@ -0,0 +1,107 @@
+defmodule Zexray.NIF.VoicePool do
+  @moduledoc false
+
+  defmacro __using__(_opts) do
+    quote do
+      @nifs_voice_pool [
+        # Loading
+        load_voice_pool: 2,
+
+        # Playing
+        play_voice: 6,
+        play_voice_3d: 6,
+        stop_voice_pool: 1,
+
+        # Stats
+        get_voice_pool_stats: 1,
+        reset_voice_pool_stats: 1
+      ]
+
+      #############
+      #  Loading  #
+      #############
+
+      @doc """
+      Load a pool of voices created as aliases of a sound, returns the voice pool resource
+      """
+      @doc group: :voice_pool_loading
+      @spec load_voice_pool(sound :: tuple, voices :: pos_integer) :: tuple
+      def load_voice_pool(_sound, _voices), do: :erlang.nif_error(:undef)
+
+      #############
+      #  Playing  #
+      #############
+
+      @doc """
+      Play a sound on a voice of the pool, returns the voice index or `nil` when dropped
+      """
+      @doc group: :voice_pool_playing
+      @spec play_voice(
+              pool :: tuple,
+              sound :: tuple,
+              volume :: float,
+              pitch :: float,
+              pan :: float,
+              priority :: integer
+            ) :: non_neg_integer | nil
+      def play_voice(
+            _pool,
+            _sound,
+            _volume,
+            _pitch,
+            _pan,
+            _priority
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Play a sound at a position on a voice of the pool, attenuated and panned for the audio 3D mode listener
+      """
+      @doc group: :voice_pool_playing
+      @spec play_voice_3d(
+              pool :: tuple,
+              sound :: tuple,
+              position :: tuple,
+              volume :: float,
+              pitch :: float,
+              priority :: integer
+            ) :: non_neg_integer | nil
+      def play_voice_3d(
+            _pool,
+            _sound,
+            _position,
+            _volume,
+            _pitch,
+            _priority
+          ),
+          do: :erlang.nif_error(:undef)
+
+      @doc """
+      Stop all the voices of the pool
+      """
+      @doc group: :voice_pool_playing
+      @spec stop_voice_pool(pool :: tuple) :: :ok
+      def stop_voice_pool(_pool), do: :erlang.nif_error(:undef)
+
+      ###########
+      #  Stats  #
+      ###########
+
+      @doc """
+      Get the voice pool counters as `{voices, active, played, stolen, dropped, culled}`
+      """
+      @doc group: :voice_pool_stats
+      @spec get_voice_pool_stats(pool :: tuple) ::
+              {non_neg_integer, non_neg_integer, non_neg_integer, non_neg_integer,
+               non_neg_integer, non_neg_integer}
+      def get_voice_pool_stats(_pool), do: :erlang.nif_error(:undef)
+
+      @doc """
+      Restart the played, stolen, dropped and culled counters
+      """
+      @doc group: :voice_pool_stats
+      @spec reset_voice_pool_stats(pool :: tuple) :: :ok
+      def reset_voice_pool_stats(_pool), do: :erlang.nif_error(:undef)
+    end
+  end
+end
@@ -0,0 +1,112 @@
+defmodule Zexray.Noise do
+  @moduledoc """
+  Procedural noise
+
+  Fields are evaluated natively with SIMD (8 points per step), split by rows across
+  the worker pool.
+
+  ## Options
+
+  - `:kind` - `:perlin` (default), `:simplex`, `:value` or `:cellular` (distance to the
+    nearest feature point)
+  - `:fractal` - `:none` (default), `:fbm`, `:ridged` or `:turbulence`
+  - `:dimensions` - `2` (default) or `3`, a 2D field with 3 dimensions is a slice of 3D
+    noise at `offset` z (fields with a depth greater than 1 always use 3D noise)
+  - `:seed` - default `0`
+  - `:frequency` - noise cycles per pixel, default `1 / 32`
+  - `:octaves` - fractal octaves (1 to 16), default `4`
+  - `:lacunarity` - frequency multiplier per octave, default `2.0`
+  - `:gain` - amplitude multiplier per octave, default `0.5`
+  - `:warp_amplitude` - domain warping displacement in pixels, default `0.0` (disabled)
+  - `:warp_frequency` - domain warping noise frequency, default `1 / 64`
+  - `:offset` - `{x, y, z}` added to the position (in pixels) before sampling, default `{0, 0, 0}`
+
+  The noise is evaluated at `(position + offset) * frequency`, the values are in [-1, 1].
+  """
+
+  alias Zexray.NIF
+
+  @type kind :: :perlin | :simplex | :value | :cellular
+  @type fractal :: :none | :fbm | :ridged | :turbulence
+
+  @type option ::
+          {:kind, kind}
+          | {:fractal, fractal}
+          | {:dimensions, 2 | 3}
+          | {:seed, non_neg_integer}
+          | {:frequency, number}
+          | {:octaves, pos_integer}
+          | {:lacunarity, number}
+          | {:gain, number}
+          | {:warp_amplitude, number}
+          | {:warp_frequency, number}
+          | {:offset, {number, number, number}}
+
+  ######################
+  #  Noise generation  #
+  ######################
+
+  @doc """
+  Generate a noise field as a binary of packed native endian f32 values in [-1, 1]
+
+  The values are ordered by x, then y, then z.
+  """
+  @spec gen_field(
+          width :: pos_integer,
+          height :: pos_integer,
+          depth :: pos_integer,
+          opts :: [option]
+        ) :: binary
+  def gen_field(width, height, depth \\ 1, opts \\ []) do
+    NIF.gen_noise_field(width, height, depth, params(opts))
+  end
+
+  @doc """
+  Generate a grayscale image of a noise field, black at -1 and white at 1
+  """
+  @spec gen_image(
+          width :: pos_integer,
+          height :: pos_integer,
+          opts :: [option],
+          return :: :auto | :value | :resource
+        ) :: Zexray.Type.Image.t_nif()
+  def gen_image(width, height, opts \\ [], return \\ :auto) do
+    NIF.gen_image_noise(width, height, params(opts), return)
+  end
+
+  @doc """
+  Generate a heightmap mesh from a noise field without building the image in Elixir
+
+  NOTE: raylib samples the heightmap with 8 bits of precision
+  """
+  @spec gen_mesh_heightmap(
+          width :: pos_integer,
+          height :: pos_integer,
+          size :: Zexray.Type.Vector3.t_all(),
+          opts :: [option],
+          return :: :auto | :value | :resource
+        ) :: Zexray.Type.Mesh.t_nif()
+  def gen_mesh_heightmap(width, height, size, opts \\ [], return \\ :auto) do
+    NIF.gen_mesh_heightmap_noise(width, height, params(opts), size, return)
+  end
+
+  defp params(opts) do
+    {offset_x, offset_y, offset_z} = Keyword.get(opts, :offset, {0.0, 0.0, 0.0})
+
+    {
+      Keyword.get(opts, :kind, :perlin),
+      Keyword.get(opts, :fractal, :none),
+      Keyword.get(opts, :dimensions, 2),
+      Keyword.get(opts, :seed, 0),
+      Keyword.get(opts, :frequency, 1 / 32),
+      Keyword.get(opts, :octaves, 4),
+      Keyword.get(opts, :lacunarity, 2.0),
+      Keyword.get(opts, :gain, 0.5),
+      Keyword.get(opts, :warp_amplitude, 0.0),
+      Keyword.get(opts, :warp_frequency, 1 / 64),
+      offset_x,
+      offset_y,
+      offset_z
+    }
+  end
+end
@@ -0,0 +1,161 @@
+defmodule Zexray.Replay do
+  @moduledoc """
+  Automation event replay
+
+  Plays a recorded automation event list back into the input state frame by
+  frame, as fast as possible: the frames render to an offscreen render texture,
+  the screen buffer is never swapped and nothing waits for vsync. Each frame gets
+  the same fixed timestep, the game logic sees the same input on the same frame
+  on every run. The window events are still polled, but the live input is
+  replaced by the replay one.
+
+  Each frame is timed from `begin_frame/1` to `end_frame/1`. With `:checksums`
+  the pixels of the render texture are hashed at the end of each frame, which
+  also waits for the GPU (the frame times then include the rendering).
+
+  ```elixir
+  replay = Zexray.Replay.load("session.rae", 1280, 720, checksums: true, seed: 42)
+
+  stats =
+    Zexray.Replay.run(replay, fn _frame, dt ->
+      game = Game.update(game, dt)
+      Game.draw(game)
+    end)
+  ```
+
+  The window must be initialized, it can be hidden (`:window_hidden` flag) and
+  run under a virtual display for headless runs.
+  """
+
+  alias Zexray.NIF
+
+  @type stats :: %{
+          frames: non_neg_integer,
+          events: non_neg_integer,
+          total: float,
+          mean: float,
+          min: float,
+          max: float,
+          stddev: float,
+          p50: float,
+          p90: float,
+          p99: float
+        }
+
+  #############
+  #  Loading  #
+  #############
+
+  @doc """
+  Load a replay of an automation event list, or of the file it was exported to
+
+  ## Options
+
+  - `:fixed_fps` - fixed timestep given to each frame (default `60`)
+  - `:frame_count` - frames to run, `0` to stop after the frame of the last event (default `0`)
+  - `:checksums` - hash the render texture at the end of each frame (default `false`)
+  - `:seed` - random seed set when the replay starts or rewinds (default `nil`, unchanged)
+  """
+  @spec load(
+          events :: Zexray.Type.AutomationEventList.t_all() | binary,
+          width :: integer,
+          height :: integer,
+          opts :: [
+            {:fixed_fps, non_neg_integer}
+            | {:frame_count, non_neg_integer}
+            | {:checksums, boolean}
+            | {:seed, non_neg_integer | nil}
+          ]
+        ) :: Zexray.Type.Replay.t_resource()
+  def load(events, width, height, opts \\ []) do
+    NIF.load_replay(
+      events,
+      width,
+      height,
+      Keyword.get(opts, :fixed_fps, 60),
+      Keyword.get(opts, :frame_count, 0),
+      Keyword.get(opts, :checksums, false),
+      Keyword.get(opts, :seed, nil)
+    )
+  end
+
+  @doc """
+  Go back to the first frame, the frame times and checksums are cleared
+  """
+  @spec rewind(replay :: Zexray.Type.Replay.t_resource()) :: :ok
+  defdelegate rewind(replay), to: NIF, as: :rewind_replay
+
+  ############
+  #  Frames  #
+  ############
+
+  @doc """
+  Play the events of the next frame and start drawing to the replay render texture,
+  returns `{frame, dt}` or `:done` when all the frames have run
+
+  Replaces `Zexray.Drawing.begin_drawing/0`
+  """
+  @spec begin_frame(replay :: Zexray.Type.Replay.t_resource()) ::
+          {non_neg_integer, float} | :done
+  defdelegate begin_frame(replay), to: NIF, as: :begin_replay_frame
+
+  @doc """
+  Stop drawing to the replay render texture and record the frame, returns the frame time (in seconds)
+
+  Replaces `Zexray.Drawing.end_drawing/0`
+  """
+  @spec end_frame(replay :: Zexray.Type.Replay.t_resource()) :: float
+  defdelegate end_frame(replay), to: NIF, as: :end_replay_frame
+
+  @doc """
+  Run all the frames left, calling `fun.(frame, dt)` between `begin_frame/1` and `end_frame/1`,
+  returns the stats
+  """
+  @spec run(
+          replay :: Zexray.Type.Replay.t_resource(),
+          fun :: (non_neg_integer, float -> any)
+        ) :: stats()
+  def run(replay, fun) do
+    case begin_frame(replay) do
+      :done ->
+        stats(replay)
+
+      {frame, dt} ->
+        fun.(frame, dt)
+        end_frame(replay)
+        run(replay, fun)
+    end
+  end
+
+  ###########
+  #  Stats  #
+  ###########
+
+  @doc """
+  Get the frame time stats of the frames run so far (in seconds)
+  """
+  @spec stats(replay :: Zexray.Type.Replay.t_resource()) :: stats()
+  def stats(replay) do
+    {frames, events, {total, mean, min, max, stddev, p50, p90, p99}} =
+      NIF.get_replay_stats(replay)
+
+    %{
+      frames: frames,
+      events: events,
+      total: total,
+      mean: mean,
+      min: min,
+      max: max,
+      stddev: stddev,
+      p50: p50,
+      p90: p90,
+      p99: p99
+    }
+  end
+
+  @doc """
+  Get the frames run so far as a list of `{frame_time, checksum}` (`nil` checksums without `:checksums`)
+  """
+  @spec frames(replay :: Zexray.Type.Replay.t_resource()) :: [{float, non_neg_integer | nil}]
+  defdelegate frames(replay), to: NIF, as: :get_replay_frames
+end
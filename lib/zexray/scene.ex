@@ -0,0 +1,218 @@
+defmodule Zexray.Scene do
+  @moduledoc """
+  Scene
+
+  Retained scene graph drawn natively: the nodes are frustum culled against
+  the camera and sorted by material (shader and diffuse texture) before drawing.
+
+  Models, meshes and materials attached to nodes must be resources,
+  they are kept alive by the scene until the node is replaced or removed.
+  """
+
+  alias Zexray.NIF
+
+  ######################
+  #  Scene management  #
+  ######################
+
+  @doc """
+  Load an empty scene
+  """
+  @doc group: :scene_management
+  @spec load() :: Zexray.Type.Scene.t_resource()
+  defdelegate load(), to: NIF, as: :load_scene
+
+  @doc """
+  Remove all the nodes from the scene
+  """
+  @doc group: :scene_management
+  @spec clear(scene :: Zexray.Type.Scene.t_resource()) :: :ok
+  defdelegate clear(scene), to: NIF, as: :scene_clear
+
+  @doc """
+  Get the scene statistics of the last draw
+  """
+  @doc group: :scene_management
+  @spec stats(scene :: Zexray.Type.Scene.t_resource()) :: %{
+          nodes: non_neg_integer,
+          drawn: non_neg_integer,
+          culled: non_neg_integer,
+          draw_calls: non_neg_integer
+        }
+  def stats(scene) do
+    {nodes, drawn, culled, draw_calls} = NIF.get_scene_stats(scene)
+
+    %{nodes: nodes, drawn: drawn, culled: culled, draw_calls: draw_calls}
+  end
+
+  #################
+  #  Scene nodes  #
+  #################
+
+  @doc """
+  Insert or replace a node drawing a model
+  """
+  @doc group: :scene_nodes
+  @spec set_node_model(
+          scene :: Zexray.Type.Scene.t_resource(),
+          id :: non_neg_integer,
+          parent :: non_neg_integer | nil,
+          transform :: Zexray.Type.Matrix.t_all(),
+          model :: Zexray.Type.Model.t_resource(),
+          tint :: Zexray.Type.Color.t_all()
+        ) :: :ok
+  defdelegate set_node_model(
+                scene,
+                id,
+                parent,
+                transform,
+                model,
+                tint
+              ),
+              to: NIF,
+              as: :scene_set_node_model
+
+  @doc """
+  Insert or replace a node drawing a mesh with a material
+  """
+  @doc group: :scene_nodes
+  @spec set_node_mesh(
+          scene :: Zexray.Type.Scene.t_resource(),
+          id :: non_neg_integer,
+          parent :: non_neg_integer | nil,
+          transform :: Zexray.Type.Matrix.t_all(),
+          mesh :: Zexray.Type.Mesh.t_resource(),
+          material :: Zexray.Type.Material.t_resource(),
+          tint :: Zexray.Type.Color.t_all()
+        ) :: :ok
+  defdelegate set_node_mesh(
+                scene,
+                id,
+                parent,
+                transform,
+                mesh,
+                material,
+                tint
+              ),
+              to: NIF,
+              as: :scene_set_node_mesh
+
+  @doc """
+  Set the node local transform (relative to the parent)
+  """
+  @doc group: :scene_nodes
+  @spec set_node_transform(
+          scene :: Zexray.Type.Scene.t_resource(),
+          id :: non_neg_integer,
+          transform :: Zexray.Type.Matrix.t_all()
+        ) :: boolean
+  defdelegate set_node_transform(
+                scene,
+                id,
+                transform
+              ),
+              to: NIF,
+              as: :scene_set_node_transform
+
+  @doc """
+  Set the local transform of many nodes at once, returns the number of nodes updated
+  """
+  @doc group: :scene_nodes
+  @spec set_node_transforms(
+          scene :: Zexray.Type.Scene.t_resource(),
+          transforms :: [{non_neg_integer, Zexray.Type.Matrix.t_all()}]
+        ) :: non_neg_integer
+  defdelegate set_node_transforms(
+                scene,
+                transforms
+              ),
+              to: NIF,
+              as: :scene_set_node_transforms
+
+  @doc """
+  Set the node parent (nil for a root node)
+  """
+  @doc group: :scene_nodes
+  @spec set_node_parent(
+          scene :: Zexray.Type.Scene.t_resource(),
+          id :: non_neg_integer,
+          parent :: non_neg_integer | nil
+        ) :: boolean
+  defdelegate set_node_parent(
+                scene,
+                id,
+                parent
+              ),
+              to: NIF,
+              as: :scene_set_node_parent
+
+  @doc """
+  Set the node tint
+  """
+  @doc group: :scene_nodes
+  @spec set_node_tint(
+          scene :: Zexray.Type.Scene.t_resource(),
+          id :: non_neg_integer,
+          tint :: Zexray.Type.Color.t_all()
+        ) :: boolean
+  defdelegate set_node_tint(
+                scene,
+                id,
+                tint
+              ),
+              to: NIF,
+              as: :scene_set_node_tint
+
+  @doc """
+  Set the node visibility (hidden nodes hide their children)
+  """
+  @doc group: :scene_nodes
+  @spec set_node_visible(
+          scene :: Zexray.Type.Scene.t_resource(),
+          id :: non_neg_integer,
+          visible :: boolean
+        ) :: boolean
+  defdelegate set_node_visible(
+                scene,
+                id,
+                visible
+              ),
+              to: NIF,
+              as: :scene_set_node_visible
+
+  @doc """
+  Remove a node from the scene (the children become root nodes)
+  """
+  @doc group: :scene_nodes
+  @spec remove_node(
+          scene :: Zexray.Type.Scene.t_resource(),
+          id :: non_neg_integer
+        ) :: boolean
+  defdelegate remove_node(
+                scene,
+                id
+              ),
+              to: NIF,
+              as: :scene_remove_node
+
+  ###################
+  #  Scene drawing  #
+  ###################
+
+  @doc """
+  Draw the visible nodes of the scene
+
+  Must be called inside `Zexray.Drawing.begin_mode_3d/1` with the same camera
+  """
+  @doc group: :scene_drawing
+  @spec draw(
+          scene :: Zexray.Type.Scene.t_resource(),
+          camera :: Zexray.Type.Camera3D.t_all()
+        ) :: :ok
+  defdelegate draw(
+                scene,
+                camera
+              ),
+              to: NIF,
+              as: :scene_draw
+end
@@ -164,4 +164,100 @@ defmodule Zexray.Shader do
               ),
               to: NIF,
               as: :set_shader_value_texture
+
+  #################
+  #  Uniform set  #
+  #################
+
+  @doc """
+  Load a uniform set for the shader, resolving the uniform locations once
+
+  The uniforms are a list of `{name, uniform_type}` or `{name, uniform_type, count}`,
+  `uniform_type` is a `Zexray.Enum.ShaderUniformDataType` value or `:matrix`.
+  The values are kept in one packed staging buffer, only the uniforms that changed
+  are uploaded by `apply_uniform_set/1` or `Zexray.Drawing.begin_shader_mode/2`.
+
+  If `binding` is set, the staging buffer is uploaded as one shader buffer bound to this index
+  (requires OpenGL 4.3, falls back to uniforms otherwise). The staging buffer then follows the
+  std430 layout of the shader buffer block: `vec3` values are aligned (and strided in arrays) as `vec4`.
+  """
+  @spec load_uniform_set(
+          shader :: Zexray.Type.Shader.t_all(),
+          uniforms :: [
+            {binary | atom, integer | :matrix} | {binary | atom, integer | :matrix, pos_integer}
+          ],
+          binding :: non_neg_integer | nil
+        ) :: Zexray.Type.UniformSet.t_resource()
+  defdelegate load_uniform_set(
+                shader,
+                uniforms,
+                binding \\ nil
+              ),
+              to: NIF,
+              as: :load_uniform_set
+
+  @doc """
+  Get the uniform set layout, list of `{name, location, offset, size}` in the staging buffer order
+
+  The offsets and sizes include the std430 padding when the set uses a shader buffer
+  """
+  @spec get_uniform_set_layout(uniform_set :: Zexray.Type.UniformSet.t_resource()) :: [
+          {binary, integer, non_neg_integer, non_neg_integer}
+        ]
+  defdelegate get_uniform_set_layout(uniform_set), to: NIF, as: :get_uniform_set_layout
+
+  @doc """
+  Replace all the uniform values from a packed binary (staging buffer layout, native endianness)
+  """
+  @spec update_uniform_set(
+          uniform_set :: Zexray.Type.UniformSet.t_resource(),
+          data :: binary
+        ) :: :ok
+  defdelegate update_uniform_set(
+                uniform_set,
+                data
+              ),
+              to: NIF,
+              as: :update_uniform_set
+
+  @doc """
+  Set uniform values from a map or a keyword list of name => value
+
+  A value is a binary, a number, a vector/matrix record or a list of them
+  """
+  @spec set_uniform_set_values(
+          uniform_set :: Zexray.Type.UniformSet.t_resource(),
+          values :: map | keyword
+        ) :: :ok
+  defdelegate set_uniform_set_values(
+                uniform_set,
+                values
+              ),
+              to: NIF,
+              as: :set_uniform_set_values
+
+  @doc """
+  Upload the dirty uniforms of the set to its shader, returns the number of uniforms uploaded
+  """
+  @spec apply_uniform_set(uniform_set :: Zexray.Type.UniformSet.t_resource()) :: non_neg_integer
+  defdelegate apply_uniform_set(uniform_set), to: NIF, as: :apply_uniform_set
+
+  @doc """
+  Mark all the uniforms of the set dirty (after the shader values were changed elsewhere)
+  """
+  @spec invalidate_uniform_set(uniform_set :: Zexray.Type.UniformSet.t_resource()) :: :ok
+  defdelegate invalidate_uniform_set(uniform_set), to: NIF, as: :invalidate_uniform_set
+
+  @doc """
+  Get the uniform set statistics: uniforms uploaded and uniforms skipped because they were clean
+  """
+  @spec get_uniform_set_stats(uniform_set :: Zexray.Type.UniformSet.t_resource()) :: %{
+          uploads: non_neg_integer,
+          skipped: non_neg_integer
+        }
+  def get_uniform_set_stats(uniform_set) do
+    {uploads, skipped} = NIF.get_uniform_set_stats(uniform_set)
+
+    %{uploads: uploads, skipped: skipped}
+  end
 end
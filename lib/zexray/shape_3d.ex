@@ -437,6 +437,8 @@ defmodule Zexray.Shape3D do
 
   @doc """
   Load model from generated mesh (default material)
+
+  The model gets its own copy of the mesh (uploaded again), the mesh is not shared
   """
   @doc group: :model_management
   @spec load_model_from_mesh(
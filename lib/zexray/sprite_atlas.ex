@@ -0,0 +1,144 @@
+defmodule Zexray.SpriteAtlas do
+  @moduledoc """
+  Sprite atlas
+
+  Many images packed at runtime in one texture (MaxRects packer, best short side
+  fit) in the smallest power of 2 size that fits. Each sprite is addressed by its
+  id, the index of its image in the list given to `load/2`.
+
+  Sprites of the same atlas share the texture, drawing them one after the other
+  keeps the rlgl batch going instead of flushing it on every texture change.
+
+  ```elixir
+  {atlas, _sprites} = Zexray.SpriteAtlas.load([player, enemy, coin], padding: 2)
+
+  Zexray.SpriteAtlas.draw_batch(atlas, [
+    {0, 100.0, 200.0, 0.0, 1.0, enum_color(:white)},
+    {2, 300.0, 200.0, 45.0, 2.0, enum_color(:gold)}
+  ])
+  ```
+
+  The padding around each sprite repeats its edge pixels, filtered or mipmapped
+  sprites do not bleed into their neighbours.
+  """
+
+  alias Zexray.NIF
+
+  @type info :: %{
+          width: integer,
+          height: integer,
+          sprites: non_neg_integer,
+          mipmaps: integer,
+          occupancy: float
+        }
+
+  #############
+  #  Loading  #
+  #############
+
+  @doc """
+  Pack images in one texture, returns the atlas and the source rectangle of each sprite
+
+  ## Options
+
+  - `:padding` - pixels around each sprite, filled with its edge pixels (default `2`),
+    at most half of `:max_size`
+  - `:max_size` - atlas side at most, a power of 2 (default `4096`)
+  - `:mipmaps` - generate the mipmaps of the atlas (default `false`)
+  - `:filter` - texture filter (default `:point`)
+  """
+  @spec load(
+          images :: [Zexray.Type.Image.t_all()],
+          opts :: [
+            {:padding, non_neg_integer}
+            | {:max_size, pos_integer}
+            | {:mipmaps, boolean}
+            | {:filter, Zexray.Enum.TextureFilter.t()}
+          ]
+        ) :: {Zexray.Type.SpriteAtlas.t_resource(), [Zexray.Type.Rectangle.t_nif()]}
+  def load(images, opts \\ []) do
+    NIF.load_sprite_atlas(
+      images,
+      Keyword.get(opts, :padding, 2),
+      Keyword.get(opts, :max_size, 4096),
+      Keyword.get(opts, :mipmaps, false),
+      Zexray.Enum.TextureFilter.value(Keyword.get(opts, :filter, :point))
+    )
+  end
+
+  @doc """
+  Get the sprite atlas info
+  """
+  @spec info(atlas :: Zexray.Type.SpriteAtlas.t_resource()) :: info()
+  def info(atlas) do
+    {width, height, sprites, mipmaps, occupancy} = NIF.get_sprite_atlas_info(atlas)
+
+    %{width: width, height: height, sprites: sprites, mipmaps: mipmaps, occupancy: occupancy}
+  end
+
+  @doc """
+  Get the source rectangle of a sprite in the atlas texture
+  """
+  @spec get_rec(
+          atlas :: Zexray.Type.SpriteAtlas.t_resource(),
+          id :: non_neg_integer,
+          return :: :auto | :value | :resource
+        ) :: Zexray.Type.Rectangle.t_nif()
+  defdelegate get_rec(
+                atlas,
+                id,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :get_sprite_rec
+
+  #############
+  #  Drawing  #
+  #############
+
+  @doc """
+  Draw a sprite of the atlas at a position
+
+  ## Options
+
+  - `:origin` - point of the scaled sprite placed at the position, the rotation center (default top left)
+  - `:rotation` - degrees (default `0.0`)
+  - `:scale` - (default `1.0`)
+  """
+  @spec draw(
+          atlas :: Zexray.Type.SpriteAtlas.t_resource(),
+          id :: non_neg_integer,
+          position :: Zexray.Type.Vector2.t_all(),
+          tint :: Zexray.Type.Color.t_all(),
+          opts :: [
+            {:origin, Zexray.Type.Vector2.t_all()}
+            | {:rotation, number}
+            | {:scale, number}
+          ]
+        ) :: :ok
+  def draw(atlas, id, position, tint, opts \\ []) do
+    NIF.draw_sprite(
+      atlas,
+      id,
+      position,
+      Keyword.get(opts, :origin, Zexray.Math.vector2_zero()),
+      Keyword.get(opts, :rotation, 0.0),
+      Keyword.get(opts, :scale, 1.0),
+      tint
+    )
+  end
+
+  @doc """
+  Draw many sprites of the atlas in one call
+
+  Each sprite is `{id, x, y, rotation, scale, tint}`, centered on `(x, y)` and
+  rotated around its center.
+  """
+  @spec draw_batch(
+          atlas :: Zexray.Type.SpriteAtlas.t_resource(),
+          sprites :: [
+            {non_neg_integer, number, number, number, number, Zexray.Type.Color.t_all()}
+          ]
+        ) :: :ok
+  defdelegate draw_batch(atlas, sprites), to: NIF, as: :draw_sprites
+end
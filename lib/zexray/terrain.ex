@@ -0,0 +1,133 @@
+defmodule Zexray.Terrain do
+  @moduledoc """
+  Chunked terrain
+
+  A heightmap split in chunks of `chunk_size` quads, each one built at `lod_levels`
+  levels of detail (every level halves the resolution). The chunk meshes are built
+  on the worker pool and only kept on the GPU.
+
+  `draw/4` culls the chunks outside the camera frustum and draws each visible chunk
+  at the level matching its distance to the camera: full resolution up to
+  `lod_distance`, then one level lower every time the distance doubles. Skirts hanging
+  from the chunk edges hide the cracks between chunks of different levels.
+
+  ```elixir
+  terrain = Zexray.Terrain.load(heightmap, type_vector3(x: 1024, y: 64, z: 1024))
+
+  Zexray.Drawing.begin_mode_3d(camera)
+  Zexray.Terrain.draw(terrain, camera, material)
+  Zexray.Drawing.end_mode_3d()
+
+  y = Zexray.Terrain.get_height(terrain, player_x, player_z)
+  ```
+
+  The heights are read from the gray value of the heightmap colors (as
+  `gen_mesh_heightmap`), or as is from 32 bit grayscale images (`0.0..1.0`) for
+  more precision.
+  """
+
+  alias Zexray.NIF
+
+  @type stats :: %{
+          chunks: non_neg_integer,
+          drawn: non_neg_integer,
+          culled: non_neg_integer,
+          triangles: non_neg_integer
+        }
+
+  #############
+  #  Loading  #
+  #############
+
+  @doc """
+  Load a terrain from a heightmap
+
+  `size` is the extent of the terrain on x and z and its maximum height on y.
+
+  ## Options
+
+  - `:position` - corner of the terrain at height 0 (default origin)
+  - `:chunk_size` - quads per chunk side, a power of 2 up to `128` (default `64`)
+  - `:lod_levels` - levels of detail, up to `6` (default `4`)
+  - `:skirt_depth` - depth of the skirts below the chunk edges (default `1.0`)
+  """
+  @spec load(
+          heightmap :: Zexray.Type.Image.t_all(),
+          size :: Zexray.Type.Vector3.t_all(),
+          opts :: [
+            {:position, Zexray.Type.Vector3.t_all()}
+            | {:chunk_size, pos_integer}
+            | {:lod_levels, pos_integer}
+            | {:skirt_depth, number}
+          ]
+        ) :: Zexray.Type.Terrain.t_resource()
+  def load(heightmap, size, opts \\ []) do
+    NIF.load_terrain(
+      heightmap,
+      size,
+      Keyword.get(opts, :position, Zexray.Math.vector3_zero()),
+      Keyword.get(opts, :chunk_size, 64),
+      Keyword.get(opts, :lod_levels, 4),
+      Keyword.get(opts, :skirt_depth, 1.0)
+    )
+  end
+
+  #############
+  #  Drawing  #
+  #############
+
+  @doc """
+  Draw the visible chunks of a terrain with a material (`nil` for the default one)
+
+  NOTE: Must be called inside `Zexray.Drawing.begin_mode_3d/1` with the same camera
+  """
+  @spec draw(
+          terrain :: Zexray.Type.Terrain.t_resource(),
+          camera :: Zexray.Type.Camera3D.t_all(),
+          material :: Zexray.Type.Material.t_all() | nil,
+          lod_distance :: number
+        ) :: :ok
+  defdelegate draw(terrain, camera, material \\ nil, lod_distance \\ 64.0),
+    to: NIF,
+    as: :draw_terrain
+
+  @doc """
+  Get the terrain statistics of the last draw
+  """
+  @spec stats(terrain :: Zexray.Type.Terrain.t_resource()) :: stats()
+  def stats(terrain) do
+    {chunks, drawn, culled, triangles} = NIF.get_terrain_stats(terrain)
+
+    %{chunks: chunks, drawn: drawn, culled: culled, triangles: triangles}
+  end
+
+  #############
+  #  Queries  #
+  #############
+
+  @doc """
+  Get the terrain height at a world position, on the full resolution surface
+  (clamped to the terrain edges)
+  """
+  @spec get_height(terrain :: Zexray.Type.Terrain.t_resource(), x :: number, z :: number) ::
+          float
+  defdelegate get_height(terrain, x, z), to: NIF, as: :get_terrain_height
+
+  @doc """
+  Get the terrain normal at a world position (clamped to the terrain edges)
+  """
+  @spec get_normal(
+          terrain :: Zexray.Type.Terrain.t_resource(),
+          x :: number,
+          z :: number,
+          return :: :auto | :value | :resource
+        ) :: Zexray.Type.Vector3.t_nif()
+  defdelegate get_normal(
+                terrain,
+                x,
+                z,
+                return \\ :auto
+              ),
+              to: NIF,
+              as: :get_terrain_normal
+end
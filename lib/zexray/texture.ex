@@ -119,6 +119,103 @@ defmodule Zexray.Texture do
               to: NIF,
               as: :update_texture_rec
 
+  #######################
+  #  Texture streaming  #
+  #######################
+
+  @doc """
+  Load a texture updated every frame through a ring of pixel buffers (3 by default, up to 8)
+
+  Meant for video frames, software rendered canvases or camera feeds. The frame
+  binary is written straight into a pixel buffer and copied to the texture by the
+  GPU asynchronously:
+
+  - `:persistent` - persistently mapped buffers (OpenGL 4.4 or `ARB_buffer_storage`)
+  - `:mapped` - buffers mapped on each update (OpenGL 3.3 or ES 3.0)
+  - `:direct` - synchronous update without pixel buffers (other OpenGL versions and platforms)
+
+  A fence per buffer tells when it can be written again, when all the buffers are
+  in use the frame is dropped instead of stalling the pipeline.
+
+  ```
+  stream = Zexray.Texture.load_stream(640, 480, enum_pixel_format(:uncompressed_r8g8b8a8))
+  texture = Zexray.Texture.stream_texture(stream)
+
+  # Every frame
+  Zexray.Texture.update_stream(stream, frame)
+  Zexray.Texture.draw(texture, 0, 0, enum_color(:white))
+  ```
+  """
+  @doc group: :streaming
+  @spec load_stream(
+          width :: integer,
+          height :: integer,
+          format :: Zexray.Enum.PixelFormat.t(),
+          buffers :: pos_integer
+        ) :: Zexray.Type.TextureStream.t_resource()
+  defdelegate load_stream(
+                width,
+                height,
+                format,
+                buffers \\ 3
+              ),
+              to: NIF,
+              as: :load_texture_stream
+
+  @doc """
+  Upload a frame to the texture stream, returns false if the frame was dropped (all the pixel buffers in use)
+  """
+  @doc group: :streaming
+  @spec update_stream(
+          stream :: Zexray.Type.TextureStream.t_resource(),
+          pixels :: binary
+        ) :: boolean
+  defdelegate update_stream(
+                stream,
+                pixels
+              ),
+              to: NIF,
+              as: :update_texture_stream
+
+  @doc """
+  Get the texture of the texture stream (owned by the stream, it must not be unloaded)
+
+  NOTE: The texture is only valid while the stream is alive: it dangles once
+  the stream is freed (or garbage collected), get it again after each update
+  instead of keeping it.
+  """
+  @doc group: :streaming
+  @spec stream_texture(stream :: Zexray.Type.TextureStream.t_resource()) ::
+          Zexray.Type.Texture2D.t_nif()
+  defdelegate stream_texture(stream), to: NIF, as: :get_texture_stream_texture
+
+  @doc """
+  Get the texture stream statistics
+
+  The latency goes from the write into the pixel buffer until the GPU copied it
+  to the texture, it is measured when the stream is polled (each update and stats call).
+  """
+  @doc group: :streaming
+  @spec stream_stats(stream :: Zexray.Type.TextureStream.t_resource()) :: %{
+          mode: :persistent | :mapped | :direct,
+          uploaded: non_neg_integer,
+          dropped: non_neg_integer,
+          last_latency_us: non_neg_integer,
+          average_latency_us: non_neg_integer
+        }
+  def stream_stats(stream) do
+    {mode, uploaded, dropped, last_latency_us, average_latency_us} =
+      NIF.get_texture_stream_stats(stream)
+
+    %{
+      mode: mode,
+      uploaded: uploaded,
+      dropped: dropped,
+      last_latency_us: last_latency_us,
+      average_latency_us: average_latency_us
+    }
+  end
+
   ###########################
   #  Texture configuration  #
   ###########################
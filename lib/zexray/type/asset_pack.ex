@@ -0,0 +1,13 @@
+defmodule Zexray.Type.AssetPack do
+  @moduledoc """
+  Asset pack
+
+  Memory-mapped pack of pre-decoded assets (only available as a resource), see `Zexray.AssetPack`
+  """
+
+  require Record
+
+  use Zexray.Type.HandleBase, prefix: "asset_pack"
+
+  @type t_all :: t_resource
+end
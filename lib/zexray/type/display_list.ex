@@ -0,0 +1,13 @@
+defmodule Zexray.Type.DisplayList do
+  @moduledoc """
+  Display list
+
+  Draw calls recorded natively and replayed with one call (only available as a resource), see `Zexray.DisplayList`
+  """
+
+  require Record
+
+  use Zexray.Type.HandleBase, prefix: "display_list"
+
+  @type t_all :: t_resource
+end
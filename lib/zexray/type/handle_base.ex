@@ -0,0 +1,30 @@
+defmodule Zexray.Type.HandleBase do
+  @moduledoc false
+
+  defmacro __using__(opts) do
+    prefix = Keyword.fetch!(opts, :prefix)
+    resource_tag = String.to_atom("#{prefix}_resource")
+    free_resource = String.to_atom("#{prefix}_free_resource")
+
+    quote generated: true do
+      @type t_resource ::
+              record(:t_resource,
+                reference: reference
+              )
+
+      Record.defrecord(:t_resource, unquote(resource_tag), reference: nil)
+
+      @type t_nif :: t_resource
+
+      alias Zexray.NIF
+
+      @doc """
+      Free the memory used by the resource.
+      """
+      @spec free_resource(resource :: t_resource()) :: :ok
+      def free_resource(t_resource() = resource) do
+        apply(NIF, unquote(free_resource), [resource])
+      end
+    end
+  end
+end
@@ -0,0 +1,13 @@
+defmodule Zexray.Type.ImageAnimStream do
+  @moduledoc """
+  Animated image stream
+
+  Animated image (GIF) decoded one frame at a time into a small ring of frames (only available as a resource), see `Zexray.Image`
+  """
+
+  require Record
+
+  use Zexray.Type.HandleBase, prefix: "image_anim_stream"
+
+  @type t_all :: t_resource
+end
@@ -0,0 +1,13 @@
+defmodule Zexray.Type.Replay do
+  @moduledoc """
+  Replay
+
+  Automation events played back frame by frame, rendering offscreen (only available as a resource), see `Zexray.Replay`
+  """
+
+  require Record
+
+  use Zexray.Type.HandleBase, prefix: "replay"
+
+  @type t_all :: t_resource
+end
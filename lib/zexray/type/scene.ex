@@ -0,0 +1,13 @@
+defmodule Zexray.Type.Scene do
+  @moduledoc """
+  Scene
+
+  Native scene graph (only available as a resource), see `Zexray.Scene`
+  """
+
+  require Record
+
+  use Zexray.Type.HandleBase, prefix: "scene"
+
+  @type t_all :: t_resource
+end
@@ -0,0 +1,13 @@
+defmodule Zexray.Type.SpriteAtlas do
+  @moduledoc """
+  Sprite atlas
+
+  Images packed in one texture, the sprites are addressed by id (only available as a resource), see `Zexray.SpriteAtlas`
+  """
+
+  require Record
+
+  use Zexray.Type.HandleBase, prefix: "sprite_atlas"
+
+  @type t_all :: t_resource
+end
@@ -0,0 +1,13 @@
+defmodule Zexray.Type.Terrain do
+  @moduledoc """
+  Terrain
+
+  Heightmap split in chunks with several levels of detail (only available as a resource), see `Zexray.Terrain`
+  """
+
+  require Record
+
+  use Zexray.Type.HandleBase, prefix: "terrain"
+
+  @type t_all :: t_resource
+end
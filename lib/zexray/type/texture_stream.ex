@@ -0,0 +1,13 @@
+defmodule Zexray.Type.TextureStream do
+  @moduledoc """
+  Texture stream
+
+  Texture updated every frame through a ring of pixel buffers (only available as a resource), see `Zexray.Texture`
+  """
+
+  require Record
+
+  use Zexray.Type.HandleBase, prefix: "texture_stream"
+
+  @type t_all :: t_resource
+end
@@ -0,0 +1,13 @@
+defmodule Zexray.Type.UniformSet do
+  @moduledoc """
+  Uniform set
+
+  Uniform values of a shader with their locations resolved once (only available as a resource), see `Zexray.Shader`
+  """
+
+  require Record
+
+  use Zexray.Type.HandleBase, prefix: "uniform_set"
+
+  @type t_all :: t_resource
+end
@@ -0,0 +1,13 @@
+defmodule Zexray.Type.VoicePool do
+  @moduledoc """
+  Voice pool
+
+  Fixed number of voices playing sounds natively (only available as a resource), see `Zexray.VoicePool`
+  """
+
+  require Record
+
+  use Zexray.Type.HandleBase, prefix: "voice_pool"
+
+  @type t_all :: t_resource
+end
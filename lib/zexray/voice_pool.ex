@@ -0,0 +1,142 @@
+defmodule Zexray.VoicePool do
+  @moduledoc """
+  Voice pools
+
+  A fixed number of voices playing fire-and-forget sounds natively, nothing is tracked
+  in Elixir. Each voice is a sound alias sharing the sample data of the sound it plays,
+  only a voice playing another sound than its last one allocates a new alias.
+
+  When all the voices are busy, the voice of the lowest priority (the oldest first)
+  is stolen, provided its priority is not above the priority of the new sound,
+  otherwise the new sound is dropped.
+
+  ```elixir
+  pool = Zexray.VoicePool.load(explosion, 16)
+
+  Zexray.VoicePool.play(pool, explosion, volume: 0.8, pitch: 0.9 + :rand.uniform() * 0.2)
+  Zexray.VoicePool.play_3d(pool, footstep, position, priority: -1)
+  ```
+
+  `play_3d/4` attenuates and pans the sound for the listener set with
+  `Zexray.Audio.begin_mode_3d/2`, sounds too quiet to be heard are culled
+  instead of taking a voice.
+
+  NOTE: Any sound can be played on a pool. The voices keep the sound resources they
+  play alive, a sound resource freed with `Zexray.Resource.free/1` is stopped on every
+  voice first. A sound value must not be unloaded while a voice plays it.
+  """
+
+  alias Zexray.NIF
+
+  @type stats :: %{
+          voices: non_neg_integer,
+          active: non_neg_integer,
+          played: non_neg_integer,
+          stolen: non_neg_integer,
+          dropped: non_neg_integer,
+          culled: non_neg_integer
+        }
+
+  #############
+  #  Loading  #
+  #############
+
+  @doc """
+  Load a pool of voices (`1..256`), created as aliases of a sound
+  """
+  @spec load(sound :: Zexray.Type.Sound.t_all(), voices :: pos_integer) ::
+          Zexray.Type.VoicePool.t_resource()
+  defdelegate load(sound, voices), to: NIF, as: :load_voice_pool
+
+  #############
+  #  Playing  #
+  #############
+
+  @doc """
+  Play a sound on a voice of the pool, returns the voice index or `nil` when dropped
+
+  ## Options
+
+  - `:volume` - `0.0..1.0` (default `1.0`)
+  - `:pitch` - `1.0` is the base pitch (default `1.0`)
+  - `:pan` - `0.5` is centered (default `0.5`)
+  - `:priority` - voices only steal voices of the same or a lower priority (default `0`)
+  """
+  @spec play(
+          pool :: Zexray.Type.VoicePool.t_resource(),
+          sound :: Zexray.Type.Sound.t_all(),
+          opts :: [{:volume, float} | {:pitch, float} | {:pan, float} | {:priority, integer}]
+        ) :: non_neg_integer | nil
+  def play(pool, sound, opts \\ []) do
+    NIF.play_voice(
+      pool,
+      sound,
+      Keyword.get(opts, :volume, 1.0),
+      Keyword.get(opts, :pitch, 1.0),
+      Keyword.get(opts, :pan, 0.5),
+      Keyword.get(opts, :priority, 0)
+    )
+  end
+
+  @doc """
+  Play a sound at a position on a voice of the pool, returns the voice index or `nil` when dropped or culled
+
+  Takes the same options as `play/3`, except `:pan`.
+  """
+  @spec play_3d(
+          pool :: Zexray.Type.VoicePool.t_resource(),
+          sound :: Zexray.Type.Sound.t_all(),
+          position :: Zexray.Type.Vector3.t_all(),
+          opts :: [{:volume, float} | {:pitch, float} | {:priority, integer}]
+        ) :: non_neg_integer | nil
+  def play_3d(pool, sound, position, opts \\ []) do
+    NIF.play_voice_3d(
+      pool,
+      sound,
+      position,
+      Keyword.get(opts, :volume, 1.0),
+      Keyword.get(opts, :pitch, 1.0),
+      Keyword.get(opts, :priority, 0)
+    )
+  end
+
+  @doc """
+  Stop all the voices of the pool
+  """
+  @spec stop(pool :: Zexray.Type.VoicePool.t_resource()) :: :ok
+  defdelegate stop(pool), to: NIF, as: :stop_voice_pool
+
+  ###########
+  #  Stats  #
+  ###########
+
+  @doc """
+  Get the voice pool counters
+
+  - `:voices` - voices in the pool
+  - `:active` - voices playing now
+  - `:played` - sounds started
+  - `:stolen` - sounds cut off to start another one
+  - `:dropped` - sounds not started, all the voices were busy with a higher priority
+  - `:culled` - sounds not started, too quiet to be heard
+  """
+  @spec stats(pool :: Zexray.Type.VoicePool.t_resource()) :: stats()
+  def stats(pool) do
+    {voices, active, played, stolen, dropped, culled} = NIF.get_voice_pool_stats(pool)
+
+    %{
+      voices: voices,
+      active: active,
+      played: played,
+      stolen: stolen,
+      dropped: dropped,
+      culled: culled
+    }
+  end
+
+  @doc """
+  Restart the played, stolen, dropped and culled counters
+  """
+  @spec reset_stats(pool :: Zexray.Type.VoicePool.t_resource()) :: :ok
+  defdelegate reset_stats(pool), to: NIF, as: :reset_voice_pool_stats
+end
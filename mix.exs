@@ -170,6 +170,7 @@ defmodule Zexray.MixProject do
         Zexray.NIF,
         Zexray.OutOfMemoryError,
         Zexray.Type.Camera3DBase,
+        Zexray.Type.HandleBase,
         Zexray.Type.RenderTextureBase,
         Zexray.Type.TextureBase,
         Zexray.Type.TypeBase,
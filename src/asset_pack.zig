@@ -0,0 +1,680 @@
+const std = @import("std");
+const builtin = @import("builtin");
+const assert = std.debug.assert;
+const rl = @import("./raylib.zig");
+
+pub const allocator = rl.allocator;
+
+/// Asset pack file layout (little endian)
+///
+/// - AssetPackHeader
+/// - Payloads (aligned to ASSET_PACK_ALIGNMENT), starting with the header of their type
+/// - Index: AssetIndexEntry followed by the name (padded to 8 bytes) for every asset
+pub const ASSET_PACK_MAGIC = [4]u8{ 'Z', 'X', 'P', 'K' };
+pub const ASSET_PACK_VERSION: u32 = 1;
+pub const ASSET_PACK_ALIGNMENT: usize = 64;
+
+/// Alignment of the arrays inside a payload
+const ASSET_DATA_ALIGNMENT: usize = 16;
+
+pub const AssetType = enum(u32) {
+    texture = 1,
+    mesh = 2,
+    font = 3,
+    sound = 4,
+};
+
+pub const AssetPackHeader = extern struct {
+    magic: [4]u8 = ASSET_PACK_MAGIC,
+    version: u32 = ASSET_PACK_VERSION,
+    entry_count: u32,
+    reserved: u32 = 0,
+    index_offset: u64,
+    index_size: u64,
+};
+
+pub const AssetIndexEntry = extern struct {
+    asset_type: u32,
+    name_length: u32,
+    offset: u64,
+    size: u64,
+};
+
+/// Texture payload: header, pixel data of all the mipmap levels
+pub const AssetTextureHeader = extern struct {
+    width: i32,
+    height: i32,
+    mipmaps: i32,
+    format: i32,
+    data_size: u64,
+    reserved: u64 = 0,
+};
+
+/// Mesh attributes present in the payload (arrays stored in this order)
+pub const ASSET_MESH_VERTICES: u32 = 0x01; // f32 x 3
+pub const ASSET_MESH_TEXCOORDS: u32 = 0x02; // f32 x 2
+pub const ASSET_MESH_TEXCOORDS2: u32 = 0x04; // f32 x 2
+pub const ASSET_MESH_NORMALS: u32 = 0x08; // f32 x 3
+pub const ASSET_MESH_TANGENTS: u32 = 0x10; // f32 x 4
+pub const ASSET_MESH_COLORS: u32 = 0x20; // u8 x 4
+pub const ASSET_MESH_INDICES: u32 = 0x40; // u16 x 3 per triangle
+
+/// Mesh payload: header, attribute arrays in the GPU vertex layout of raylib
+pub const AssetMeshHeader = extern struct {
+    vertex_count: i32,
+    triangle_count: i32,
+    attributes: u32,
+    reserved: u32 = 0,
+};
+
+/// Font payload: header, atlas pixel data, recs (Rectangle), glyph infos (AssetGlyph)
+pub const AssetFontHeader = extern struct {
+    base_size: i32,
+    glyph_count: i32,
+    glyph_padding: i32,
+    reserved: i32 = 0,
+    atlas: AssetTextureHeader,
+};
+
+pub const AssetGlyph = extern struct {
+    value: i32,
+    offset_x: i32,
+    offset_y: i32,
+    advance_x: i32,
+};
+
+/// Sound payload: header, PCM data
+pub const AssetSoundHeader = extern struct {
+    frame_count: u32,
+    sample_rate: u32,
+    sample_size: u32,
+    channels: u32,
+    data_size: u64,
+    reserved: u64 = 0,
+};
+
+fn align_forward(value: usize, alignment: usize) usize {
+    return std.mem.alignForward(usize, value, alignment);
+}
+
+/// Size of one element of a mesh attribute array
+fn mesh_attribute_size(attribute: u32) usize {
+    return switch (attribute) {
+        ASSET_MESH_VERTICES, ASSET_MESH_NORMALS => 3 * @sizeOf(f32),
+        ASSET_MESH_TEXCOORDS, ASSET_MESH_TEXCOORDS2 => 2 * @sizeOf(f32),
+        ASSET_MESH_TANGENTS => 4 * @sizeOf(f32),
+        ASSET_MESH_COLORS => 4,
+        ASSET_MESH_INDICES => 3 * @sizeOf(u16),
+        else => 0,
+    };
+}
+
+const mesh_attributes = [_]u32{
+    ASSET_MESH_VERTICES,
+    ASSET_MESH_TEXCOORDS,
+    ASSET_MESH_TEXCOORDS2,
+    ASSET_MESH_NORMALS,
+    ASSET_MESH_TANGENTS,
+    ASSET_MESH_COLORS,
+    ASSET_MESH_INDICES,
+};
+
+pub const AssetEntry = struct {
+    asset_type: AssetType,
+    payload: []const u8,
+};
+
+/// Asset pack mapped in memory, assets are decoded from the mapping only when loaded
+///
+/// NOTE: Payloads point into the mapping, hold the lock (shared) while they are used
+pub const AssetPack = struct {
+    lock: std.Thread.RwLock = .{},
+    mapping: []align(std.heap.page_size_min) const u8,
+    entries: std.StringHashMap(AssetEntry),
+    closed: bool = false,
+
+    pub fn init(file_name: []const u8) !*AssetPack {
+        const file = try std.fs.cwd().openFile(file_name, .{});
+        defer file.close();
+
+        const size = try file.getEndPos();
+        if (size < @sizeOf(AssetPackHeader)) return error.invalid_asset_pack;
+
+        const mapping = try map_file(file, size);
+        errdefer unmap_file(mapping);
+
+        var entries = std.StringHashMap(AssetEntry).init(allocator);
+        errdefer entries.deinit();
+
+        try read_index(mapping, &entries);
+
+        const pack = try allocator.create(AssetPack);
+        pack.* = AssetPack{
+            .mapping = mapping,
+            .entries = entries,
+        };
+
+        return pack;
+    }
+
+    /// Unmap the file, the pack can no longer be used
+    pub fn close(self: *AssetPack) void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        if (self.closed) return;
+
+        self.entries.deinit();
+        unmap_file(self.mapping);
+        self.closed = true;
+    }
+
+    pub fn deinit(self: *AssetPack) void {
+        self.close();
+        allocator.destroy(self);
+    }
+
+    /// Lock the pack (shared) while its entries and payloads are used
+    pub fn acquire(self: *AssetPack) !void {
+        self.lock.lockShared();
+        if (self.closed) {
+            self.lock.unlockShared();
+            return error.asset_pack_closed;
+        }
+    }
+
+    pub fn release(self: *AssetPack) void {
+        self.lock.unlockShared();
+    }
+
+    /// Payload of an asset (the pack must be acquired)
+    pub fn get(self: *AssetPack, name: []const u8, asset_type: AssetType) ![]const u8 {
+        const entry = self.entries.get(name) orelse return error.asset_not_found;
+        if (entry.asset_type != asset_type) return error.asset_type_mismatch;
+        return entry.payload;
+    }
+
+    fn map_file(file: std.fs.File, size: u64) ![]align(std.heap.page_size_min) const u8 {
+        if (builtin.os.tag == .windows) {
+            // No mmap on Windows, the pack is read once instead
+            const data = try allocator.alignedAlloc(u8, std.heap.page_size_min, @intCast(size));
+            errdefer allocator.free(data);
+            if (try file.readAll(data) != data.len) return error.invalid_asset_pack;
+            return data;
+        } else {
+            return std.posix.mmap(null, @intCast(size), std.posix.PROT.READ, .{ .TYPE = .PRIVATE }, file.handle, 0);
+        }
+    }
+
+    fn unmap_file(mapping: []align(std.heap.page_size_min) const u8) void {
+        if (builtin.os.tag == .windows) {
+            allocator.free(mapping);
+        } else {
+            std.posix.munmap(mapping);
+        }
+    }
+
+    fn read_index(data: []const u8, entries: *std.StringHashMap(AssetEntry)) !void {
+        const header = std.mem.bytesToValue(AssetPackHeader, data[0..@sizeOf(AssetPackHeader)]);
+        if (!std.mem.eql(u8, &header.magic, &ASSET_PACK_MAGIC)) return error.invalid_asset_pack;
+        if (header.version != ASSET_PACK_VERSION) return error.invalid_asset_pack_version;
+        if (header.index_offset > data.len or header.index_size > data.len - header.index_offset) return error.invalid_asset_pack;
+
+        if (header.entry_count > header.index_size / @sizeOf(AssetIndexEntry)) return error.invalid_asset_pack;
+
+        const index = data[@intCast(header.index_offset)..@intCast(header.index_offset + header.index_size)];
+        try entries.ensureTotalCapacity(header.entry_count);
+
+        var pos: usize = 0;
+        for (0..header.entry_count) |_| {
+            if (index.len - pos < @sizeOf(AssetIndexEntry)) return error.invalid_asset_pack;
+            const entry = std.mem.bytesToValue(AssetIndexEntry, index[pos..][0..@sizeOf(AssetIndexEntry)]);
+            pos += @sizeOf(AssetIndexEntry);
+
+            if (index.len - pos < entry.name_length) return error.invalid_asset_pack;
+            const name = index[pos .. pos + entry.name_length];
+            pos = align_forward(pos + entry.name_length, 8);
+            if (pos > index.len) return error.invalid_asset_pack;
+
+            if (entry.offset > data.len or entry.size > data.len - entry.offset) return error.invalid_asset_pack;
+            const asset_type = std.meta.intToEnum(AssetType, entry.asset_type) catch return error.invalid_asset_pack;
+
+            // Names point into the mapping, it lives as long as the index
+            entries.putAssumeCapacity(name, AssetEntry{
+                .asset_type = asset_type,
+                .payload = data[@intCast(entry.offset)..@intCast(entry.offset + entry.size)],
+            });
+        }
+    }
+};
+
+pub fn LoadAssetPack(file_name: []const u8) !*AssetPack {
+    return AssetPack.init(file_name);
+}
+
+pub fn UnloadAssetPack(pack: *AssetPack) void {
+    pack.deinit();
+}
+
+pub fn UnloadAssetPackData(pack: *AssetPack) void {
+    pack.close();
+}
+
+///////////////
+//  Loading  //
+///////////////
+
+/// Bounds checked reader over a payload
+const PayloadReader = struct {
+    data: []const u8,
+    pos: usize = 0,
+
+    fn header(self: *PayloadReader, comptime T: type) !T {
+        const value = try self.bytes(@sizeOf(T));
+        return std.mem.bytesToValue(T, value[0..@sizeOf(T)]);
+    }
+
+    fn bytes(self: *PayloadReader, len: usize) ![]const u8 {
+        self.pos = align_forward(self.pos, ASSET_DATA_ALIGNMENT);
+        if (self.pos > self.data.len or self.data.len - self.pos < len) return error.invalid_asset;
+        const value = self.data[self.pos .. self.pos + len];
+        self.pos += len;
+        return value;
+    }
+};
+
+/// Copy a payload array to a raylib allocation (owned by the raylib struct)
+fn copy_array(comptime T: type, data: []const u8) !?[*]T {
+    if (data.len == 0) return null;
+    const ptr: [*]u8 = @ptrCast(rl.MemAlloc(@intCast(data.len)) orelse return error.OutOfMemory);
+    @memcpy(ptr[0..data.len], data);
+    return @ptrCast(@alignCast(ptr));
+}
+
+/// Bytes of the pixel data of all the mipmap levels, as read by rlLoadTexture()
+fn texture_data_size(header: AssetTextureHeader) !usize {
+    if (header.width <= 0 or header.height <= 0 or header.mipmaps <= 0) return error.invalid_asset;
+    if (header.format < rl.PIXELFORMAT_UNCOMPRESSED_GRAYSCALE or header.format > rl.PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) return error.invalid_asset;
+
+    var width: usize = @intCast(header.width);
+    var height: usize = @intCast(header.height);
+
+    const mipmaps: usize = @intCast(header.mipmaps);
+    if (mipmaps > @as(usize, std.math.log2_int(usize, @max(width, height))) + 1) return error.invalid_asset;
+
+    // Bits per pixel (8 pixels wide to skip the minimum block size of the compressed formats)
+    const bpp: usize = @intCast(rl.GetPixelDataSize(8, 1, header.format));
+
+    var size: usize = 0;
+    for (0..mipmaps) |_| {
+        const level_size = if (width < 4 and height < 4)
+            @as(usize, @intCast(rl.GetPixelDataSize(@intCast(width), @intCast(height), header.format)))
+        else
+            (std.math.mul(usize, width * height, bpp) catch return error.invalid_asset) / 8;
+
+        size = std.math.add(usize, size, level_size) catch return error.invalid_asset;
+
+        width = @max(width / 2, 1);
+        height = @max(height / 2, 1);
+    }
+
+    return size;
+}
+
+/// Upload a texture straight from the pack data
+pub fn LoadTexture(payload: []const u8) !rl.Texture2D {
+    var reader = PayloadReader{ .data = payload };
+    const header = try reader.header(AssetTextureHeader);
+    if (header.data_size < try texture_data_size(header)) return error.invalid_asset;
+    const data = try reader.bytes(@intCast(header.data_size));
+
+    const id = rl.rlLoadTexture(data.ptr, header.width, header.height, header.format, header.mipmaps);
+    if (id == 0) return error.texture_upload_failed;
+
+    return rl.Texture2D{
+        .id = id,
+        .width = header.width,
+        .height = header.height,
+        .mipmaps = header.mipmaps,
+        .format = header.format,
+    };
+}
+
+/// Load a mesh and upload it (the CPU arrays are copied, raylib owns them)
+pub fn LoadMesh(payload: []const u8) !rl.Mesh {
+    var reader = PayloadReader{ .data = payload };
+    const header = try reader.header(AssetMeshHeader);
+    if (header.vertex_count <= 0 or header.triangle_count < 0) return error.invalid_asset;
+
+    var mesh = std.mem.zeroes(rl.Mesh);
+    mesh.vertexCount = header.vertex_count;
+    mesh.triangleCount = header.triangle_count;
+    errdefer rl.UnloadMesh(mesh);
+
+    for (mesh_attributes) |attribute| {
+        if (header.attributes & attribute == 0) continue;
+
+        const count: usize = @intCast(if (attribute == ASSET_MESH_INDICES) header.triangle_count else header.vertex_count);
+        const data = try reader.bytes(count * mesh_attribute_size(attribute));
+
+        switch (attribute) {
+            ASSET_MESH_VERTICES => mesh.vertices = try copy_array(f32, data),
+            ASSET_MESH_TEXCOORDS => mesh.texcoords = try copy_array(f32, data),
+            ASSET_MESH_TEXCOORDS2 => mesh.texcoords2 = try copy_array(f32, data),
+            ASSET_MESH_NORMALS => mesh.normals = try copy_array(f32, data),
+            ASSET_MESH_TANGENTS => mesh.tangents = try copy_array(f32, data),
+            ASSET_MESH_COLORS => mesh.colors = try copy_array(u8, data),
+            ASSET_MESH_INDICES => mesh.indices = try copy_array(u16, data),
+            else => unreachable,
+        }
+    }
+
+    if (mesh.vertices == null) return error.invalid_asset;
+
+    if (mesh.indices) |indices| {
+        const index_count = 3 * @as(usize, @intCast(header.triangle_count));
+        for (indices[0..index_count]) |index| {
+            if (index >= header.vertex_count) return error.invalid_asset;
+        }
+    }
+
+    rl.UploadMesh(&mesh, false);
+
+    return mesh;
+}
+
+/// Load a baked font, the atlas is uploaded straight from the pack data
+///
+/// NOTE: Glyph images are not packed (only the atlas is needed to draw)
+pub fn LoadFont(payload: []const u8) !rl.Font {
+    var reader = PayloadReader{ .data = payload };
+    const header = try reader.header(AssetFontHeader);
+    if (header.glyph_count <= 0) return error.invalid_asset;
+
+    if (header.atlas.data_size < try texture_data_size(header.atlas)) return error.invalid_asset;
+
+    const glyph_count: usize = @intCast(header.glyph_count);
+    const atlas = try reader.bytes(@intCast(header.atlas.data_size));
+    const recs = try reader.bytes(glyph_count * @sizeOf(rl.Rectangle));
+    const glyphs = try reader.bytes(glyph_count * @sizeOf(AssetGlyph));
+
+    var font = std.mem.zeroes(rl.Font);
+    font.baseSize = header.base_size;
+    font.glyphCount = header.glyph_count;
+    font.glyphPadding = header.glyph_padding;
+
+    font.recs = try copy_array(rl.Rectangle, recs);
+    errdefer rl.MemFree(font.recs);
+
+    font.glyphs = @ptrCast(@alignCast(rl.MemAlloc(@intCast(glyph_count * @sizeOf(rl.GlyphInfo))) orelse return error.OutOfMemory));
+    errdefer rl.MemFree(font.glyphs);
+
+    for (0..glyph_count) |i| {
+        const glyph = std.mem.bytesToValue(AssetGlyph, glyphs[i * @sizeOf(AssetGlyph) ..][0..@sizeOf(AssetGlyph)]);
+        font.glyphs[i] = rl.GlyphInfo{
+            .value = glyph.value,
+            .offsetX = glyph.offset_x,
+            .offsetY = glyph.offset_y,
+            .advanceX = glyph.advance_x,
+            .image = rl.Image{
+                .data = null,
+                .width = 0,
+                .height = 0,
+                .mipmaps = 1,
+                .format = rl.PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,
+            },
+        };
+    }
+
+    const id = rl.rlLoadTexture(atlas.ptr, header.atlas.width, header.atlas.height, header.atlas.format, header.atlas.mipmaps);
+    if (id == 0) return error.texture_upload_failed;
+
+    font.texture = rl.Texture2D{
+        .id = id,
+        .width = header.atlas.width,
+        .height = header.atlas.height,
+        .mipmaps = header.atlas.mipmaps,
+        .format = header.atlas.format,
+    };
+
+    return font;
+}
+
+/// Bytes of the PCM data, as read by LoadSoundFromWave()
+fn sound_data_size(header: AssetSoundHeader) !usize {
+    if (header.sample_rate == 0 or header.channels == 0) return error.invalid_asset;
+    if (header.sample_size != 8 and header.sample_size != 16 and header.sample_size != 32) return error.invalid_asset;
+
+    const frame_size = @as(usize, header.channels) * (header.sample_size / 8);
+    return std.math.mul(usize, header.frame_count, frame_size) catch error.invalid_asset;
+}
+
+/// Load a sound, the PCM data is read straight from the pack data
+pub fn LoadSound(payload: []const u8) !rl.Sound {
+    var reader = PayloadReader{ .data = payload };
+    const header = try reader.header(AssetSoundHeader);
+    if (header.data_size < try sound_data_size(header)) return error.invalid_asset;
+    const data = try reader.bytes(@intCast(header.data_size));
+
+    const wave = rl.Wave{
+        .frameCount = header.frame_count,
+        .sampleRate = header.sample_rate,
+        .sampleSize = header.sample_size,
+        .channels = header.channels,
+        .data = @ptrCast(@constCast(data.ptr)),
+    };
+
+    // LoadSoundFromWave() converts the data to the device format, the wave is not modified
+    const sound = rl.LoadSoundFromWave(wave);
+    if (sound.stream.buffer == null) return error.sound_load_failed;
+
+    return sound;
+}
+
+///////////////
+//  Writing  //
+///////////////
+
+/// Pack writer, payloads are written as they are added and the index at the end
+pub const AssetPackWriter = struct {
+    file: std.fs.File,
+    offset: u64,
+    index: std.ArrayList(u8),
+    entry_count: u32 = 0,
+    names: std.StringHashMap(void),
+
+    pub fn init(file_name: []const u8) !AssetPackWriter {
+        const file = try std.fs.cwd().createFile(file_name, .{ .truncate = true });
+        errdefer file.close();
+
+        // Header is written last, when the index is known
+        try file.writeAll(&([_]u8{0} ** @sizeOf(AssetPackHeader)));
+
+        return AssetPackWriter{
+            .file = file,
+            .offset = @sizeOf(AssetPackHeader),
+            .index = std.ArrayList(u8).init(allocator),
+            .names = std.StringHashMap(void).init(allocator),
+        };
+    }
+
+    pub fn deinit(self: *AssetPackWriter) void {
+        var it = self.names.keyIterator();
+        while (it.next()) |name| allocator.free(name.*);
+        self.names.deinit();
+        self.index.deinit();
+        self.file.close();
+    }
+
+    fn pad(self: *AssetPackWriter, alignment: usize) !void {
+        const aligned = align_forward(@intCast(self.offset), alignment);
+        const zeros = [_]u8{0} ** ASSET_PACK_ALIGNMENT;
+        if (aligned > self.offset) {
+            try self.file.writeAll(zeros[0 .. aligned - @as(usize, @intCast(self.offset))]);
+            self.offset = aligned;
+        }
+    }
+
+    fn write(self: *AssetPackWriter, data: []const u8) !void {
+        try self.pad(ASSET_DATA_ALIGNMENT);
+        try self.file.writeAll(data);
+        self.offset += data.len;
+    }
+
+    fn begin(self: *AssetPackWriter, name: []const u8) !u64 {
+        if (name.len == 0 or self.names.contains(name)) return error.invalid_asset_name;
+        try self.pad(ASSET_PACK_ALIGNMENT);
+        return self.offset;
+    }
+
+    fn end(self: *AssetPackWriter, name: []const u8, asset_type: AssetType, start: u64) !void {
+        const name_copy = try allocator.dupe(u8, name);
+        errdefer allocator.free(name_copy);
+        try self.names.put(name_copy, {});
+
+        const entry = AssetIndexEntry{
+            .asset_type = @intFromEnum(asset_type),
+            .name_length = @intCast(name.len),
+            .offset = start,
+            .size = self.offset - start,
+        };
+        try self.index.appendSlice(std.mem.asBytes(&entry));
+        try self.index.appendSlice(name);
+        try self.index.appendNTimes(0, align_forward(self.index.items.len, 8) - self.index.items.len);
+
+        self.entry_count += 1;
+    }
+
+    /// Add an image as a texture (format and mipmaps must be final)
+    pub fn add_texture(self: *AssetPackWriter, name: []const u8, image: rl.Image, data_size: usize) !void {
+        if (image.data == null or data_size == 0) return error.invalid_asset;
+
+        const start = try self.begin(name);
+
+        const header = AssetTextureHeader{
+            .width = image.width,
+            .height = image.height,
+            .mipmaps = image.mipmaps,
+            .format = image.format,
+            .data_size = data_size,
+        };
+        try self.write(std.mem.asBytes(&header));
+        try self.write(@as([*]const u8, @ptrCast(image.data))[0..data_size]);
+
+        try self.end(name, .texture, start);
+    }
+
+    pub fn add_mesh(self: *AssetPackWriter, name: []const u8, mesh: rl.Mesh) !void {
+        if (mesh.vertices == null or mesh.vertexCount <= 0) return error.invalid_asset;
+
+        const start = try self.begin(name);
+
+        var attributes: u32 = ASSET_MESH_VERTICES;
+        if (mesh.texcoords != null) attributes |= ASSET_MESH_TEXCOORDS;
+        if (mesh.texcoords2 != null) attributes |= ASSET_MESH_TEXCOORDS2;
+        if (mesh.normals != null) attributes |= ASSET_MESH_NORMALS;
+        if (mesh.tangents != null) attributes |= ASSET_MESH_TANGENTS;
+        if (mesh.colors != null) attributes |= ASSET_MESH_COLORS;
+        if (mesh.indices != null) attributes |= ASSET_MESH_INDICES;
+
+        const header = AssetMeshHeader{
+            .vertex_count = mesh.vertexCount,
+            .triangle_count = mesh.triangleCount,
+            .attributes = attributes,
+        };
+        try self.write(std.mem.asBytes(&header));
+
+        const vertex_count: usize = @intCast(mesh.vertexCount);
+        const triangle_count: usize = @intCast(mesh.triangleCount);
+
+        for (mesh_attributes) |attribute| {
+            if (attributes & attribute == 0) continue;
+
+            const size = mesh_attribute_size(attribute) * (if (attribute == ASSET_MESH_INDICES) triangle_count else vertex_count);
+            const ptr: [*]const u8 = switch (attribute) {
+                ASSET_MESH_VERTICES => @ptrCast(mesh.vertices),
+                ASSET_MESH_TEXCOORDS => @ptrCast(mesh.texcoords),
+                ASSET_MESH_TEXCOORDS2 => @ptrCast(mesh.texcoords2),
+                ASSET_MESH_NORMALS => @ptrCast(mesh.normals),
+                ASSET_MESH_TANGENTS => @ptrCast(mesh.tangents),
+                ASSET_MESH_COLORS => @ptrCast(mesh.colors),
+                ASSET_MESH_INDICES => @ptrCast(mesh.indices),
+                else => unreachable,
+            };
+            try self.write(ptr[0..size]);
+        }
+
+        try self.end(name, .mesh, start);
+    }
+
+    /// Add a font with its atlas image (format must be final)
+    pub fn add_font(self: *AssetPackWriter, name: []const u8, font: rl.Font, atlas: rl.Image, atlas_data_size: usize) !void {
+        if (font.glyphCount <= 0 or font.recs == null or font.glyphs == null or atlas.data == null) return error.invalid_asset;
+
+        const start = try self.begin(name);
+
+        const header = AssetFontHeader{
+            .base_size = font.baseSize,
+            .glyph_count = font.glyphCount,
+            .glyph_padding = font.glyphPadding,
+            .atlas = AssetTextureHeader{
+                .width = atlas.width,
+                .height = atlas.height,
+                .mipmaps = atlas.mipmaps,
+                .format = atlas.format,
+                .data_size = atlas_data_size,
+            },
+        };
+        try self.write(std.mem.asBytes(&header));
+        try self.write(@as([*]const u8, @ptrCast(atlas.data))[0..atlas_data_size]);
+
+        const glyph_count: usize = @intCast(font.glyphCount);
+        try self.write(std.mem.sliceAsBytes(font.recs[0..glyph_count]));
+
+        try self.pad(ASSET_DATA_ALIGNMENT);
+        for (font.glyphs[0..glyph_count]) |glyph| {
+            const value = AssetGlyph{
+                .value = glyph.value,
+                .offset_x = glyph.offsetX,
+                .offset_y = glyph.offsetY,
+                .advance_x = glyph.advanceX,
+            };
+            try self.file.writeAll(std.mem.asBytes(&value));
+            self.offset += @sizeOf(AssetGlyph);
+        }
+
+        try self.end(name, .font, start);
+    }
+
+    pub fn add_sound(self: *AssetPackWriter, name: []const u8, wave: rl.Wave, data_size: usize) !void {
+        if (wave.data == null) return error.invalid_asset;
+
+        const start = try self.begin(name);
+
+        const header = AssetSoundHeader{
+            .frame_count = wave.frameCount,
+            .sample_rate = wave.sampleRate,
+            .sample_size = wave.sampleSize,
+            .channels = wave.channels,
+            .data_size = data_size,
+        };
+        try self.write(std.mem.asBytes(&header));
+        try self.write(@as([*]const u8, @ptrCast(wave.data))[0..data_size]);
+
+        try self.end(name, .sound, start);
+    }
+
+    /// Write the index and the header
+    pub fn finish(self: *AssetPackWriter) !void {
+        try self.pad(ASSET_PACK_ALIGNMENT);
+        const index_offset = self.offset;
+        try self.file.writeAll(self.index.items);
+
+        const header = AssetPackHeader{
+            .entry_count = self.entry_count,
+            .index_offset = index_offset,
+            .index_size = self.index.items.len,
+        };
+        try self.file.pwriteAll(std.mem.asBytes(&header), 0);
+    }
+};
@@ -0,0 +1,290 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+const utils = @import("./utils.zig");
+
+pub const allocator = rl.allocator;
+
+/// Vertices a recording can hold when no capacity is given
+pub const DISPLAY_LIST_DEFAULT_MAX_VERTICES = 64 * 1024;
+
+/// Consecutive vertices drawn with the same mode and texture (one rlgl draw call)
+const Segment = struct {
+    mode: c_int,
+    texture_id: c_uint,
+    first: usize,
+    count: usize,
+    /// Static buffer of the triangles (quads split in two), lines are always replayed through the batch
+    mesh: ?rl.Mesh = null,
+};
+
+/// Draw calls recorded from the rlgl batch, replayed without decoding or tessellating again
+pub const DisplayList = struct {
+    /// 3 floats per vertex, transformed by the matrix active when recorded
+    vertices: []f32,
+    /// 2 floats per vertex
+    texcoords: []f32,
+    /// 4 bytes per vertex
+    colors: []u8,
+    segments: []Segment,
+
+    pub fn get_vertex_count(self: *const DisplayList) usize {
+        return self.colors.len / 4;
+    }
+
+    pub fn get_static_segment_count(self: *const DisplayList) usize {
+        var count: usize = 0;
+        for (self.segments) |segment| {
+            if (segment.mesh != null) count += 1;
+        }
+        return count;
+    }
+
+    /// Release the CPU memory, the static buffers must be unloaded before
+    pub fn deinit(self: *DisplayList) void {
+        allocator.free(self.vertices);
+        allocator.free(self.texcoords);
+        allocator.free(self.colors);
+        allocator.free(self.segments);
+        allocator.destroy(self);
+    }
+
+    /// Release the static buffers
+    pub fn unload(self: *DisplayList) void {
+        for (self.segments) |*segment| {
+            if (segment.mesh) |mesh| rl.UnloadMesh(mesh);
+            segment.mesh = null;
+        }
+    }
+
+    /// Move the triangles of each segment to a static mesh
+    fn upload(self: *DisplayList) !void {
+        errdefer self.unload();
+
+        for (self.segments) |*segment| {
+            const quads = segment.mode == rl.RL_QUADS;
+            if (!quads and segment.mode != rl.RL_TRIANGLES) continue;
+
+            const count = if (quads) segment.count / 4 * 6 else segment.count;
+            if (count == 0) continue;
+
+            // Freed by UnloadMesh
+            var mesh = std.mem.zeroes(rl.Mesh);
+            mesh.vertexCount = @intCast(count);
+            mesh.triangleCount = @intCast(count / 3);
+            mesh.vertices = @ptrCast(@alignCast(rl.MemAlloc(@intCast(count * 3 * @sizeOf(f32))) orelse return error.OutOfMemory));
+            mesh.texcoords = @ptrCast(@alignCast(rl.MemAlloc(@intCast(count * 2 * @sizeOf(f32))) orelse {
+                rl.UnloadMesh(mesh);
+                return error.OutOfMemory;
+            }));
+            mesh.colors = @ptrCast(rl.MemAlloc(@intCast(count * 4)) orelse {
+                rl.UnloadMesh(mesh);
+                return error.OutOfMemory;
+            });
+
+            // Same triangles as the rlgl quad indices (0, 1, 2, 0, 2, 3)
+            const quad_order = [_]usize{ 0, 1, 2, 0, 2, 3 };
+            for (0..count) |i| {
+                const source = segment.first + (if (quads) i / 6 * 4 + quad_order[i % 6] else i);
+                @memcpy(mesh.vertices[i * 3 ..][0..3], self.vertices[source * 3 ..][0..3]);
+                @memcpy(mesh.texcoords[i * 2 ..][0..2], self.texcoords[source * 2 ..][0..2]);
+                @memcpy(mesh.colors[i * 4 ..][0..4], self.colors[source * 4 ..][0..4]);
+            }
+
+            rl.UploadMesh(&mesh, false);
+            segment.mesh = mesh;
+        }
+    }
+
+    /// Draw the recorded calls under a transform with a tint
+    ///
+    /// NOTE: Must be called on the drawing thread
+    pub fn draw(self: *const DisplayList, transform: rl.Matrix, tint: rl.Color) void {
+        const matf = rl.MatrixToFloat(transform);
+
+        for (self.segments) |segment| {
+            if (segment.mesh) |mesh| {
+                draw_mesh(mesh, segment.texture_id, transform, tint);
+                continue;
+            }
+
+            rl.rlPushMatrix();
+            rl.rlMultMatrixf(&matf);
+            self.draw_segment(segment, tint);
+            rl.rlPopMatrix();
+        }
+
+        rl.rlSetTexture(0);
+    }
+
+    fn draw_segment(self: *const DisplayList, segment: Segment, tint: rl.Color) void {
+        const primitive_size: usize = switch (segment.mode) {
+            rl.RL_LINES => 2,
+            rl.RL_TRIANGLES => 3,
+            else => 4,
+        };
+
+        // Leave room for one primitive, rlgl checks the limit before accepting a vertex
+        const batch_vertices: usize = rl.RL_DEFAULT_BATCH_BUFFER_ELEMENTS * 4;
+        const chunk_vertices: usize = ((batch_vertices - primitive_size) / primitive_size) * primitive_size;
+
+        const tinted = tint.r != 255 or tint.g != 255 or tint.b != 255 or tint.a != 255;
+
+        rl.rlSetTexture(segment.texture_id);
+
+        var first = segment.first;
+        const end = segment.first + segment.count;
+        while (first < end) {
+            const count = @min(chunk_vertices, end - first);
+
+            _ = rl.rlCheckRenderBatchLimit(@intCast(count));
+
+            rl.rlBegin(segment.mode);
+
+            for (first..first + count) |i| {
+                const color = self.colors[i * 4 ..][0..4];
+                if (tinted) {
+                    rl.rlColor4ub(tint_channel(color[0], tint.r), tint_channel(color[1], tint.g), tint_channel(color[2], tint.b), tint_channel(color[3], tint.a));
+                } else {
+                    rl.rlColor4ub(color[0], color[1], color[2], color[3]);
+                }
+                rl.rlTexCoord2f(self.texcoords[i * 2], self.texcoords[i * 2 + 1]);
+                rl.rlVertex3f(self.vertices[i * 3], self.vertices[i * 3 + 1], self.vertices[i * 3 + 2]);
+            }
+
+            rl.rlEnd();
+
+            first += count;
+        }
+    }
+};
+
+fn tint_channel(value: u8, tint: u8) u8 {
+    return @intCast((@as(u16, value) * tint + 127) / 255);
+}
+
+fn draw_mesh(mesh: rl.Mesh, texture_id: c_uint, transform: rl.Matrix, tint: rl.Color) void {
+    // The batch is drawn first to keep the order
+    rl.rlDrawRenderBatchActive();
+
+    var maps = std.mem.zeroes([rl.MAX_MATERIAL_MAPS]rl.MaterialMap);
+    maps[rl.MATERIAL_MAP_DIFFUSE].texture.id = texture_id;
+    maps[rl.MATERIAL_MAP_DIFFUSE].color = tint;
+
+    const material = rl.Material{
+        .shader = .{ .id = rl.rlGetShaderIdDefault(), .locs = rl.rlGetShaderLocsDefault() },
+        .maps = &maps,
+        .params = .{ 0.0, 0.0, 0.0, 0.0 },
+    };
+
+    rl.DrawMesh(mesh, material, transform);
+}
+
+/////////////////
+//  Recording  //
+/////////////////
+
+/// Batch receiving the draw calls between begin_record and end_record
+var recording: ?rl.rlRenderBatch = null;
+
+/// Mode of the last draw call of the recording batch, rlgl only writes that draw call when flushing the batch
+const flushed_draw = rl.RL_DEFAULT_BATCH_DRAWCALLS - 1;
+const flushed_mode_unset: c_int = -1;
+
+/// Send the following draw calls to a new batch instead of the screen
+///
+/// NOTE: Any flush of the batch (past max_vertices, 256 texture and mode changes, scissor, blend mode, mode end, mesh draws)
+/// draws the vertices recorded so far to the screen, end_record then fails
+pub fn BeginDisplayListRecord(max_vertices: usize) !void {
+    if (recording != null) return error.display_list_already_recording;
+
+    const elements = std.math.divCeil(usize, @max(max_vertices, 4), 4) catch unreachable;
+    const batch = rl.rlLoadRenderBatch(1, @intCast(elements));
+    if (batch.vertexBuffer == null or batch.draws == null) return error.display_list_batch_load_failed;
+
+    batch.draws[flushed_draw].mode = flushed_mode_unset;
+
+    recording = batch;
+    rl.rlSetRenderBatchActive(&recording.?);
+}
+
+/// Stop recording and return the draw calls recorded, with the triangles in static buffers when upload_static is set
+///
+/// Returns error.display_list_batch_flushed when the batch was flushed during the recording, the draw calls before the flush were drawn
+pub fn EndDisplayListRecord(upload_static: bool) !*DisplayList {
+    if (recording == null) return error.display_list_not_recording;
+    const batch = &recording.?;
+
+    defer {
+        // Deactivating the batch flushes it, the vertex counts are cleared to draw nothing
+        for (batch.draws[0..@intCast(batch.drawCounter)]) |*draw_call| draw_call.vertexCount = 0;
+
+        rl.rlSetRenderBatchActive(null);
+        rl.rlUnloadRenderBatch(batch.*);
+        recording = null;
+    }
+
+    if (batch.draws[flushed_draw].mode != flushed_mode_unset) return error.display_list_batch_flushed;
+
+    const draws = batch.draws[0..@intCast(batch.drawCounter)];
+    const buffer = batch.vertexBuffer[0];
+
+    var vertex_count: usize = 0;
+    var segment_count: usize = 0;
+    for (draws) |draw_call| {
+        if (draw_call.vertexCount <= 0) continue;
+        vertex_count += @intCast(draw_call.vertexCount);
+        segment_count += 1;
+    }
+
+    const self = try allocator.create(DisplayList);
+    errdefer allocator.destroy(self);
+
+    self.vertices = try allocator.alloc(f32, vertex_count * 3);
+    errdefer allocator.free(self.vertices);
+    self.texcoords = try allocator.alloc(f32, vertex_count * 2);
+    errdefer allocator.free(self.texcoords);
+    self.colors = try allocator.alloc(u8, vertex_count * 4);
+    errdefer allocator.free(self.colors);
+    self.segments = try allocator.alloc(Segment, segment_count);
+    errdefer allocator.free(self.segments);
+
+    // Draw calls are contiguous in the vertex buffer, followed by their alignment padding
+    var offset: usize = 0;
+    var written: usize = 0;
+    var segment_index: usize = 0;
+    for (draws) |draw_call| {
+        const count: usize = @intCast(@max(draw_call.vertexCount, 0));
+
+        if (count > 0) {
+            @memcpy(self.vertices[written * 3 ..][0 .. count * 3], buffer.vertices[offset * 3 ..][0 .. count * 3]);
+            @memcpy(self.texcoords[written * 2 ..][0 .. count * 2], buffer.texcoords[offset * 2 ..][0 .. count * 2]);
+            @memcpy(self.colors[written * 4 ..][0 .. count * 4], buffer.colors[offset * 4 ..][0 .. count * 4]);
+
+            self.segments[segment_index] = .{
+                .mode = draw_call.mode,
+                .texture_id = draw_call.textureId,
+                .first = written,
+                .count = count,
+            };
+            segment_index += 1;
+            written += count;
+        }
+
+        offset += count + @as(usize, @intCast(@max(draw_call.vertexAlignment, 0)));
+    }
+
+    if (upload_static) try self.upload();
+
+    utils.TRACELOG(rl.LOG_INFO, "DISPLAY LIST: Recorded %i vertices in %i draw calls", .{ @as(c_int, @intCast(vertex_count)), @as(c_int, @intCast(segment_count)) });
+
+    return self;
+}
+
+/// Check if draw calls are being recorded
+pub fn IsDisplayListRecording() bool {
+    return recording != null;
+}
+
+pub fn UnloadDisplayList(list: *DisplayList) void {
+    list.unload();
+}
@@ -33,7 +33,7 @@ fn raw_beam_alloc(
     _: usize,
 ) ?[*]u8 {
     if (ptr_align.toByteUnits() > MAX_ALIGN) return null;
-    const ptr = nif_allocator.nif_alloc(len) orelse return null;
+    const ptr = nif_allocator.alloc(.zig, len) orelse return null;
     return @as([*]u8, @ptrCast(ptr));
 }
 
@@ -46,7 +46,7 @@ fn raw_beam_resize(
 ) bool {
     if (new_len <= buf.len) return true;
     if (new_len == 0) {
-        nif_allocator.nif_free(buf.ptr);
+        nif_allocator.free(buf.ptr);
         return true;
     }
     // We are never able to increase the size of a pointer.
@@ -61,7 +61,7 @@ fn raw_beam_remap(
     _: usize,
 ) ?[*]u8 {
     if (ptr_align.toByteUnits() > MAX_ALIGN) return null;
-    const ptr = nif_allocator.nif_realloc(@ptrCast(buf), new_len) orelse return null;
+    const ptr = nif_allocator.realloc(.zig, @ptrCast(buf), new_len) orelse return null;
     return @as([*]u8, @ptrCast(ptr));
 }
 
@@ -71,5 +71,5 @@ fn raw_beam_free(
     _: std.mem.Alignment,
     _: usize,
 ) void {
-    nif_allocator.nif_free(buf.ptr);
+    nif_allocator.free(buf.ptr);
 }
@@ -0,0 +1,324 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const rl = @import("./raylib.zig");
+
+const build_config = @import("config");
+
+pub const allocator = rl.allocator;
+
+/// GLFW is only reachable with the desktop GLFW platform backend
+pub const is_supported = build_config.platform_glfw;
+
+const glfw = if (is_supported) @cImport({
+    @cDefine("GLFW_INCLUDE_NONE", "1");
+    @cInclude("external/glfw/include/GLFW/glfw3.h");
+}) else struct {};
+
+/// Event types (bit mask)
+pub const EVENT_KEY: c_uint = 0x001;
+pub const EVENT_CHAR: c_uint = 0x002;
+pub const EVENT_MOUSE_BUTTON: c_uint = 0x004;
+pub const EVENT_MOUSE_MOVE: c_uint = 0x008;
+pub const EVENT_MOUSE_WHEEL: c_uint = 0x010;
+pub const EVENT_GAMEPAD: c_uint = 0x020;
+pub const EVENT_RESIZE: c_uint = 0x040;
+pub const EVENT_FOCUS: c_uint = 0x080;
+pub const EVENT_FILE_DROP: c_uint = 0x100;
+pub const EVENT_CLOSE: c_uint = 0x200;
+pub const EVENT_ALL: c_uint = 0x3FF;
+
+/// Number of events the queue can hold before dropping (power of two)
+pub const EVENT_QUEUE_CAPACITY: usize = 1024;
+
+/// Key and mouse button actions (same values as GLFW)
+pub const EVENT_ACTION_RELEASE: c_int = 0;
+pub const EVENT_ACTION_PRESS: c_int = 1;
+pub const EVENT_ACTION_REPEAT: c_int = 2;
+
+pub const EventType = enum(u8) {
+    key,
+    char,
+    mouse_button,
+    mouse_move,
+    mouse_wheel,
+    gamepad,
+    resize,
+    focus,
+    file_drop,
+    close,
+};
+
+/// Window or input event
+///
+/// - key: a = key, b = scancode, c = action, d = modifiers
+/// - char: a = codepoint
+/// - mouse_button: a = button, c = action, d = modifiers
+/// - mouse_move: x, y = position
+/// - mouse_wheel: x, y = offset
+/// - gamepad: a = gamepad, c = 1 (connected) or 0 (disconnected)
+/// - resize: a = width, b = height
+/// - focus: c = 1 (focused) or 0
+/// - file_drop: paths (owned by the event, see deinit())
+/// - close
+pub const Event = struct {
+    event_type: EventType,
+    a: c_int = 0,
+    b: c_int = 0,
+    c: c_int = 0,
+    d: c_int = 0,
+    x: f64 = 0.0,
+    y: f64 = 0.0,
+    paths: ?[][:0]u8 = null,
+
+    pub fn deinit(self: *Event) void {
+        if (self.paths) |paths| {
+            for (paths) |path| allocator.free(path);
+            allocator.free(paths);
+            self.paths = null;
+        }
+    }
+};
+
+/// Lock-free ring of events with one producer (GLFW callbacks) and one consumer
+///
+/// NOTE: The callbacks run on the thread processing the window events (PollInputEvents() or
+/// WaitEvents()), events of a window must only be processed by the process owning it
+pub const EventQueue = struct {
+    buffer: [EVENT_QUEUE_CAPACITY]Event = undefined,
+    head: std.atomic.Value(usize) = std.atomic.Value(usize).init(0), // Next event to read
+    tail: std.atomic.Value(usize) = std.atomic.Value(usize).init(0), // Next slot to write
+    dropped: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+
+    /// Wakes the consumer when events are pushed
+    signal: std.Thread.ResetEvent = .{},
+
+    pub fn push(self: *EventQueue, event: Event) bool {
+        const tail = self.tail.load(.monotonic);
+        const head = self.head.load(.acquire);
+
+        if (tail -% head >= EVENT_QUEUE_CAPACITY) {
+            _ = self.dropped.fetchAdd(1, .monotonic);
+            return false;
+        }
+
+        self.buffer[tail & (EVENT_QUEUE_CAPACITY - 1)] = event;
+        self.tail.store(tail +% 1, .release);
+
+        self.signal.set();
+
+        return true;
+    }
+
+    pub fn pop(self: *EventQueue) ?Event {
+        const head = self.head.load(.monotonic);
+        const tail = self.tail.load(.acquire);
+
+        if (head == tail) return null;
+
+        const event = self.buffer[head & (EVENT_QUEUE_CAPACITY - 1)];
+        self.head.store(head +% 1, .release);
+
+        return event;
+    }
+
+    /// Drop the pending events
+    pub fn clear(self: *EventQueue) void {
+        while (self.pop()) |event| {
+            var pending = event;
+            pending.deinit();
+        }
+    }
+};
+
+pub var queue = EventQueue{};
+
+/// Event types pushed to the queue (0 when not subscribed)
+var event_mask = std.atomic.Value(c_uint).init(0);
+
+fn Push(event_type: c_uint, event: Event) void {
+    if (event_mask.load(.monotonic) & event_type == 0) return;
+
+    var pushed = event;
+    if (!queue.push(pushed)) pushed.deinit();
+}
+
+//////////////////////
+//  GLFW callbacks  //
+//////////////////////
+
+/// Callbacks set by raylib, called before pushing the event so the raylib input state stays updated
+const PreviousCallbacks = if (is_supported) struct {
+    key: glfw.GLFWkeyfun = null,
+    char: glfw.GLFWcharfun = null,
+    mouse_button: glfw.GLFWmousebuttonfun = null,
+    cursor_pos: glfw.GLFWcursorposfun = null,
+    scroll: glfw.GLFWscrollfun = null,
+    joystick: glfw.GLFWjoystickfun = null,
+    window_size: glfw.GLFWwindowsizefun = null,
+    window_focus: glfw.GLFWwindowfocusfun = null,
+    drop: glfw.GLFWdropfun = null,
+    window_close: glfw.GLFWwindowclosefun = null,
+} else struct {};
+
+var previous = PreviousCallbacks{};
+var hooked_window: ?*anyopaque = null;
+
+const callbacks = if (is_supported) struct {
+    fn KeyCallback(window: ?*glfw.GLFWwindow, key: c_int, scancode: c_int, action: c_int, mods: c_int) callconv(.C) void {
+        if (previous.key) |callback| callback(window, key, scancode, action, mods);
+        Push(EVENT_KEY, .{ .event_type = .key, .a = key, .b = scancode, .c = action, .d = mods });
+    }
+
+    fn CharCallback(window: ?*glfw.GLFWwindow, codepoint: c_uint) callconv(.C) void {
+        if (previous.char) |callback| callback(window, codepoint);
+        Push(EVENT_CHAR, .{ .event_type = .char, .a = @bitCast(codepoint) });
+    }
+
+    fn MouseButtonCallback(window: ?*glfw.GLFWwindow, button: c_int, action: c_int, mods: c_int) callconv(.C) void {
+        if (previous.mouse_button) |callback| callback(window, button, action, mods);
+        Push(EVENT_MOUSE_BUTTON, .{ .event_type = .mouse_button, .a = button, .c = action, .d = mods });
+    }
+
+    fn CursorPosCallback(window: ?*glfw.GLFWwindow, x: f64, y: f64) callconv(.C) void {
+        if (previous.cursor_pos) |callback| callback(window, x, y);
+        Push(EVENT_MOUSE_MOVE, .{ .event_type = .mouse_move, .x = x, .y = y });
+    }
+
+    fn ScrollCallback(window: ?*glfw.GLFWwindow, x: f64, y: f64) callconv(.C) void {
+        if (previous.scroll) |callback| callback(window, x, y);
+        Push(EVENT_MOUSE_WHEEL, .{ .event_type = .mouse_wheel, .x = x, .y = y });
+    }
+
+    fn JoystickCallback(jid: c_int, event: c_int) callconv(.C) void {
+        if (previous.joystick) |callback| callback(jid, event);
+        Push(EVENT_GAMEPAD, .{ .event_type = .gamepad, .a = jid, .c = @intFromBool(event == glfw.GLFW_CONNECTED) });
+    }
+
+    fn WindowSizeCallback(window: ?*glfw.GLFWwindow, width: c_int, height: c_int) callconv(.C) void {
+        if (previous.window_size) |callback| callback(window, width, height);
+        Push(EVENT_RESIZE, .{ .event_type = .resize, .a = width, .b = height });
+    }
+
+    fn WindowFocusCallback(window: ?*glfw.GLFWwindow, focused: c_int) callconv(.C) void {
+        if (previous.window_focus) |callback| callback(window, focused);
+        Push(EVENT_FOCUS, .{ .event_type = .focus, .c = @intFromBool(focused == glfw.GLFW_TRUE) });
+    }
+
+    fn DropCallback(window: ?*glfw.GLFWwindow, count: c_int, paths: [*c][*c]const u8) callconv(.C) void {
+        if (previous.drop) |callback| callback(window, count, paths);
+        if (event_mask.load(.monotonic) & EVENT_FILE_DROP == 0) return;
+
+        const len: usize = @intCast(@max(count, 0));
+
+        const copies = allocator.alloc([:0]u8, len) catch return;
+        var copied: usize = 0;
+
+        for (0..len) |i| {
+            copies[i] = allocator.dupeZ(u8, std.mem.span(paths[i])) catch {
+                for (copies[0..copied]) |copy| allocator.free(copy);
+                allocator.free(copies);
+                return;
+            };
+            copied += 1;
+        }
+
+        Push(EVENT_FILE_DROP, .{ .event_type = .file_drop, .paths = copies });
+    }
+
+    fn WindowCloseCallback(window: ?*glfw.GLFWwindow) callconv(.C) void {
+        if (previous.window_close) |callback| callback(window);
+        Push(EVENT_CLOSE, .{ .event_type = .close });
+    }
+} else struct {};
+
+/// Start pushing the events selected by the mask to the queue
+///
+/// NOTE: The window must be initialized, the callbacks are installed on top of the raylib ones
+/// (call it again after the window is re-created)
+pub fn Subscribe(mask: c_uint) !void {
+    if (comptime !is_supported) return error.runtime_events_not_supported else try SubscribeGlfw(mask);
+}
+
+fn SubscribeGlfw(mask: c_uint) !void {
+    if (!rl.IsWindowReady()) return error.runtime_window_not_ready;
+
+    const handle = rl.GetWindowHandle();
+    const window: ?*glfw.GLFWwindow = @ptrCast(handle);
+
+    // A re-created window can get the same handle, the key callback tells if it is still hooked
+    const key_callback = glfw.glfwSetKeyCallback(window, &callbacks.KeyCallback);
+
+    if (hooked_window != handle or key_callback != @as(glfw.GLFWkeyfun, &callbacks.KeyCallback)) {
+        previous = PreviousCallbacks{
+            .key = key_callback,
+            .char = glfw.glfwSetCharCallback(window, &callbacks.CharCallback),
+            .mouse_button = glfw.glfwSetMouseButtonCallback(window, &callbacks.MouseButtonCallback),
+            .cursor_pos = glfw.glfwSetCursorPosCallback(window, &callbacks.CursorPosCallback),
+            .scroll = glfw.glfwSetScrollCallback(window, &callbacks.ScrollCallback),
+            .joystick = glfw.glfwSetJoystickCallback(&callbacks.JoystickCallback),
+            .window_size = glfw.glfwSetWindowSizeCallback(window, &callbacks.WindowSizeCallback),
+            .window_focus = glfw.glfwSetWindowFocusCallback(window, &callbacks.WindowFocusCallback),
+            .drop = glfw.glfwSetDropCallback(window, &callbacks.DropCallback),
+            .window_close = glfw.glfwSetWindowCloseCallback(window, &callbacks.WindowCloseCallback),
+        };
+        hooked_window = handle;
+    }
+
+    event_mask.store(mask & EVENT_ALL, .monotonic);
+}
+
+/// Stop pushing events and restore the raylib callbacks
+pub fn Unsubscribe() void {
+    event_mask.store(0, .monotonic);
+
+    if (comptime !is_supported) return else UnsubscribeGlfw();
+}
+
+fn UnsubscribeGlfw() void {
+    if (hooked_window) |handle| {
+        // The callbacks are gone with the window if it was closed
+        if (rl.IsWindowReady() and rl.GetWindowHandle() == handle) {
+            const window: ?*glfw.GLFWwindow = @ptrCast(handle);
+
+            _ = glfw.glfwSetKeyCallback(window, previous.key);
+            _ = glfw.glfwSetCharCallback(window, previous.char);
+            _ = glfw.glfwSetMouseButtonCallback(window, previous.mouse_button);
+            _ = glfw.glfwSetCursorPosCallback(window, previous.cursor_pos);
+            _ = glfw.glfwSetScrollCallback(window, previous.scroll);
+            _ = glfw.glfwSetJoystickCallback(previous.joystick);
+            _ = glfw.glfwSetWindowSizeCallback(window, previous.window_size);
+            _ = glfw.glfwSetWindowFocusCallback(window, previous.window_focus);
+            _ = glfw.glfwSetDropCallback(window, previous.drop);
+            _ = glfw.glfwSetWindowCloseCallback(window, previous.window_close);
+        }
+
+        previous = PreviousCallbacks{};
+        hooked_window = null;
+    }
+}
+
+pub fn IsSubscribed() bool {
+    return event_mask.load(.monotonic) != 0;
+}
+
+/// Block until events arrive (or the timeout in seconds expires) and process them
+///
+/// NOTE: raylib input state (pressed/released) is not advanced by this call, only the callbacks run
+pub fn WaitEvents(timeout: ?f64) !void {
+    if (comptime !is_supported) return error.runtime_events_not_supported else try WaitEventsGlfw(timeout);
+}
+
+fn WaitEventsGlfw(timeout: ?f64) !void {
+    if (!rl.IsWindowReady()) return error.runtime_window_not_ready;
+
+    if (timeout) |seconds| {
+        glfw.glfwWaitEventsTimeout(@max(seconds, 0.0));
+    } else {
+        glfw.glfwWaitEvents();
+    }
+}
+
+/// Wake up WaitEvents() from another thread
+pub fn WakeEvents() !void {
+    if (comptime !is_supported) return error.runtime_events_not_supported else glfw.glfwPostEmptyEvent();
+}
@@ -0,0 +1,258 @@
+const std = @import("std");
+
+/// Frames kept for the statistics
+pub const FRAME_PACER_WINDOW = 256;
+
+/// Histogram buckets, an eighth of the target frame time each (the last one counts all the longer frames)
+pub const FRAME_PACER_HISTOGRAM_BUCKETS = 16;
+
+/// Frame times fed to the fixed timestep accumulator are clamped, a long stall must not trigger a burst of steps
+const max_accumulated_ns: u64 = 250 * std.time.ns_per_ms;
+
+/// Yielding gives the CPU away for too long below this, the end of the wait spins
+const min_yield_ns: u64 = 200 * std.time.ns_per_us;
+
+pub const Config = struct {
+    /// Frames per second to pace to, 0 for no pacing
+    target_fps: u32 = 60,
+    /// Fixed timestep updates per second, 0 for no fixed timestep
+    fixed_fps: u32 = 60,
+    /// Fixed timestep updates per frame at most, the time left is dropped
+    max_steps: u32 = 5,
+    /// Time before the deadline waited without sleeping, sleeping overshoots by up to this
+    spin_ns: u64 = 1 * std.time.ns_per_ms,
+};
+
+pub const Frame = struct {
+    /// Fixed timestep updates to run for this frame
+    steps: u32,
+    /// Fraction of a fixed timestep left in the accumulator, to interpolate between the last two states
+    alpha: f64,
+    /// Seconds since the previous frame
+    frame_time: f64,
+};
+
+pub const Stats = struct {
+    frames: u64,
+    missed: u64,
+    dropped_steps: u64,
+    /// Statistics below cover the last window_frames frames (in seconds)
+    window_frames: usize,
+    mean: f64,
+    min: f64,
+    max: f64,
+    stddev: f64,
+    /// Mean absolute deviation from the target frame time (from the mean without pacing)
+    jitter: f64,
+    p50: f64,
+    p99: f64,
+    bucket_width: f64,
+    histogram: [FRAME_PACER_HISTOGRAM_BUCKETS]u32,
+};
+
+const Pacer = struct {
+    config: Config = .{},
+    timer: ?std.time.Timer = null,
+    started: bool = false,
+    /// Timer reading the current frame must end at
+    deadline: u64 = 0,
+    last_frame: u64 = 0,
+    accumulator: u64 = 0,
+
+    frames: u64 = 0,
+    missed: u64 = 0,
+    dropped_steps: u64 = 0,
+    /// Ring of the last frame times (in nanoseconds)
+    times: [FRAME_PACER_WINDOW]u64 = undefined,
+    time_count: usize = 0,
+    time_index: usize = 0,
+
+    fn get_timer(self: *Pacer) !*std.time.Timer {
+        if (self.timer == null) self.timer = try std.time.Timer.start();
+        return &self.timer.?;
+    }
+
+    fn period_ns(self: *const Pacer) u64 {
+        if (self.config.target_fps == 0) return 0;
+        return std.time.ns_per_s / self.config.target_fps;
+    }
+
+    fn fixed_ns(self: *const Pacer) u64 {
+        if (self.config.fixed_fps == 0) return 0;
+        return std.time.ns_per_s / self.config.fixed_fps;
+    }
+
+    fn record(self: *Pacer, frame_ns: u64) void {
+        self.frames += 1;
+        self.times[self.time_index] = frame_ns;
+        self.time_index = (self.time_index + 1) % FRAME_PACER_WINDOW;
+        self.time_count = @min(self.time_count + 1, FRAME_PACER_WINDOW);
+    }
+
+    fn step(self: *Pacer, frame_ns: u64) Frame {
+        const frame_time = seconds(frame_ns);
+
+        const fixed = self.fixed_ns();
+        if (fixed == 0) return .{ .steps = 0, .alpha = 0.0, .frame_time = frame_time };
+
+        self.accumulator += @min(frame_ns, max_accumulated_ns);
+
+        var steps = self.accumulator / fixed;
+        self.accumulator -= steps * fixed;
+
+        if (steps > self.config.max_steps) {
+            self.dropped_steps += steps - self.config.max_steps;
+            steps = self.config.max_steps;
+        }
+
+        return .{
+            .steps = @intCast(steps),
+            .alpha = @as(f64, @floatFromInt(self.accumulator)) / @as(f64, @floatFromInt(fixed)),
+            .frame_time = frame_time,
+        };
+    }
+};
+
+var pacer: Pacer = .{};
+var mutex: std.Thread.Mutex = .{};
+
+fn seconds(ns: u64) f64 {
+    return @as(f64, @floatFromInt(ns)) / std.time.ns_per_s;
+}
+
+/// Sleep until spin_ns before the deadline, then yield and spin
+fn wait_until(timer: *std.time.Timer, deadline: u64, spin_ns: u64) void {
+    while (true) {
+        const now = timer.read();
+        if (now >= deadline) return;
+
+        const remaining = deadline - now;
+        if (remaining > spin_ns) {
+            std.Thread.sleep(remaining - spin_ns);
+        } else if (remaining > min_yield_ns) {
+            std.Thread.yield() catch {};
+        } else {
+            std.atomic.spinLoopHint();
+        }
+    }
+}
+
+/// Set the pacing and the fixed timestep, the next frame starts a new schedule
+pub fn SetFramePacer(config: Config) void {
+    mutex.lock();
+    defer mutex.unlock();
+
+    pacer.config = config;
+    pacer.started = false;
+    pacer.accumulator = 0;
+}
+
+/// Wait for the frame deadline and advance the fixed timestep accumulator
+///
+/// NOTE: The first frame after SetFramePacer only starts the schedule
+pub fn EndPacedFrame() !Frame {
+    mutex.lock();
+    defer mutex.unlock();
+
+    const timer = try pacer.get_timer();
+    const period = pacer.period_ns();
+
+    if (!pacer.started) {
+        pacer.started = true;
+        pacer.last_frame = timer.read();
+        pacer.deadline = pacer.last_frame + period;
+        return .{ .steps = 0, .alpha = 0.0, .frame_time = 0.0 };
+    }
+
+    if (period > 0) {
+        const now = timer.read();
+        if (now > pacer.deadline) {
+            pacer.missed += 1;
+
+            // A whole frame late, start again from now instead of rushing the next frames
+            if (now - pacer.deadline >= period) pacer.deadline = now;
+        } else {
+            wait_until(timer, pacer.deadline, pacer.config.spin_ns);
+        }
+
+        pacer.deadline += period;
+    }
+
+    const now = timer.read();
+    const frame_ns = now - pacer.last_frame;
+    pacer.last_frame = now;
+
+    pacer.record(frame_ns);
+
+    return pacer.step(frame_ns);
+}
+
+pub fn GetFramePacerStats() Stats {
+    mutex.lock();
+    defer mutex.unlock();
+
+    const period = pacer.period_ns();
+    const bucket_width: u64 = if (period > 0) period / 8 else std.time.ns_per_ms;
+
+    var stats = Stats{
+        .frames = pacer.frames,
+        .missed = pacer.missed,
+        .dropped_steps = pacer.dropped_steps,
+        .window_frames = pacer.time_count,
+        .mean = 0.0,
+        .min = 0.0,
+        .max = 0.0,
+        .stddev = 0.0,
+        .jitter = 0.0,
+        .p50 = 0.0,
+        .p99 = 0.0,
+        .bucket_width = seconds(bucket_width),
+        .histogram = [_]u32{0} ** FRAME_PACER_HISTOGRAM_BUCKETS,
+    };
+
+    const count = pacer.time_count;
+    if (count == 0) return stats;
+
+    var sorted: [FRAME_PACER_WINDOW]u64 = undefined;
+    @memcpy(sorted[0..count], pacer.times[0..count]);
+    std.mem.sort(u64, sorted[0..count], {}, std.sort.asc(u64));
+
+    var sum: f64 = 0.0;
+    for (sorted[0..count]) |time| {
+        sum += seconds(time);
+        const bucket: usize = @intCast(@min(time / @max(bucket_width, 1), FRAME_PACER_HISTOGRAM_BUCKETS - 1));
+        stats.histogram[bucket] += 1;
+    }
+
+    const n: f64 = @floatFromInt(count);
+    stats.mean = sum / n;
+    stats.min = seconds(sorted[0]);
+    stats.max = seconds(sorted[count - 1]);
+    stats.p50 = seconds(sorted[(count - 1) / 2]);
+    stats.p99 = seconds(sorted[((count - 1) * 99) / 100]);
+
+    const reference = if (period > 0) seconds(period) else stats.mean;
+    var variance: f64 = 0.0;
+    var deviation: f64 = 0.0;
+    for (sorted[0..count]) |time| {
+        const t = seconds(time);
+        variance += (t - stats.mean) * (t - stats.mean);
+        deviation += @abs(t - reference);
+    }
+    stats.stddev = @sqrt(variance / n);
+    stats.jitter = deviation / n;
+
+    return stats;
+}
+
+/// Restart the counters and the frame time window
+pub fn ResetFramePacerStats() void {
+    mutex.lock();
+    defer mutex.unlock();
+
+    pacer.frames = 0;
+    pacer.missed = 0;
+    pacer.dropped_steps = 0;
+    pacer.time_count = 0;
+    pacer.time_index = 0;
+}
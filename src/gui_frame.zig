@@ -0,0 +1,117 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+
+pub const allocator = rl.allocator;
+
+/////////////////////
+//  Control state  //
+/////////////////////
+
+/// State of a control kept between frames, keyed by the control id
+pub const ControlState = struct {
+    edit_mode: bool = false,
+    scroll_index: c_int = 0,
+    scroll: rl.Vector2 = .{},
+    view: rl.Rectangle = .{},
+    /// Text box buffer (NUL terminated, text box size)
+    text: []u8 = &.{},
+    /// Hash of the text last submitted, the buffer is reset when it changes
+    text_hash: u64 = 0,
+    last_seen: u64 = 0,
+
+    /// Use the submitted text unless it is the one the buffer was last reset to
+    pub fn sync_text(self: *ControlState, text: []const u8, size: usize) !void {
+        const hash = std.hash.Wyhash.hash(size, text);
+        if (self.text.len == size and self.text_hash == hash) return;
+
+        if (self.text.len != size) {
+            const buffer = try allocator.alloc(u8, size);
+            allocator.free(self.text);
+            self.text = buffer;
+        }
+
+        const length = @min(text.len, size - 1);
+        @memcpy(self.text[0..length], text[0..length]);
+        @memset(self.text[length..], 0);
+        self.text_hash = hash;
+    }
+
+    pub fn get_text(self: *const ControlState) []const u8 {
+        return std.mem.sliceTo(self.text, 0);
+    }
+
+    fn deinit(self: *ControlState) void {
+        allocator.free(self.text);
+    }
+};
+
+/// States not used for this number of frames are dropped
+pub const max_unseen_frames = 120;
+
+/// States keyed by the id in the external term format (owned copy), compared in full
+var states: std.StringHashMapUnmanaged(ControlState) = .{};
+var frame: u64 = 0;
+var mutex: std.Thread.Mutex = .{};
+
+/// Start a frame, the states can be used until end_frame
+pub fn begin_frame() void {
+    mutex.lock();
+    frame += 1;
+}
+
+pub fn end_frame() void {
+    defer mutex.unlock();
+
+    if (frame % max_unseen_frames != 0) return;
+
+    // Collected by chunks, the map cannot change while it is iterated
+    var stale: [64][]const u8 = undefined;
+    while (true) {
+        var stale_count: usize = 0;
+
+        var it = states.iterator();
+        while (it.next()) |entry| {
+            if (frame - entry.value_ptr.last_seen < max_unseen_frames) continue;
+            stale[stale_count] = entry.key_ptr.*;
+            stale_count += 1;
+            if (stale_count == stale.len) break;
+        }
+
+        for (stale[0..stale_count]) |id| {
+            var kv = states.fetchRemove(id) orelse continue;
+            kv.value.deinit();
+            allocator.free(kv.key);
+        }
+
+        if (stale_count < stale.len) break;
+    }
+}
+
+/// Get the state of a control (created on first use), id is the control id in the external term format
+///
+/// NOTE: The pointer is invalidated by the next get
+pub fn get(id: []const u8) !*ControlState {
+    const entry = try states.getOrPut(allocator, id);
+    if (!entry.found_existing) {
+        entry.key_ptr.* = allocator.dupe(u8, id) catch |err| {
+            states.removeByPtr(entry.key_ptr);
+            return err;
+        };
+        entry.value_ptr.* = .{};
+    }
+    entry.value_ptr.last_seen = frame;
+    return entry.value_ptr;
+}
+
+/// Drop all the states (text box buffers, scroll positions, edit modes)
+pub fn reset() void {
+    mutex.lock();
+    defer mutex.unlock();
+
+    var it = states.iterator();
+    while (it.next()) |entry| {
+        entry.value_ptr.deinit();
+        allocator.free(entry.key_ptr.*);
+    }
+    states.clearAndFree(allocator);
+}
@@ -0,0 +1,573 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const rl = @import("./raylib.zig");
+
+pub const allocator = rl.allocator;
+
+/// Number of decoded frames kept by default
+pub const IMAGE_ANIM_RING_SIZE_DEFAULT: usize = 2;
+pub const IMAGE_ANIM_RING_SIZE_MAX: usize = 16;
+
+const GIF_MAX_CODE_SIZE = 12;
+const GIF_MAX_CODES = 1 << GIF_MAX_CODE_SIZE;
+
+/// GIF disposal methods
+const GIF_DISPOSAL_BACKGROUND: u8 = 2;
+const GIF_DISPOSAL_PREVIOUS: u8 = 3;
+
+/// Frame located by the first pass over the file (nothing decoded)
+const GifFrame = struct {
+    offset: usize, // Offset of the image descriptor
+    left: usize,
+    top: usize,
+    width: usize,
+    height: usize,
+    delay: c_uint, // Milliseconds
+    disposal: u8,
+    transparent: ?u8,
+};
+
+/// Bounds checked reader over the file data
+const GifReader = struct {
+    data: []const u8,
+    pos: usize = 0,
+
+    fn byte(self: *GifReader) !u8 {
+        if (self.pos >= self.data.len) return error.invalid_gif;
+        const value = self.data[self.pos];
+        self.pos += 1;
+        return value;
+    }
+
+    fn word(self: *GifReader) !u16 {
+        const lo = try self.byte();
+        const hi = try self.byte();
+        return @as(u16, lo) | (@as(u16, hi) << 8);
+    }
+
+    fn bytes(self: *GifReader, len: usize) ![]const u8 {
+        if (self.data.len - self.pos < len) return error.invalid_gif;
+        const value = self.data[self.pos .. self.pos + len];
+        self.pos += len;
+        return value;
+    }
+
+    fn skip_sub_blocks(self: *GifReader) !void {
+        while (true) {
+            const len = try self.byte();
+            if (len == 0) break;
+            _ = try self.bytes(len);
+        }
+    }
+};
+
+/// Bit reader over the LZW sub-blocks of a frame
+const GifCodeReader = struct {
+    reader: *GifReader,
+    block_remaining: usize = 0,
+    ended: bool = false,
+    bits: u32 = 0,
+    bit_count: u5 = 0,
+
+    fn next_byte(self: *GifCodeReader) ?u8 {
+        if (self.ended) return null;
+
+        if (self.block_remaining == 0) {
+            const len = self.reader.byte() catch 0;
+            if (len == 0) {
+                self.ended = true;
+                return null;
+            }
+            self.block_remaining = len;
+        }
+
+        self.block_remaining -= 1;
+        return self.reader.byte() catch {
+            self.ended = true;
+            return null;
+        };
+    }
+
+    fn code(self: *GifCodeReader, size: u5) ?u16 {
+        while (self.bit_count < size) {
+            const value = self.next_byte() orelse return null;
+            self.bits |= @as(u32, value) << self.bit_count;
+            self.bit_count += 8;
+        }
+
+        const value: u16 = @intCast(self.bits & ((@as(u32, 1) << size) - 1));
+        self.bits >>= size;
+        self.bit_count -= size;
+
+        return value;
+    }
+
+    /// Skip the data left (and the block terminator)
+    fn finish(self: *GifCodeReader) void {
+        if (self.ended) return;
+        _ = self.reader.bytes(self.block_remaining) catch return;
+        self.reader.skip_sub_blocks() catch {};
+        self.ended = true;
+    }
+};
+
+/// Decoded frame kept in the ring
+const FrameSlot = struct {
+    frame: ?usize = null,
+    pixels: []u8,
+};
+
+/// Animated image (GIF) decoded one frame at a time
+///
+/// Only the compressed file, the composition canvas and a small ring of
+/// decoded frames (R8G8B8A8) are kept in memory.
+///
+/// NOTE: GIF frames are composited on top of the previous ones, so seeking
+/// backward out of the ring decodes again from the first frame
+pub const ImageAnimStream = struct {
+    lock: std.Thread.Mutex = .{},
+    data: []u8,
+    width: usize,
+    height: usize,
+    global_palette: ?[]const u8,
+    frames: []GifFrame,
+
+    canvas: []u8, // Composition after the frame `decoded`
+    previous: []u8, // Canvas saved before a frame disposed to previous
+    indices: []u8, // Color indices of one frame
+    decoded: ?usize = null,
+
+    ring: []FrameSlot,
+    ring_next: usize = 0,
+    current: usize = 0,
+
+    /// The decoder buffers were unloaded (freed)
+    unloaded: bool = false,
+
+    prefix: [GIF_MAX_CODES]u16 = undefined,
+    suffix: [GIF_MAX_CODES]u8 = undefined,
+    stack: [GIF_MAX_CODES + 1]u8 = undefined,
+
+    /// Index the frames of the GIF file data (copied)
+    pub fn init(file_data: []const u8, ring_size: usize) !*ImageAnimStream {
+        if (ring_size == 0 or ring_size > IMAGE_ANIM_RING_SIZE_MAX) return error.invalid_ring_size;
+
+        const data = try allocator.dupe(u8, file_data);
+        errdefer allocator.free(data);
+
+        var reader = GifReader{ .data = data };
+
+        const signature = try reader.bytes(6);
+        if (!std.mem.eql(u8, signature, "GIF87a") and !std.mem.eql(u8, signature, "GIF89a")) return error.invalid_gif;
+
+        const width: usize = try reader.word();
+        const height: usize = try reader.word();
+        const flags = try reader.byte();
+        _ = try reader.byte(); // Background color index
+        _ = try reader.byte(); // Pixel aspect ratio
+
+        if (width == 0 or height == 0) return error.invalid_gif;
+
+        var global_palette: ?[]const u8 = null;
+        if (flags & 0x80 != 0) {
+            global_palette = try reader.bytes(3 * (@as(usize, 1) << @intCast((flags & 0x07) + 1)));
+        }
+
+        var frames = std.ArrayList(GifFrame).init(allocator);
+        errdefer frames.deinit();
+
+        var max_pixels: usize = width * height;
+        var delay: c_uint = 0;
+        var disposal: u8 = 0;
+        var transparent: ?u8 = null;
+
+        while (true) {
+            // Files truncated after the last frame are accepted
+            switch (reader.byte() catch 0x3B) {
+                // Extension
+                0x21 => {
+                    const label = try reader.byte();
+                    if (label == 0xF9) {
+                        const block = try reader.bytes(try reader.byte());
+                        if (block.len >= 4) {
+                            disposal = (block[0] >> 2) & 0x07;
+                            delay = 10 * (@as(c_uint, block[1]) | (@as(c_uint, block[2]) << 8));
+                            transparent = if (block[0] & 0x01 != 0) block[3] else null;
+                        }
+                    }
+                    try reader.skip_sub_blocks();
+                },
+                // Image descriptor
+                0x2C => {
+                    const offset = reader.pos - 1;
+                    const left: usize = try reader.word();
+                    const top: usize = try reader.word();
+                    const frame_width: usize = try reader.word();
+                    const frame_height: usize = try reader.word();
+                    const frame_flags = try reader.byte();
+
+                    if (frame_flags & 0x80 != 0) {
+                        _ = try reader.bytes(3 * (@as(usize, 1) << @intCast((frame_flags & 0x07) + 1)));
+                    } else if (global_palette == null) {
+                        return error.invalid_gif;
+                    }
+
+                    max_pixels = @max(max_pixels, frame_width * frame_height);
+
+                    _ = try reader.byte(); // LZW minimum code size
+                    try reader.skip_sub_blocks();
+
+                    try frames.append(GifFrame{
+                        .offset = offset,
+                        .left = left,
+                        .top = top,
+                        .width = frame_width,
+                        .height = frame_height,
+                        .delay = delay,
+                        .disposal = disposal,
+                        .transparent = transparent,
+                    });
+
+                    delay = 0;
+                    disposal = 0;
+                    transparent = null;
+                },
+                // Trailer
+                0x3B => break,
+                else => return error.invalid_gif,
+            }
+        }
+
+        if (frames.items.len == 0) return error.invalid_gif;
+
+        const frame_size = 4 * width * height;
+
+        const canvas = try allocator.alloc(u8, frame_size);
+        errdefer allocator.free(canvas);
+
+        const previous = try allocator.alloc(u8, frame_size);
+        errdefer allocator.free(previous);
+
+        const indices = try allocator.alloc(u8, max_pixels);
+        errdefer allocator.free(indices);
+
+        const ring = try allocator.alloc(FrameSlot, ring_size);
+        errdefer allocator.free(ring);
+
+        var allocated: usize = 0;
+        errdefer for (ring[0..allocated]) |slot| allocator.free(slot.pixels);
+
+        for (ring) |*slot| {
+            slot.* = FrameSlot{ .pixels = try allocator.alloc(u8, frame_size) };
+            allocated += 1;
+        }
+
+        const stream = try allocator.create(ImageAnimStream);
+        errdefer allocator.destroy(stream);
+
+        stream.* = ImageAnimStream{
+            .data = data,
+            .width = width,
+            .height = height,
+            .global_palette = global_palette,
+            .frames = try frames.toOwnedSlice(),
+            .canvas = canvas,
+            .previous = previous,
+            .indices = indices,
+            .ring = ring,
+        };
+
+        return stream;
+    }
+
+    /// Release the file data and the decoder buffers, the stream can no longer be used
+    pub fn unload(self: *ImageAnimStream) void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        if (self.unloaded) return;
+
+        for (self.ring) |slot| allocator.free(slot.pixels);
+        allocator.free(self.ring);
+        allocator.free(self.indices);
+        allocator.free(self.previous);
+        allocator.free(self.canvas);
+        allocator.free(self.frames);
+        allocator.free(self.data);
+
+        self.ring = self.ring[0..0];
+        self.indices = self.indices[0..0];
+        self.previous = self.previous[0..0];
+        self.canvas = self.canvas[0..0];
+        self.frames = self.frames[0..0];
+        self.data = self.data[0..0];
+        self.global_palette = null;
+        self.decoded = null;
+        self.unloaded = true;
+    }
+
+    pub fn deinit(self: *ImageAnimStream) void {
+        self.unload();
+        allocator.destroy(self);
+    }
+
+    pub fn is_unloaded(self: *ImageAnimStream) bool {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        return self.unloaded;
+    }
+
+    pub fn frame_count(self: *ImageAnimStream) usize {
+        return self.frames.len;
+    }
+
+    pub fn get_current(self: *ImageAnimStream) usize {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        return self.current;
+    }
+
+    /// Frame delays in milliseconds (as stored in the file)
+    pub fn get_delay(self: *ImageAnimStream, frame: usize) c_uint {
+        return self.frames[frame].delay;
+    }
+
+    /// Move to the next frame (looping) and decode it, returns the new frame index
+    pub fn next_frame(self: *ImageAnimStream) !usize {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        if (self.unloaded) return error.image_anim_stream_unloaded;
+
+        const frame = (self.current + 1) % self.frames.len;
+        _ = try self.frame_pixels(frame);
+        self.current = frame;
+
+        return frame;
+    }
+
+    /// Move to a frame and decode it
+    pub fn seek(self: *ImageAnimStream, frame: usize) !void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        if (self.unloaded) return error.image_anim_stream_unloaded;
+        if (frame >= self.frames.len) return error.invalid_frame;
+
+        _ = try self.frame_pixels(frame);
+        self.current = frame;
+    }
+
+    /// Call func with the pixels (R8G8B8A8) of the current frame, the stream is locked meanwhile
+    pub fn with_current_pixels(self: *ImageAnimStream, context: anytype, comptime func: fn (@TypeOf(context), []const u8) anyerror!void) !void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        if (self.unloaded) return error.image_anim_stream_unloaded;
+
+        try func(context, try self.frame_pixels(self.current));
+    }
+
+    /// Pixels of a frame, from the ring or decoded into it
+    fn frame_pixels(self: *ImageAnimStream, frame: usize) ![]const u8 {
+        for (self.ring) |slot| {
+            if (slot.frame) |slot_frame| {
+                if (slot_frame == frame) return slot.pixels;
+            }
+        }
+
+        // Frames are composited in order, restart from the first frame when going backward
+        if (self.decoded == null or frame <= self.decoded.?) self.decoded = null;
+
+        var next: usize = if (self.decoded) |decoded| decoded + 1 else 0;
+        while (next <= frame) : (next += 1) {
+            try self.decode_frame(next);
+        }
+
+        const slot = &self.ring[self.ring_next];
+        self.ring_next = (self.ring_next + 1) % self.ring.len;
+
+        @memcpy(slot.pixels, self.canvas);
+        slot.frame = frame;
+
+        return slot.pixels;
+    }
+
+    /// Composite a frame on the canvas (the canvas must hold the previous frame)
+    fn decode_frame(self: *ImageAnimStream, index: usize) !void {
+        errdefer self.decoded = null;
+
+        if (index == 0) {
+            @memset(self.canvas, 0);
+        } else {
+            const last = self.frames[index - 1];
+            switch (last.disposal) {
+                GIF_DISPOSAL_BACKGROUND => self.clear_rect(last),
+                GIF_DISPOSAL_PREVIOUS => @memcpy(self.canvas, self.previous),
+                else => {},
+            }
+        }
+
+        const frame = self.frames[index];
+        if (frame.disposal == GIF_DISPOSAL_PREVIOUS) @memcpy(self.previous, self.canvas);
+
+        var reader = GifReader{ .data = self.data, .pos = frame.offset + 9 };
+        const flags = try reader.byte();
+
+        var palette = self.global_palette orelse &[_]u8{};
+        if (flags & 0x80 != 0) {
+            palette = try reader.bytes(3 * (@as(usize, 1) << @intCast((flags & 0x07) + 1)));
+        }
+        const interlaced = flags & 0x40 != 0;
+
+        const min_code_size = try reader.byte();
+        if (min_code_size < 1 or min_code_size >= GIF_MAX_CODE_SIZE) return error.invalid_gif;
+
+        const indices = self.indices[0 .. frame.width * frame.height];
+        const decoded = self.decode_lzw(&reader, @intCast(min_code_size), indices);
+
+        // Truncated frames keep the pixels already drawn
+        var row: usize = 0;
+        var pass: usize = 0;
+        var step: usize = if (interlaced) 8 else 1;
+
+        for (0..frame.height) |i| {
+            if (i * frame.width >= decoded) break;
+
+            const y = frame.top + row;
+            if (y < self.height) {
+                const line = indices[i * frame.width .. @min((i + 1) * frame.width, decoded)];
+                for (line, 0..) |color, column| {
+                    if (frame.transparent) |transparent| {
+                        if (transparent == color) continue;
+                    }
+
+                    const x = frame.left + column;
+                    if (x >= self.width) break;
+
+                    const color_offset = 3 * @as(usize, color);
+                    if (color_offset + 3 > palette.len) continue;
+
+                    const pixel = self.canvas[4 * (y * self.width + x) ..][0..4];
+                    pixel[0] = palette[color_offset];
+                    pixel[1] = palette[color_offset + 1];
+                    pixel[2] = palette[color_offset + 2];
+                    pixel[3] = 255;
+                }
+            }
+
+            // Interlaced rows come in 4 passes: every 8th row from 0, every 8th from 4, every 4th from 2, every 2nd from 1
+            row += step;
+            if (interlaced) {
+                while (row >= frame.height and pass < 3) {
+                    pass += 1;
+                    row = ([_]usize{ 0, 4, 2, 1 })[pass];
+                    step = ([_]usize{ 8, 8, 4, 2 })[pass];
+                }
+            }
+        }
+
+        self.decoded = index;
+    }
+
+    fn clear_rect(self: *ImageAnimStream, frame: GifFrame) void {
+        const right = @min(frame.left + frame.width, self.width);
+        const bottom = @min(frame.top + frame.height, self.height);
+        if (frame.left >= right or frame.top >= bottom) return;
+
+        for (frame.top..bottom) |y| {
+            @memset(self.canvas[4 * (y * self.width + frame.left) .. 4 * (y * self.width + right)], 0);
+        }
+    }
+
+    /// Decode the LZW data of a frame to color indices, returns the number of indices decoded
+    fn decode_lzw(self: *ImageAnimStream, reader: *GifReader, min_code_size: u5, out: []u8) usize {
+        var codes = GifCodeReader{ .reader = reader };
+        defer codes.finish();
+
+        const clear: u16 = @as(u16, 1) << min_code_size;
+        const end: u16 = clear + 1;
+
+        for (0..clear) |i| {
+            self.prefix[i] = 0;
+            self.suffix[i] = @truncate(i);
+        }
+
+        var code_size: u5 = min_code_size + 1;
+        var next: u16 = clear + 2;
+        var previous: ?u16 = null;
+        var first: u8 = 0;
+        var count: usize = 0;
+
+        while (count < out.len) {
+            const code = codes.code(code_size) orelse break;
+
+            if (code == clear) {
+                code_size = min_code_size + 1;
+                next = clear + 2;
+                previous = null;
+                continue;
+            }
+            if (code == end) break;
+
+            const prev = previous orelse {
+                if (code >= clear) break;
+                first = @truncate(code);
+                out[count] = first;
+                count += 1;
+                previous = code;
+                continue;
+            };
+
+            if (code > next) break;
+
+            // Expand the code backward on the stack
+            var sp: usize = 0;
+            var c = code;
+            if (code == next) {
+                self.stack[sp] = first;
+                sp += 1;
+                c = prev;
+            }
+            while (c >= clear) {
+                self.stack[sp] = self.suffix[c];
+                sp += 1;
+                c = self.prefix[c];
+            }
+            first = @truncate(c);
+            self.stack[sp] = first;
+            sp += 1;
+
+            while (sp > 0 and count < out.len) {
+                sp -= 1;
+                out[count] = self.stack[sp];
+                count += 1;
+            }
+
+            if (next < GIF_MAX_CODES) {
+                self.prefix[next] = prev;
+                self.suffix[next] = first;
+                next += 1;
+                if (next == (@as(u16, 1) << code_size) and code_size < GIF_MAX_CODE_SIZE) code_size += 1;
+            }
+
+            previous = code;
+        }
+
+        return count;
+    }
+};
+
+pub fn LoadImageAnimStream(file_data: []const u8, ring_size: usize) !*ImageAnimStream {
+    return ImageAnimStream.init(file_data, ring_size);
+}
+
+pub fn UnloadImageAnimStream(stream: *ImageAnimStream) void {
+    stream.deinit();
+}
+
+pub fn UnloadImageAnimStreamData(stream: *ImageAnimStream) void {
+    stream.unload();
+}
@@ -0,0 +1,436 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+const workers = @import("./workers.zig");
+
+pub const allocator = rl.allocator;
+
+/// Use the vectorized kernels split across the worker pool when the format is supported,
+/// otherwise (or when disabled) the raylib implementation is used
+pub var fast_path = std.atomic.Value(bool).init(true);
+
+/// Pixels processed per vector step
+const lanes = 16;
+
+/// Minimum pixels per chunk of work sent to the worker pool
+const pixels_per_chunk = 64 * 1024;
+
+const U8 = @Vector(lanes, u8);
+const U16 = @Vector(lanes, u16);
+const U32 = @Vector(lanes, u32);
+
+/// Pixels split by channel, the 8 bit values are widened for the arithmetic
+const Pixels = struct {
+    r: U16,
+    g: U16,
+    b: U16,
+    a: U16,
+};
+
+const GRAYSCALE = rl.PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+const GRAY_ALPHA = rl.PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+const R5G6B5 = rl.PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+const R8G8B8 = rl.PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+const R5G5B5A1 = rl.PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+const R4G4B4A4 = rl.PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+const R8G8B8A8 = rl.PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+/// Formats with 8 bit channels, they can be decoded and filtered per byte
+const source_formats = [_]c_int{ GRAYSCALE, GRAY_ALPHA, R8G8B8, R8G8B8A8 };
+
+/// Formats that can be encoded
+const target_formats = source_formats ++ [_]c_int{ R5G6B5, R5G5B5A1, R4G4B4A4 };
+
+// Same threshold as PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD in raylib
+const alpha_threshold = 50;
+
+fn bytes_per_pixel(comptime format: c_int) usize {
+    return switch (format) {
+        GRAYSCALE => 1,
+        GRAY_ALPHA, R5G6B5, R5G5B5A1, R4G4B4A4 => 2,
+        R8G8B8 => 3,
+        R8G8B8A8 => 4,
+        else => @compileError("unsupported pixel format"),
+    };
+}
+
+fn splat16(comptime value: u16) U16 {
+    return @splat(value);
+}
+
+fn shift16(comptime value: u4) @Vector(lanes, u4) {
+    return @splat(value);
+}
+
+///////////////
+//  Kernels  //
+///////////////
+
+/// Extract one channel of interleaved pixels
+fn channel(comptime bpp: usize, comptime index: usize, v: @Vector(lanes * bpp, u8)) U16 {
+    const mask = comptime blk: {
+        var m: [lanes]i32 = undefined;
+        for (&m, 0..) |*value, i| value.* = @intCast(i * bpp + index);
+        break :blk m;
+    };
+
+    const bytes: U8 = @shuffle(u8, v, undefined, mask);
+    return @intCast(bytes);
+}
+
+/// Interleave channels into pixels
+fn interleave(comptime n: usize, channels: [n]U8) @Vector(lanes * n, u8) {
+    var out: [lanes * n]u8 = undefined;
+    inline for (0..lanes) |i| {
+        inline for (0..n) |c| out[i * n + c] = channels[c][i];
+    }
+    return out;
+}
+
+fn narrow(v: U16) U8 {
+    return @truncate(v);
+}
+
+/// round(value * max / 255), there are no ties for max < 255
+fn scale(v: U16, comptime max: u16) U16 {
+    return (v * splat16(max) + splat16(127)) / splat16(255);
+}
+
+/// Luma with the same weights as raylib (0.299, 0.587, 0.114) in 16 bit fixed point
+fn gray(p: Pixels) U16 {
+    const r: U32 = @intCast(p.r);
+    const g: U32 = @intCast(p.g);
+    const b: U32 = @intCast(p.b);
+    const shift: @Vector(lanes, u5) = @splat(16);
+    const weights = [3]U32{ @splat(19595), @splat(38470), @splat(7471) };
+
+    return @intCast((r * weights[0] + g * weights[1] + b * weights[2]) >> shift);
+}
+
+fn decode(comptime format: c_int, v: @Vector(lanes * bytes_per_pixel(format), u8)) Pixels {
+    return switch (format) {
+        GRAYSCALE => blk: {
+            const y = channel(1, 0, v);
+            break :blk .{ .r = y, .g = y, .b = y, .a = splat16(255) };
+        },
+        GRAY_ALPHA => blk: {
+            const y = channel(2, 0, v);
+            break :blk .{ .r = y, .g = y, .b = y, .a = channel(2, 1, v) };
+        },
+        R8G8B8 => .{ .r = channel(3, 0, v), .g = channel(3, 1, v), .b = channel(3, 2, v), .a = splat16(255) },
+        R8G8B8A8 => .{ .r = channel(4, 0, v), .g = channel(4, 1, v), .b = channel(4, 2, v), .a = channel(4, 3, v) },
+        else => @compileError("unsupported source pixel format"),
+    };
+}
+
+fn encode(comptime format: c_int, p: Pixels) @Vector(lanes * bytes_per_pixel(format), u8) {
+    return switch (format) {
+        GRAYSCALE => narrow(gray(p)),
+        GRAY_ALPHA => interleave(2, .{ narrow(gray(p)), narrow(p.a) }),
+        R8G8B8 => interleave(3, .{ narrow(p.r), narrow(p.g), narrow(p.b) }),
+        R8G8B8A8 => interleave(4, .{ narrow(p.r), narrow(p.g), narrow(p.b), narrow(p.a) }),
+        R5G6B5 => @bitCast((scale(p.r, 31) << shift16(11)) | (scale(p.g, 63) << shift16(5)) | scale(p.b, 31)),
+        R5G5B5A1 => blk: {
+            const a = @select(u16, p.a > splat16(alpha_threshold), splat16(1), splat16(0));
+            break :blk @bitCast((scale(p.r, 31) << shift16(11)) | (scale(p.g, 31) << shift16(6)) | (scale(p.b, 31) << shift16(1)) | a);
+        },
+        R4G4B4A4 => @bitCast((scale(p.r, 15) << shift16(12)) | (scale(p.g, 15) << shift16(8)) | (scale(p.b, 15) << shift16(4)) | scale(p.a, 15)),
+        else => @compileError("unsupported target pixel format"),
+    };
+}
+
+/// Same truncation as raylib ImageAlphaPremultiply
+fn premultiply(p: Pixels) Pixels {
+    return .{
+        .r = p.r * p.a / splat16(255),
+        .g = p.g * p.a / splat16(255),
+        .b = p.b * p.a / splat16(255),
+        .a = p.a,
+    };
+}
+
+/// Pixel conversion between two formats, split in chunks across the worker pool
+fn PixelKernel(comptime src_format: c_int, comptime dst_format: c_int, comptime premultiply_alpha: bool) type {
+    return struct {
+        const src_bpp = bytes_per_pixel(src_format);
+        const dst_bpp = bytes_per_pixel(dst_format);
+
+        const Job = struct {
+            src: [*]const u8,
+            dst: [*]u8,
+        };
+
+        fn block(in: @Vector(lanes * src_bpp, u8)) @Vector(lanes * dst_bpp, u8) {
+            var pixels = decode(src_format, in);
+            if (premultiply_alpha) pixels = premultiply(pixels);
+            return encode(dst_format, pixels);
+        }
+
+        fn run(job: *const Job, start: usize, end: usize) void {
+            var i = start;
+            while (i + lanes <= end) : (i += lanes) {
+                const in: @Vector(lanes * src_bpp, u8) = job.src[i * src_bpp ..][0 .. lanes * src_bpp].*;
+                job.dst[i * dst_bpp ..][0 .. lanes * dst_bpp].* = block(in);
+            }
+
+            // Remaining pixels through a zero padded block
+            if (i < end) {
+                const n = end - i;
+
+                var in = [_]u8{0} ** (lanes * src_bpp);
+                @memcpy(in[0 .. n * src_bpp], job.src[i * src_bpp .. end * src_bpp]);
+
+                const out: [lanes * dst_bpp]u8 = block(in);
+                @memcpy(job.dst[i * dst_bpp .. end * dst_bpp], out[0 .. n * dst_bpp]);
+            }
+        }
+
+        /// Convert count pixels, src and dst can be the same buffer when the sizes match
+        fn convert(src: [*]const u8, dst: [*]u8, count: usize) void {
+            const job = Job{ .src = src, .dst = dst };
+            workers.parallel_for(count, pixels_per_chunk, &job, run);
+        }
+    };
+}
+
+/// 2x2 box filter from one mipmap level to the next, split by rows across the worker pool
+fn BoxFilter(comptime bpp: usize) type {
+    return struct {
+        // Output pixels per vector step (reading two rows of lanes pixels)
+        const step = lanes / 2;
+
+        const Wide = @Vector(lanes * bpp, u16);
+        const Half = @Vector(step * bpp, u16);
+
+        const even_mask = pair_mask(0);
+        const odd_mask = pair_mask(bpp);
+
+        const Job = struct {
+            src: [*]const u8,
+            src_width: usize,
+            src_height: usize,
+            dst: [*]u8,
+            dst_width: usize,
+        };
+
+        fn pair_mask(comptime offset: usize) [step * bpp]i32 {
+            var m: [step * bpp]i32 = undefined;
+            for (&m, 0..) |*value, j| value.* = @intCast((j / bpp) * 2 * bpp + j % bpp + offset);
+            return m;
+        }
+
+        fn run(job: *const Job, start: usize, end: usize) void {
+            const sw = job.src_width;
+            const dw = job.dst_width;
+
+            for (start..end) |y| {
+                // Odd sizes drop the last row/column, a size of 1 is averaged with itself
+                const row0 = job.src + (2 * y) * sw * bpp;
+                const row1 = job.src + @min(2 * y + 1, job.src_height - 1) * sw * bpp;
+                const out = job.dst + y * dw * bpp;
+
+                var x: usize = 0;
+                while (2 * (x + step) <= sw) : (x += step) {
+                    const a: @Vector(lanes * bpp, u8) = row0[2 * x * bpp ..][0 .. lanes * bpp].*;
+                    const b: @Vector(lanes * bpp, u8) = row1[2 * x * bpp ..][0 .. lanes * bpp].*;
+                    const sum = @as(Wide, @intCast(a)) + @as(Wide, @intCast(b));
+
+                    const even = @shuffle(u16, sum, undefined, even_mask);
+                    const odd = @shuffle(u16, sum, undefined, odd_mask);
+                    const shift: @Vector(step * bpp, u4) = @splat(2);
+                    const avg: Half = (even + odd + @as(Half, @splat(2))) >> shift;
+
+                    out[x * bpp ..][0 .. step * bpp].* = @as(@Vector(step * bpp, u8), @truncate(avg));
+                }
+
+                while (x < dw) : (x += 1) {
+                    const x0 = 2 * x * bpp;
+                    const x1 = @min(2 * x + 1, sw - 1) * bpp;
+
+                    inline for (0..bpp) |c| {
+                        const sum = @as(u16, row0[x0 + c]) + row0[x1 + c] + row1[x0 + c] + row1[x1 + c];
+                        out[x * bpp + c] = @intCast((sum + 2) >> 2);
+                    }
+                }
+            }
+        }
+
+        fn filter(job: *const Job, dst_height: usize) void {
+            workers.parallel_for(dst_height, @max(pixels_per_chunk / job.dst_width, 1), job, run);
+        }
+    };
+}
+
+///////////////
+//  Mipmaps  //
+///////////////
+
+fn mipmap_size(size: c_int) c_int {
+    return @max(@divTrunc(size, 2), 1);
+}
+
+/// Number of mipmap levels down to 1x1 (including the base level)
+fn get_mipmap_count(width: c_int, height: c_int) c_int {
+    var count: c_int = 1;
+    var w = width;
+    var h = height;
+    while (w != 1 or h != 1) {
+        w = mipmap_size(w);
+        h = mipmap_size(h);
+        count += 1;
+    }
+    return count;
+}
+
+/// Number of pixels of all the mipmap levels
+fn get_pixel_count(width: c_int, height: c_int, mipmaps: c_int) usize {
+    var count: usize = 0;
+    var w = width;
+    var h = height;
+    for (0..@intCast(@max(mipmaps, 1))) |_| {
+        count += @as(usize, @intCast(w)) * @as(usize, @intCast(h));
+        w = mipmap_size(w);
+        h = mipmap_size(h);
+    }
+    return count;
+}
+
+fn GenerateMipmaps(image: *rl.Image, comptime bpp: usize) !void {
+    const mipmap_count = get_mipmap_count(image.width, image.height);
+
+    // Same as raylib, the existing levels are kept
+    if (image.mipmaps >= mipmap_count) return;
+
+    const size = get_pixel_count(image.width, image.height, mipmap_count) * bpp;
+    const data: [*]u8 = @ptrCast(rl.MemRealloc(image.data, @intCast(size)) orelse return error.OutOfMemory);
+    image.data = @ptrCast(data);
+
+    var offset: usize = 0;
+    var width = image.width;
+    var height = image.height;
+
+    for (1..@intCast(mipmap_count)) |level| {
+        const src_size = @as(usize, @intCast(width)) * @as(usize, @intCast(height)) * bpp;
+        const mip_width = mipmap_size(width);
+        const mip_height = mipmap_size(height);
+
+        if (level >= @as(usize, @intCast(image.mipmaps))) {
+            const job = BoxFilter(bpp).Job{
+                .src = data + offset,
+                .src_width = @intCast(width),
+                .src_height = @intCast(height),
+                .dst = data + offset + src_size,
+                .dst_width = @intCast(mip_width),
+            };
+            BoxFilter(bpp).filter(&job, @intCast(mip_height));
+        }
+
+        offset += src_size;
+        width = mip_width;
+        height = mip_height;
+    }
+
+    image.mipmaps = mipmap_count;
+}
+
+fn ConvertImage(image: *rl.Image, comptime src_format: c_int, comptime dst_format: c_int) !void {
+    // Same as raylib, the mipmaps are generated again from the base level,
+    // but before the conversion (filtering the 8 bit channels)
+    if (image.mipmaps > 1) {
+        image.mipmaps = 1;
+        try GenerateMipmaps(image, bytes_per_pixel(src_format));
+    }
+
+    const count = get_pixel_count(image.width, image.height, image.mipmaps);
+    const data: [*]u8 = @ptrCast(rl.MemAlloc(@intCast(count * bytes_per_pixel(dst_format))) orelse return error.OutOfMemory);
+
+    PixelKernel(src_format, dst_format, false).convert(@ptrCast(image.data.?), data, count);
+
+    rl.MemFree(image.data);
+    image.data = @ptrCast(data);
+    image.format = dst_format;
+}
+
+fn is_fast_path(image: *const rl.Image) bool {
+    return fast_path.load(.monotonic) and image.data != null and image.width > 0 and image.height > 0;
+}
+
+////////////////////////
+//  Image processing  //
+////////////////////////
+
+/// Convert image data to desired format
+///
+/// Vectorized for the formats with 8 bit channels to 8 bit and 16 bit formats
+pub fn ImageFormat(image: *rl.Image, new_format: c_int) !void {
+    if (is_fast_path(image) and image.format != new_format) {
+        inline for (source_formats) |src_format| {
+            if (image.format == src_format) {
+                inline for (target_formats) |dst_format| {
+                    if (src_format != dst_format and new_format == dst_format) {
+                        return ConvertImage(image, src_format, dst_format);
+                    }
+                }
+            }
+        }
+    }
+
+    rl.ImageFormat(image, new_format);
+}
+
+/// Compute all mipmap levels for a provided image
+///
+/// Box filtered for the formats with 8 bit channels
+pub fn ImageMipmaps(image: *rl.Image) !void {
+    if (is_fast_path(image)) {
+        inline for (source_formats) |format| {
+            if (image.format == format) return GenerateMipmaps(image, bytes_per_pixel(format));
+        }
+    }
+
+    rl.ImageMipmaps(image);
+}
+
+/// Premultiply alpha channel
+///
+/// Vectorized for R8G8B8A8 (all the mipmap levels are premultiplied)
+pub fn ImageAlphaPremultiply(image: *rl.Image) void {
+    if (is_fast_path(image) and image.format == R8G8B8A8) {
+        const data: [*]u8 = @ptrCast(image.data.?);
+        PixelKernel(R8G8B8A8, R8G8B8A8, true).convert(data, data, get_pixel_count(image.width, image.height, image.mipmaps));
+        return;
+    }
+
+    rl.ImageAlphaPremultiply(image);
+}
+
+const ImageBatch = struct {
+    images: []const *rl.Image,
+    new_format: c_int = 0,
+    failed: std.atomic.Value(bool) = std.atomic.Value(bool).init(false),
+
+    fn format(self: *ImageBatch, start: usize, end: usize) void {
+        for (self.images[start..end]) |image| {
+            ImageFormat(image, self.new_format) catch self.failed.store(true, .monotonic);
+        }
+    }
+
+    fn mipmaps(self: *ImageBatch, start: usize, end: usize) void {
+        for (self.images[start..end]) |image| {
+            ImageMipmaps(image) catch self.failed.store(true, .monotonic);
+        }
+    }
+};
+
+/// Convert many images to the same format, the images are processed in parallel
+pub fn ImageFormatBatch(images: []const *rl.Image, new_format: c_int) !void {
+    var batch = ImageBatch{ .images = images, .new_format = new_format };
+    workers.parallel_for(images.len, 1, &batch, ImageBatch.format);
+    if (batch.failed.load(.monotonic)) return error.OutOfMemory;
+}
+
+/// Compute the mipmaps of many images, the images are processed in parallel
+pub fn ImageMipmapsBatch(images: []const *rl.Image) !void {
+    var batch = ImageBatch{ .images = images };
+    workers.parallel_for(images.len, 1, &batch, ImageBatch.mipmaps);
+    if (batch.failed.load(.monotonic)) return error.OutOfMemory;
+}
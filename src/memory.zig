@@ -0,0 +1,252 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+
+const resources = @import("./resources.zig");
+
+///////////////////
+//  Allocations  //
+///////////////////
+
+/// Who requested the native memory
+pub const Subsystem = enum(u8) {
+    /// raylib, stb_truetype and raygui (RL_MALLOC and friends)
+    native,
+    /// NIF code and resources (rl.allocator)
+    zig,
+};
+
+/// Current and peak bytes and allocations, updated with relaxed atomics
+pub const Counter = struct {
+    bytes: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+    peak_bytes: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+    count: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+    peak_count: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+    total: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+
+    fn add(self: *Counter, bytes: usize) void {
+        const current_bytes = self.bytes.fetchAdd(bytes, .monotonic) + bytes;
+        _ = self.peak_bytes.fetchMax(current_bytes, .monotonic);
+
+        const current_count = self.count.fetchAdd(1, .monotonic) + 1;
+        _ = self.peak_count.fetchMax(current_count, .monotonic);
+
+        _ = self.total.fetchAdd(1, .monotonic);
+    }
+
+    fn sub(self: *Counter, bytes: usize) void {
+        _ = self.bytes.fetchSub(bytes, .monotonic);
+        _ = self.count.fetchSub(1, .monotonic);
+    }
+
+    fn resize(self: *Counter, old_bytes: usize, new_bytes: usize) void {
+        if (new_bytes >= old_bytes) {
+            const current_bytes = self.bytes.fetchAdd(new_bytes - old_bytes, .monotonic) + (new_bytes - old_bytes);
+            _ = self.peak_bytes.fetchMax(current_bytes, .monotonic);
+        } else {
+            _ = self.bytes.fetchSub(old_bytes - new_bytes, .monotonic);
+        }
+    }
+
+    fn reset_peak(self: *Counter) void {
+        self.peak_bytes.store(self.bytes.load(.monotonic), .monotonic);
+        self.peak_count.store(self.count.load(.monotonic), .monotonic);
+    }
+};
+
+pub var allocations = [_]Counter{.{}} ** std.meta.fields(Subsystem).len;
+
+pub fn allocated(subsystem: Subsystem, bytes: usize) void {
+    allocations[@intFromEnum(subsystem)].add(bytes);
+}
+
+pub fn reallocated(subsystem: Subsystem, old_bytes: usize, new_bytes: usize) void {
+    allocations[@intFromEnum(subsystem)].resize(old_bytes, new_bytes);
+}
+
+pub fn freed(subsystem: Subsystem, bytes: usize) void {
+    allocations[@intFromEnum(subsystem)].sub(bytes);
+}
+
+//////////////
+//  Census  //
+//////////////
+
+/// Memory held by a resource value (estimated from its fields)
+pub const Usage = extern struct {
+    cpu_bytes: usize = 0,
+    gpu_bytes: usize = 0,
+};
+
+/// Live resources of a type and the memory they hold
+pub const Census = struct {
+    live: Counter = .{}, // Only the counts are used
+    cpu_bytes: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+    gpu_bytes: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+};
+
+pub var census = [_]Census{.{}} ** std.meta.fields(resources.ResourceTypeKey).len;
+
+/// GPU bytes held by all the resources
+pub var gpu = Counter{};
+
+fn account(entry: *Census, old: Usage, new: Usage) void {
+    if (new.cpu_bytes >= old.cpu_bytes) {
+        _ = entry.cpu_bytes.fetchAdd(new.cpu_bytes - old.cpu_bytes, .monotonic);
+    } else {
+        _ = entry.cpu_bytes.fetchSub(old.cpu_bytes - new.cpu_bytes, .monotonic);
+    }
+
+    if (new.gpu_bytes >= old.gpu_bytes) {
+        _ = entry.gpu_bytes.fetchAdd(new.gpu_bytes - old.gpu_bytes, .monotonic);
+    } else {
+        _ = entry.gpu_bytes.fetchSub(old.gpu_bytes - new.gpu_bytes, .monotonic);
+    }
+
+    gpu.resize(old.gpu_bytes, new.gpu_bytes);
+}
+
+fn census_entry(comptime T: type) *Census {
+    return &census[@intFromEnum(@field(resources.ResourceTypeKey, T.resource_name))];
+}
+
+pub fn resource_created(comptime T: type, usage: Usage) void {
+    const entry = census_entry(T);
+    entry.live.add(0);
+    account(entry, .{}, usage);
+}
+
+pub fn resource_changed(comptime T: type, old: Usage, new: Usage) void {
+    account(census_entry(T), old, new);
+}
+
+pub fn resource_destroyed(comptime T: type, usage: Usage) void {
+    const entry = census_entry(T);
+    entry.live.sub(0);
+    account(entry, usage, .{});
+}
+
+/// Peaks restart from the current values
+pub fn reset_peaks() void {
+    for (&allocations) |*counter| counter.reset_peak();
+    for (&census) |*entry| entry.live.reset_peak();
+    gpu.reset_peak();
+}
+
+/////////////////
+//  Estimates  //
+/////////////////
+
+fn to_usize(value: anytype) usize {
+    return @intCast(@max(value, 0));
+}
+
+/// Bytes of the pixel data with all the mipmap levels
+pub fn pixel_data_size(width: c_int, height: c_int, format: c_int, mipmaps: c_int) usize {
+    var size: usize = 0;
+
+    var w = width;
+    var h = height;
+
+    for (0..to_usize(@max(mipmaps, 1))) |_| {
+        size += to_usize(rl.GetPixelDataSize(w, h, format));
+
+        w = @max(@divTrunc(w, 2), 1);
+        h = @max(@divTrunc(h, 2), 1);
+    }
+
+    return size;
+}
+
+fn texture_size(texture: rl.Texture) usize {
+    if (texture.id == 0) return 0;
+    return pixel_data_size(texture.width, texture.height, texture.format, texture.mipmaps);
+}
+
+fn mesh_usage(mesh: rl.Mesh) Usage {
+    const vertex_count = to_usize(mesh.vertexCount);
+    const triangle_count = to_usize(mesh.triangleCount);
+
+    // Arrays uploaded to the vertex buffers
+    var buffers: usize = 0;
+    if (mesh.vertices != null) buffers += vertex_count * 3 * @sizeOf(f32);
+    if (mesh.texcoords != null) buffers += vertex_count * 2 * @sizeOf(f32);
+    if (mesh.texcoords2 != null) buffers += vertex_count * 2 * @sizeOf(f32);
+    if (mesh.normals != null) buffers += vertex_count * 3 * @sizeOf(f32);
+    if (mesh.tangents != null) buffers += vertex_count * 4 * @sizeOf(f32);
+    if (mesh.colors != null) buffers += vertex_count * 4 * @sizeOf(u8);
+    if (mesh.indices != null) buffers += triangle_count * 3 * @sizeOf(c_ushort);
+    if (mesh.boneIds != null) buffers += vertex_count * 4 * @sizeOf(u8);
+    if (mesh.boneWeights != null) buffers += vertex_count * 4 * @sizeOf(f32);
+
+    var cpu_bytes = buffers;
+    if (mesh.animVertices != null) cpu_bytes += vertex_count * 3 * @sizeOf(f32);
+    if (mesh.animNormals != null) cpu_bytes += vertex_count * 3 * @sizeOf(f32);
+    if (mesh.boneMatrices != null) cpu_bytes += to_usize(mesh.boneCount) * @sizeOf(rl.Matrix);
+
+    return .{
+        .cpu_bytes = cpu_bytes,
+        .gpu_bytes = if (mesh.vaoId != 0) buffers else 0,
+    };
+}
+
+/// Estimate the memory held by a resource value
+///
+/// NOTE: Values sharing their data (aliases, materials) only count their own struct
+pub fn estimate(comptime T: type, value: T.data_type) Usage {
+    var usage = Usage{ .cpu_bytes = @sizeOf(T.data_type) };
+
+    switch (T.data_type) {
+        rl.Image => {
+            if (value.data != null) usage.cpu_bytes += pixel_data_size(value.width, value.height, value.format, value.mipmaps);
+        },
+        rl.Texture => {
+            const faces: usize = if (comptime std.mem.eql(u8, T.resource_name, "texture_cubemap")) 6 else 1;
+            usage.gpu_bytes += faces * texture_size(value);
+        },
+        rl.RenderTexture => {
+            usage.gpu_bytes += texture_size(value.texture);
+            // Depth renderbuffer (24 bit, padded to 32)
+            if (value.depth.id != 0) usage.gpu_bytes += to_usize(value.depth.width) * to_usize(value.depth.height) * 4;
+        },
+        rl.Font => {
+            usage.gpu_bytes += texture_size(value.texture);
+
+            const glyph_count = to_usize(value.glyphCount);
+            if (value.recs != null) usage.cpu_bytes += glyph_count * @sizeOf(rl.Rectangle);
+            if (value.glyphs != null) {
+                usage.cpu_bytes += glyph_count * @sizeOf(rl.GlyphInfo);
+                for (value.glyphs[0..glyph_count]) |glyph| {
+                    if (glyph.image.data != null) usage.cpu_bytes += pixel_data_size(glyph.image.width, glyph.image.height, glyph.image.format, glyph.image.mipmaps);
+                }
+            }
+        },
+        rl.Mesh => {
+            const mesh = mesh_usage(value);
+            usage.cpu_bytes += mesh.cpu_bytes;
+            usage.gpu_bytes += mesh.gpu_bytes;
+        },
+        rl.Model => {
+            if (value.meshes != null) {
+                for (value.meshes[0..to_usize(value.meshCount)]) |model_mesh| {
+                    const mesh = mesh_usage(model_mesh);
+                    usage.cpu_bytes += @sizeOf(rl.Mesh) + mesh.cpu_bytes;
+                    usage.gpu_bytes += mesh.gpu_bytes;
+                }
+            }
+            usage.cpu_bytes += to_usize(value.materialCount) * @sizeOf(rl.Material);
+            usage.cpu_bytes += to_usize(value.boneCount) * (@sizeOf(rl.BoneInfo) + @sizeOf(rl.Transform));
+        },
+        rl.Wave => {
+            if (value.data != null) usage.cpu_bytes += @as(usize, value.frameCount) * value.channels * ((value.sampleSize + 7) / 8);
+        },
+        rl.Sound => {
+            // Converted to the device format (32 bit float) when loaded, aliases share the buffer
+            if (comptime !std.mem.eql(u8, T.resource_name, "sound_alias")) {
+                if (value.stream.buffer != null) usage.cpu_bytes += @as(usize, value.frameCount) * value.stream.channels * @sizeOf(f32);
+            }
+        },
+        else => {},
+    }
+
+    return usage;
+}
@@ -1,12 +1,69 @@
 const e = @import("./erl_nif.zig");
+const memory = @import("./memory.zig");
+
+/// Prefix of every allocation, enif_free does not give back the size
+///
+/// NOTE: 16 bytes to keep the alignment of the BEAM allocators
+const Header = extern struct {
+    size: usize,
+    subsystem: memory.Subsystem,
+    _padding: [16 - @sizeOf(usize) - 1]u8 = undefined,
+};
+
+comptime {
+    if (@sizeOf(Header) != 16) @compileError("allocation header must be 16 bytes");
+}
+
+fn get_header(ptr: *anyopaque) *Header {
+    return @ptrFromInt(@intFromPtr(ptr) - @sizeOf(Header));
+}
+
+fn get_data(header: *Header) *anyopaque {
+    return @ptrFromInt(@intFromPtr(header) + @sizeOf(Header));
+}
+
+pub fn alloc(subsystem: memory.Subsystem, size: usize) ?*anyopaque {
+    const raw = e.enif_alloc(size + @sizeOf(Header)) orelse return null;
+    const header: *Header = @ptrCast(@alignCast(raw));
+    header.* = .{ .size = size, .subsystem = subsystem };
+    memory.allocated(subsystem, size);
+    return get_data(header);
+}
+
+pub fn realloc(subsystem: memory.Subsystem, ptr: ?*anyopaque, new_size: usize) ?*anyopaque {
+    const data = ptr orelse return alloc(subsystem, new_size);
+
+    if (new_size == 0) {
+        free(data);
+        return null;
+    }
+
+    // The memory stays accounted to the subsystem that allocated it
+    const old_header = get_header(data);
+    const old_size = old_header.size;
+    const owner = old_header.subsystem;
+
+    const raw = e.enif_realloc(old_header, new_size + @sizeOf(Header)) orelse return null;
+    const header: *Header = @ptrCast(@alignCast(raw));
+    header.size = new_size;
+    memory.reallocated(owner, old_size, new_size);
+    return get_data(header);
+}
+
+pub fn free(ptr: ?*anyopaque) void {
+    const data = ptr orelse return;
+    const header = get_header(data);
+    memory.freed(header.subsystem, header.size);
+    e.enif_free(header);
+}
 
 pub export fn nif_alloc(size: usize) callconv(.C) ?*anyopaque {
-    return e.enif_alloc(size);
+    return alloc(.native, size);
 }
 
 pub export fn nif_calloc(num: usize, size: usize) callconv(.C) ?*anyopaque {
     const total_size = num * size;
-    const ptr = e.enif_alloc(total_size);
+    const ptr = alloc(.native, total_size);
     if (ptr != null) {
         @memset(@as([*]u8, @ptrCast(ptr))[0..total_size], 0);
     }
@@ -14,9 +71,9 @@ pub export fn nif_calloc(num: usize, size: usize) callconv(.C) ?*anyopaque {
 }
 
 pub export fn nif_realloc(ptr: ?*anyopaque, new_size: usize) callconv(.C) ?*anyopaque {
-    return e.enif_realloc(ptr, new_size);
+    return realloc(.native, ptr, new_size);
 }
 
 pub export fn nif_free(ptr: ?*anyopaque) callconv(.C) void {
-    e.enif_free(ptr);
+    free(ptr);
 }
@@ -0,0 +1,346 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+
+const core = @import("../core.zig");
+const asset_pack = @import("../asset_pack.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Asset pack
+    .{ .name = "load_asset_pack", .arity = 1, .fptr = core.nif_wrapper(nif_load_asset_pack), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_asset_pack_entries", .arity = 1, .fptr = core.nif_wrapper(nif_get_asset_pack_entries), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "export_asset_pack", .arity = 2, .fptr = core.nif_wrapper(nif_export_asset_pack), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Asset loading
+    .{ .name = "load_texture_from_asset_pack", .arity = 2, .fptr = core.nif_wrapper(nif_load_texture_from_asset_pack), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_texture_from_asset_pack", .arity = 3, .fptr = core.nif_wrapper(nif_load_texture_from_asset_pack), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_mesh_from_asset_pack", .arity = 2, .fptr = core.nif_wrapper(nif_load_mesh_from_asset_pack), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_mesh_from_asset_pack", .arity = 3, .fptr = core.nif_wrapper(nif_load_mesh_from_asset_pack), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_font_from_asset_pack", .arity = 2, .fptr = core.nif_wrapper(nif_load_font_from_asset_pack), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_font_from_asset_pack", .arity = 3, .fptr = core.nif_wrapper(nif_load_font_from_asset_pack), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_sound_from_asset_pack", .arity = 2, .fptr = core.nif_wrapper(nif_load_sound_from_asset_pack), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_sound_from_asset_pack", .arity = 3, .fptr = core.nif_wrapper(nif_load_sound_from_asset_pack), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+fn make_asset_type(env: ?*e.ErlNifEnv, asset_type: asset_pack.AssetType) e.ErlNifTerm {
+    return core.Atom.make(env, @tagName(asset_type));
+}
+
+fn get_asset_type(env: ?*e.ErlNifEnv, term: e.ErlNifTerm) !asset_pack.AssetType {
+    inline for (@typeInfo(asset_pack.AssetType).@"enum".fields) |field| {
+        if (e.enif_is_identical(core.Atom.make(env, field.name), term) != 0) return @enumFromInt(field.value);
+    }
+    return error.ArgumentError;
+}
+
+/// Get an asset pack and acquire it (release it when its payloads are no longer used)
+fn get_asset_pack(env: ?*e.ErlNifEnv, term: e.ErlNifTerm) !*asset_pack.AssetPack {
+    const pack = core.AssetPack.get(env, term) catch {
+        return error.invalid_argument_pack;
+    };
+
+    pack.acquire() catch {
+        return error.invalid_argument_pack;
+    };
+
+    return pack;
+}
+
+/// Get the payload of an asset, mapping the lookup errors to arguments errors
+fn get_asset_payload(env: ?*e.ErlNifEnv, pack: *asset_pack.AssetPack, argv: [*c]const e.ErlNifTerm, asset_type: asset_pack.AssetType) ![]const u8 {
+    const name = core.Binary.get_view(env, argv[1]) catch {
+        return error.invalid_argument_name;
+    };
+
+    return pack.get(name, asset_type) catch {
+        return error.invalid_argument_name;
+    };
+}
+
+//////////////////
+//  Asset pack  //
+//////////////////
+
+/// Load an asset pack, the file is memory mapped and only the index is read
+fn nif_load_asset_pack(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const file_name = core.Binary.get_view(env, argv[0]) catch {
+        return error.invalid_argument_file_name;
+    };
+
+    // Function
+
+    const value = asset_pack.LoadAssetPack(file_name) catch |err| switch (err) {
+        error.OutOfMemory => return err,
+        error.invalid_asset_pack, error.invalid_asset_pack_version => return error.runtime_invalid_asset_pack,
+        else => return error.runtime_failed_to_open_asset_pack,
+    };
+    errdefer asset_pack.UnloadAssetPack(value);
+
+    // Return
+
+    return core.AssetPack.make(env, value) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Get the assets of a pack as a list of {name, type}
+fn nif_get_asset_pack_entries(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const pack = try get_asset_pack(env, argv[0]);
+    defer pack.release();
+
+    // Return
+
+    var term = e.enif_make_list_from_array(env, null, 0);
+
+    var it = pack.entries.iterator();
+    while (it.next()) |entry| {
+        const term_entry = core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Binary.make(env, entry.key_ptr.*),
+            make_asset_type(env, entry.value_ptr.asset_type),
+        });
+        term = e.enif_make_list_cell(env, term_entry, term);
+    }
+
+    return term;
+}
+
+/// Write an asset pack from decoded assets
+///
+/// The entries are a list of {name, type, value}:
+///
+/// - {name, :texture, image}: pixel data written as is (convert the format and generate the mipmaps before)
+/// - {name, :mesh, mesh}: CPU vertex arrays
+/// - {name, :font, font}: atlas read back from the font texture (requires an OpenGL context), recs and glyph infos
+/// - {name, :sound, wave}: PCM data written as is
+fn nif_export_asset_pack(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const file_name = core.Binary.get_view(env, argv[0]) catch {
+        return error.invalid_argument_file_name;
+    };
+
+    if (e.enif_is_list(env, argv[1]) == 0) return error.invalid_argument_entries;
+
+    // Function
+
+    var writer = asset_pack.AssetPackWriter.init(file_name) catch {
+        return error.runtime_failed_to_create_asset_pack;
+    };
+    defer writer.deinit();
+
+    var list = argv[1];
+    var head: e.ErlNifTerm = undefined;
+    while (e.enif_get_list_cell(env, list, &head, &list) != 0) {
+        const record = core.Tuple.get(env, head) catch {
+            return error.invalid_argument_entries;
+        };
+        if (record.len != 3) return error.invalid_argument_entries;
+
+        const name = core.Binary.get_view(env, record[0]) catch {
+            return error.invalid_argument_entries;
+        };
+
+        const asset_type = get_asset_type(env, record[1]) catch {
+            return error.invalid_argument_entries;
+        };
+
+        const written = switch (asset_type) {
+            .texture => blk: {
+                const arg_image = core.Argument(core.Image).get(env, record[2]) catch {
+                    return error.invalid_argument_entries;
+                };
+                defer arg_image.free();
+                const image = arg_image.data;
+
+                const data_size = core.Image.get_data_size(image.width, image.height, image.format, image.mipmaps);
+                break :blk writer.add_texture(name, image, data_size);
+            },
+            .mesh => blk: {
+                const arg_mesh = core.Argument(core.Mesh).get(env, record[2]) catch {
+                    return error.invalid_argument_entries;
+                };
+                defer arg_mesh.free();
+
+                break :blk writer.add_mesh(name, arg_mesh.data);
+            },
+            .font => blk: {
+                const arg_font = core.Argument(core.Font).get(env, record[2]) catch {
+                    return error.invalid_argument_entries;
+                };
+                defer arg_font.free();
+                const font = arg_font.data;
+
+                const atlas = rl.LoadImageFromTexture(font.texture);
+                defer rl.UnloadImage(atlas);
+
+                const data_size = core.Image.get_data_size(atlas.width, atlas.height, atlas.format, atlas.mipmaps);
+                break :blk writer.add_font(name, font, atlas, data_size);
+            },
+            .sound => blk: {
+                const arg_wave = core.Argument(core.Wave).get(env, record[2]) catch {
+                    return error.invalid_argument_entries;
+                };
+                defer arg_wave.free();
+                const wave = arg_wave.data;
+
+                const data_size = core.Wave.get_data_size(wave.frameCount, wave.channels, wave.sampleSize);
+                break :blk writer.add_sound(name, wave, data_size);
+            },
+        };
+
+        written catch |err| switch (err) {
+            error.invalid_asset, error.invalid_asset_name => return error.invalid_argument_entries,
+            error.OutOfMemory => return err,
+            else => return error.runtime_failed_to_write_asset_pack,
+        };
+    }
+
+    writer.finish() catch {
+        return error.runtime_failed_to_write_asset_pack;
+    };
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/////////////////////
+//  Asset loading  //
+/////////////////////
+
+/// Load a texture from an asset pack, uploaded straight from the mapped file
+fn nif_load_texture_from_asset_pack(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Return type
+
+    const return_resource = core.must_return_resource(env, argc, argv, 2);
+
+    // Arguments
+
+    const pack = try get_asset_pack(env, argv[0]);
+    defer pack.release();
+
+    const payload = try get_asset_payload(env, pack, argv, .texture);
+
+    // Function
+
+    const texture = asset_pack.LoadTexture(payload) catch |err| switch (err) {
+        error.invalid_asset => return error.runtime_invalid_asset,
+        else => return error.runtime_failed_to_load_texture,
+    };
+    defer if (!return_resource) core.Texture2D.unload(texture);
+    errdefer if (return_resource) core.Texture2D.unload(texture);
+
+    // Return
+
+    return core.maybe_make_struct_as_resource(core.Texture2D, env, texture, return_resource) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Load a mesh from an asset pack and upload it
+fn nif_load_mesh_from_asset_pack(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Return type
+
+    const return_resource = core.must_return_resource(env, argc, argv, 2);
+
+    // Arguments
+
+    const pack = try get_asset_pack(env, argv[0]);
+    defer pack.release();
+
+    const payload = try get_asset_payload(env, pack, argv, .mesh);
+
+    // Function
+
+    const mesh = asset_pack.LoadMesh(payload) catch |err| switch (err) {
+        error.OutOfMemory => return err,
+        error.invalid_asset => return error.runtime_invalid_asset,
+        else => return error.runtime_failed_to_load_mesh,
+    };
+    defer if (!return_resource) core.Mesh.unload(mesh);
+    errdefer if (return_resource) core.Mesh.unload(mesh);
+
+    // Return
+
+    return core.maybe_make_struct_as_resource(core.Mesh, env, mesh, return_resource) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Load a baked font from an asset pack, the atlas is uploaded straight from the mapped file
+fn nif_load_font_from_asset_pack(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Return type
+
+    const return_resource = core.must_return_resource(env, argc, argv, 2);
+
+    // Arguments
+
+    const pack = try get_asset_pack(env, argv[0]);
+    defer pack.release();
+
+    const payload = try get_asset_payload(env, pack, argv, .font);
+
+    // Function
+
+    const font = asset_pack.LoadFont(payload) catch |err| switch (err) {
+        error.OutOfMemory => return err,
+        error.invalid_asset => return error.runtime_invalid_asset,
+        else => return error.runtime_failed_to_load_font,
+    };
+    defer if (!return_resource) core.Font.unload(font);
+    errdefer if (return_resource) core.Font.unload(font);
+
+    // Return
+
+    return core.maybe_make_struct_as_resource(core.Font, env, font, return_resource) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Load a sound from an asset pack, the PCM data is read straight from the mapped file
+fn nif_load_sound_from_asset_pack(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Return type
+
+    const return_resource = core.must_return_resource(env, argc, argv, 2);
+
+    // Arguments
+
+    const pack = try get_asset_pack(env, argv[0]);
+    defer pack.release();
+
+    const payload = try get_asset_payload(env, pack, argv, .sound);
+
+    // Function
+
+    const sound = asset_pack.LoadSound(payload) catch |err| switch (err) {
+        error.invalid_asset => return error.runtime_invalid_asset,
+        else => return error.runtime_failed_to_load_sound,
+    };
+    defer if (!return_resource) core.Sound.unload(sound);
+    errdefer if (return_resource) core.Sound.unload(sound);
+
+    // Return
+
+    return core.maybe_make_struct_as_resource(core.Sound, env, sound, return_resource) catch {
+        return error.invalid_return;
+    };
+}
@@ -6,6 +6,7 @@ const miniaudio = rl.miniaudio;
 const utils = @import("../utils.zig");
 
 const core = @import("../core.zig");
+const wave_process = @import("../wave_process.zig");
 
 pub const exported_nifs = [_]e.ErlNifFunc{
     // Wave
@@ -71,6 +72,17 @@ pub const exported_nifs = [_]e.ErlNifFunc{
     .{ .name = "load_wave_samples_ex", .arity = 4, .fptr = core.nif_wrapper(nif_load_wave_samples_ex), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "get_wave_info", .arity = 1, .fptr = core.nif_wrapper(nif_get_wave_info), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "get_wave_info", .arity = 2, .fptr = core.nif_wrapper(nif_get_wave_info), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wave_resample_batch", .arity = 3, .fptr = core.nif_wrapper(nif_wave_resample_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wave_resample_batch", .arity = 4, .fptr = core.nif_wrapper(nif_wave_resample_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wave_remix_batch", .arity = 2, .fptr = core.nif_wrapper(nif_wave_remix_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wave_remix_batch", .arity = 3, .fptr = core.nif_wrapper(nif_wave_remix_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wave_normalize_batch", .arity = 2, .fptr = core.nif_wrapper(nif_wave_normalize_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wave_normalize_batch", .arity = 3, .fptr = core.nif_wrapper(nif_wave_normalize_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wave_trim_silence_batch", .arity = 2, .fptr = core.nif_wrapper(nif_wave_trim_silence_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wave_trim_silence_batch", .arity = 3, .fptr = core.nif_wrapper(nif_wave_trim_silence_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_wave_levels_batch", .arity = 1, .fptr = core.nif_wrapper(nif_get_wave_levels_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wave_mix", .arity = 2, .fptr = core.nif_wrapper(nif_wave_mix), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wave_mix", .arity = 3, .fptr = core.nif_wrapper(nif_wave_mix), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
 
     // Sound stream management
     .{ .name = "load_sound_stream", .arity = 1, .fptr = core.nif_wrapper(nif_load_sound_stream), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
@@ -1441,6 +1453,301 @@ fn nif_get_wave_info(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTe
     };
 }
 
+/// Waves of a batch call, the waves are processed in place
+const WaveBatch = struct {
+    items: []Item,
+    waves: []*rl.Wave,
+    made: usize = 0,
+
+    const Item = struct {
+        arg: core.Argument(core.Wave),
+        term: e.ErlNifTerm,
+        resource: ?**rl.Wave,
+        return_resource: bool,
+    };
+
+    /// Get the list of waves from argv[0], index is the position of the return type argument
+    ///
+    /// The waves processed in place must be unique, a resource listed twice would be processed (and its data freed) twice
+    fn get(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm, index: usize, in_place: bool) !WaveBatch {
+        const length = core.Array.get_length(env, argv[0]) catch {
+            return error.invalid_argument_waves;
+        };
+
+        const items = try rl.allocator.alloc(Item, length);
+        errdefer rl.allocator.free(items);
+
+        const waves = try rl.allocator.alloc(*rl.Wave, length);
+        errdefer rl.allocator.free(waves);
+
+        var count: usize = 0;
+        errdefer for (items[0..count]) |item| item.arg.free();
+
+        var list = argv[0];
+        var head: e.ErlNifTerm = undefined;
+        while (e.enif_get_list_cell(env, list, &head, &list) != 0) {
+            const arg_wave = core.Argument(core.Wave).get(env, head) catch {
+                return error.invalid_argument_waves;
+            };
+
+            items[count] = .{
+                .arg = arg_wave,
+                .term = head,
+                .resource = if (arg_wave.keep) (core.Wave.Resource.get(env, head) catch null) else null,
+                .return_resource = core.must_return_resource_auto(env, argc, argv, index, head),
+            };
+            waves[count] = &items[count].arg.data;
+            count += 1;
+
+            if (!in_place) continue;
+            if (items[count - 1].resource) |resource| {
+                for (items[0 .. count - 1]) |item| {
+                    if (item.resource == resource) return error.invalid_argument_waves;
+                }
+            }
+        }
+
+        return WaveBatch{
+            .items = items,
+            .waves = waves,
+        };
+    }
+
+    /// Free the waves, except the ones already returned as resources
+    fn deinit(self: *WaveBatch) void {
+        for (self.items, 0..) |item, i| {
+            if (!item.return_resource or i >= self.made) item.arg.free();
+        }
+
+        rl.allocator.free(self.waves);
+        rl.allocator.free(self.items);
+    }
+
+    /// Update all the resources with their processed wave, the data of the processed ones was replaced
+    fn write_back(self: *WaveBatch, env: ?*e.ErlNifEnv) void {
+        for (self.items) |item| {
+            // The resource was already fetched in get()
+            if (item.resource != null) core.Wave.Resource.update(env, item.term, item.arg.data) catch unreachable;
+        }
+    }
+
+    fn make(self: *WaveBatch, env: ?*e.ErlNifEnv) !e.ErlNifTerm {
+        const terms = try rl.allocator.alloc(e.ErlNifTerm, self.items.len);
+        defer rl.allocator.free(terms);
+
+        for (self.items, 0..) |item, i| {
+            terms[i] = try core.maybe_make_struct_or_resource(core.Wave, env, item.term, item.arg.data, item.return_resource);
+            self.made += 1;
+        }
+
+        return e.enif_make_list_from_array(env, terms.ptr, @intCast(terms.len));
+    }
+};
+
+/// Resample many waves to the same sample rate in one call (quality :linear, :cubic or :sinc), the waves are processed in parallel
+fn nif_wave_resample_batch(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3 or argc == 4);
+
+    // Arguments
+
+    const sample_rate = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_sample_rate;
+    };
+
+    const quality = get_resample_quality(env, argv[2]) catch {
+        return error.invalid_argument_quality;
+    };
+
+    var batch = try WaveBatch.get(env, argc, argv, 3, true);
+    defer batch.deinit();
+
+    // Function
+
+    const processed = wave_process.WaveResampleBatch(batch.waves, sample_rate, quality);
+    batch.write_back(env);
+    processed catch |err| switch (err) {
+        error.invalid_wave => return error.invalid_argument_waves,
+        error.invalid_sample_rate => return error.invalid_argument_sample_rate,
+        else => return err,
+    };
+
+    // Return
+
+    return batch.make(env) catch {
+        return error.invalid_return;
+    };
+}
+
+fn get_resample_quality(env: ?*e.ErlNifEnv, term: e.ErlNifTerm) !wave_process.Quality {
+    const name = try core.Atom.get(rl.allocator, env, term);
+    defer core.Atom.free(rl.allocator, name);
+
+    return std.meta.stringToEnum(wave_process.Quality, name) orelse error.ArgumentError;
+}
+
+/// Change the channel count of many waves in one call, the waves are processed in parallel
+fn nif_wave_remix_batch(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Arguments
+
+    const channels = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_channels;
+    };
+
+    var batch = try WaveBatch.get(env, argc, argv, 2, true);
+    defer batch.deinit();
+
+    // Function
+
+    const processed = wave_process.WaveRemixBatch(batch.waves, channels);
+    batch.write_back(env);
+    processed catch |err| switch (err) {
+        error.invalid_wave => return error.invalid_argument_waves,
+        error.invalid_channels => return error.invalid_argument_channels,
+        else => return err,
+    };
+
+    // Return
+
+    return batch.make(env) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Scale many waves so that their peak reaches the same level in one call, the waves are processed in parallel
+fn nif_wave_normalize_batch(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Arguments
+
+    const peak = core.Float.get(env, argv[1]) catch {
+        return error.invalid_argument_peak;
+    };
+
+    var batch = try WaveBatch.get(env, argc, argv, 2, true);
+    defer batch.deinit();
+
+    // Function
+
+    const processed = wave_process.WaveNormalizeBatch(batch.waves, peak);
+    batch.write_back(env);
+    processed catch |err| switch (err) {
+        error.invalid_wave => return error.invalid_argument_waves,
+        else => return err,
+    };
+
+    // Return
+
+    return batch.make(env) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Remove the leading and trailing frames below a threshold of many waves in one call, the waves are processed in parallel
+fn nif_wave_trim_silence_batch(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Arguments
+
+    const threshold = core.Float.get(env, argv[1]) catch {
+        return error.invalid_argument_threshold;
+    };
+
+    var batch = try WaveBatch.get(env, argc, argv, 2, true);
+    defer batch.deinit();
+
+    // Function
+
+    const processed = wave_process.WaveTrimSilenceBatch(batch.waves, threshold);
+    batch.write_back(env);
+    processed catch |err| switch (err) {
+        error.invalid_wave => return error.invalid_argument_waves,
+        else => return err,
+    };
+
+    // Return
+
+    return batch.make(env) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Get the levels of many waves in one call, returns a list of {peak, rms}
+fn nif_get_wave_levels_batch(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    var batch = try WaveBatch.get(env, argc, argv, 1, false);
+    defer batch.deinit();
+
+    // Function
+
+    const levels = try rl.allocator.alloc(wave_process.Levels, batch.waves.len);
+    defer rl.allocator.free(levels);
+
+    wave_process.GetWaveLevelsBatch(batch.waves, levels) catch |err| switch (err) {
+        error.invalid_wave => return error.invalid_argument_waves,
+        else => return err,
+    };
+
+    // Return
+
+    const terms = try rl.allocator.alloc(e.ErlNifTerm, levels.len);
+    defer rl.allocator.free(terms);
+
+    for (levels, 0..) |level, i| {
+        terms[i] = core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Float.make(env, level.peak),
+            core.Float.make(env, level.rms),
+        });
+    }
+
+    return e.enif_make_list_from_array(env, terms.ptr, @intCast(terms.len));
+}
+
+/// Mix waves (same sample rate and channels) into a new wave as long as the longest one, each wave scaled by its gain
+fn nif_wave_mix(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Return type
+
+    const return_resource = core.must_return_resource(env, argc, argv, 2);
+
+    // Arguments
+
+    var batch = try WaveBatch.get(env, argc, argv, 2, false);
+    defer batch.deinit();
+
+    const gains = try rl.allocator.alloc(f32, batch.waves.len);
+    defer rl.allocator.free(gains);
+
+    var count: usize = 0;
+    var list = argv[1];
+    var head: e.ErlNifTerm = undefined;
+    while (e.enif_get_list_cell(env, list, &head, &list) != 0) : (count += 1) {
+        if (count >= gains.len) return error.invalid_argument_gains;
+
+        gains[count] = core.Float.get(env, head) catch {
+            return error.invalid_argument_gains;
+        };
+    }
+    if (count != gains.len) return error.invalid_argument_gains;
+
+    // Function
+
+    const wave = try wave_process.WaveMix(batch.waves, gains);
+    defer if (!return_resource) core.Wave.unload(wave);
+    errdefer if (return_resource) core.Wave.unload(wave);
+
+    // Return
+
+    return core.maybe_make_struct_as_resource(core.Wave, env, wave, return_resource) catch {
+        return error.invalid_return;
+    };
+}
+
 ///////////////////////////////
 //  Sound stream management  //
 ///////////////////////////////
@@ -0,0 +1,140 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+
+const core = @import("../core.zig");
+const display_list = @import("../display_list.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Recording
+    .{ .name = "begin_display_list_record", .arity = 1, .fptr = core.nif_wrapper(nif_begin_display_list_record), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "end_display_list_record", .arity = 1, .fptr = core.nif_wrapper(nif_end_display_list_record), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "is_display_list_recording", .arity = 0, .fptr = core.nif_wrapper(nif_is_display_list_recording), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Drawing
+    .{ .name = "draw_display_list", .arity = 3, .fptr = core.nif_wrapper(nif_draw_display_list), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_display_list_info", .arity = 1, .fptr = core.nif_wrapper(nif_get_display_list_info), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+/////////////////
+//  Recording  //
+/////////////////
+
+/// Record the following draw calls instead of drawing them
+///
+/// NOTE: Must be called between begin_drawing and end_drawing, draw calls past max_vertices are not recorded
+fn nif_begin_display_list_record(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const max_vertices = core.UInt.get(env, argv[0]) catch {
+        return error.invalid_argument_max_vertices;
+    };
+
+    // Function
+
+    try display_list.BeginDisplayListRecord(max_vertices);
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Stop recording, returns the display list resource (triangles moved to static buffers when upload_static is true)
+fn nif_end_display_list_record(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const upload_static = core.Boolean.get(env, argv[0]) catch {
+        return error.invalid_argument_upload_static;
+    };
+
+    // Function
+
+    const list = try display_list.EndDisplayListRecord(upload_static);
+    errdefer {
+        display_list.UnloadDisplayList(list);
+        list.deinit();
+    }
+
+    // Return
+
+    return core.DisplayList.make(env, list) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Check if draw calls are being recorded
+fn nif_is_display_list_recording(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Return
+
+    return core.Boolean.make(env, display_list.IsDisplayListRecording());
+}
+
+///////////////
+//  Drawing  //
+///////////////
+
+/// Draw a display list under a transform (nil for none) with a tint (nil for none)
+fn nif_draw_display_list(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3);
+
+    // Arguments
+
+    const list = core.DisplayList.get(env, argv[0]) catch {
+        return error.invalid_argument_list;
+    };
+
+    const nil = core.Atom.make(env, "nil");
+
+    var transform = rl.MatrixIdentity();
+    if (e.enif_is_identical(nil, argv[1]) == 0) {
+        const arg_transform = core.Argument(core.Matrix).get(env, argv[1]) catch {
+            return error.invalid_argument_transform;
+        };
+        defer arg_transform.free();
+        transform = arg_transform.data;
+    }
+
+    var tint = rl.Color{ .r = 255, .g = 255, .b = 255, .a = 255 };
+    if (e.enif_is_identical(nil, argv[2]) == 0) {
+        const arg_tint = core.Argument(core.Color).get(env, argv[2]) catch {
+            return error.invalid_argument_tint;
+        };
+        defer arg_tint.free();
+        tint = arg_tint.data;
+    }
+
+    // Function
+
+    list.draw(transform, tint);
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Get the size of a display list, returns {vertex_count, draw_call_count, static_draw_call_count}
+fn nif_get_display_list_info(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const list = core.DisplayList.get(env, argv[0]) catch {
+        return error.invalid_argument_list;
+    };
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        e.enif_make_uint64(env, list.get_vertex_count()),
+        e.enif_make_uint64(env, list.segments.len),
+        e.enif_make_uint64(env, list.get_static_segment_count()),
+    });
+}
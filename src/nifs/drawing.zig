@@ -4,6 +4,7 @@ const e = @import("../erl_nif.zig");
 const rl = @import("../raylib.zig");
 
 const core = @import("../core.zig");
+const reclaim = @import("../reclaim.zig");
 
 pub const exported_nifs = [_]e.ErlNifFunc{
     // Drawing
@@ -17,6 +18,7 @@ pub const exported_nifs = [_]e.ErlNifFunc{
     .{ .name = "begin_texture_mode", .arity = 1, .fptr = core.nif_wrapper(nif_begin_texture_mode), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "end_texture_mode", .arity = 0, .fptr = core.nif_wrapper(nif_end_texture_mode), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "begin_shader_mode", .arity = 1, .fptr = core.nif_wrapper(nif_begin_shader_mode), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "begin_shader_mode", .arity = 2, .fptr = core.nif_wrapper(nif_begin_shader_mode), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "end_shader_mode", .arity = 0, .fptr = core.nif_wrapper(nif_end_shader_mode), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "begin_blend_mode", .arity = 1, .fptr = core.nif_wrapper(nif_begin_blend_mode), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "end_blend_mode", .arity = 0, .fptr = core.nif_wrapper(nif_end_blend_mode), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
@@ -84,6 +86,9 @@ fn nif_end_drawing(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm
 
     rl.EndDrawing();
 
+    // Payloads of garbage collected resources, after the batch using them is drawn
+    reclaim.end_frame();
+
     // Return
 
     return core.Atom.make(env, "ok");
@@ -214,10 +219,12 @@ fn nif_end_texture_mode(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNi
 
 /// Begin custom shader drawing
 ///
+/// The dirty uniforms of the optional uniform set are uploaded (it must be loaded for the shader)
+///
 /// raylib.h
 /// RLAPI void BeginShaderMode(Shader shader);
 fn nif_begin_shader_mode(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
-    assert(argc == 1);
+    assert(argc == 1 or argc == 2);
 
     // Arguments
 
@@ -227,10 +234,23 @@ fn nif_begin_shader_mode(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlN
     defer arg_shader.free();
     const shader = arg_shader.data;
 
+    const uniforms = if (argc == 2) core.UniformSet.get(env, argv[1]) catch {
+        return error.invalid_argument_uniform_set;
+    } else null;
+
+    // The uniform locations belong to the shader the set was loaded for
+    if (uniforms) |value| {
+        if (value.shader_id != shader.id) return error.invalid_argument_uniform_set;
+    }
+
     // Function
 
     rl.BeginShaderMode(shader);
 
+    if (uniforms) |value| {
+        _ = value.apply();
+    }
+
     // Return
 
     return core.Atom.make(env, "ok");
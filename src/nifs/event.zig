@@ -0,0 +1,293 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+const utils = @import("../utils.zig");
+
+const core = @import("../core.zig");
+const events = @import("../events.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Event subscription
+    .{ .name = "subscribe_events", .arity = 1, .fptr = core.nif_wrapper(nif_subscribe_events), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "subscribe_events", .arity = 2, .fptr = core.nif_wrapper(nif_subscribe_events), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "unsubscribe_events", .arity = 0, .fptr = core.nif_wrapper(nif_unsubscribe_events), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wait_events", .arity = 0, .fptr = core.nif_wrapper(nif_wait_events), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wait_events", .arity = 1, .fptr = core.nif_wrapper(nif_wait_events), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "wake_events", .arity = 0, .fptr = core.nif_wrapper(nif_wake_events), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_event_stats", .arity = 0, .fptr = core.nif_wrapper(nif_get_event_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+/// Thread sending the queued events to the subscribed pid
+const EventSender = struct {
+    pid: e.ErlNifPid,
+    thread: std.Thread = undefined,
+    running: std.atomic.Value(bool) = std.atomic.Value(bool).init(true),
+};
+
+var event_sender: ?*EventSender = null;
+
+var sent_events = std.atomic.Value(u64).init(0);
+var sent_batches = std.atomic.Value(u64).init(0);
+
+fn make_action(env: ?*e.ErlNifEnv, action: c_int) e.ErlNifTerm {
+    return switch (action) {
+        events.EVENT_ACTION_PRESS => core.Atom.make(env, "press"),
+        events.EVENT_ACTION_REPEAT => core.Atom.make(env, "repeat"),
+        else => core.Atom.make(env, "release"),
+    };
+}
+
+fn make_event(env: ?*e.ErlNifEnv, event: events.Event) e.ErlNifTerm {
+    return switch (event.event_type) {
+        .key => core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Atom.make(env, "key"),
+            core.Int.make(env, event.a),
+            make_action(env, event.c),
+            core.Int.make(env, event.d),
+        }),
+        .char => core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Atom.make(env, "char"),
+            core.Int.make(env, event.a),
+        }),
+        .mouse_button => core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Atom.make(env, "mouse_button"),
+            core.Int.make(env, event.a),
+            make_action(env, event.c),
+            core.Int.make(env, event.d),
+        }),
+        .mouse_move => core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Atom.make(env, "mouse_move"),
+            core.Double.make(env, event.x),
+            core.Double.make(env, event.y),
+        }),
+        .mouse_wheel => core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Atom.make(env, "mouse_wheel"),
+            core.Double.make(env, event.x),
+            core.Double.make(env, event.y),
+        }),
+        .gamepad => core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Atom.make(env, "gamepad"),
+            core.Int.make(env, event.a),
+            core.Atom.make(env, if (event.c != 0) "connected" else "disconnected"),
+        }),
+        .resize => core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Atom.make(env, "resize"),
+            core.Int.make(env, event.a),
+            core.Int.make(env, event.b),
+        }),
+        .focus => core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Atom.make(env, "focus"),
+            core.Boolean.make(env, event.c != 0),
+        }),
+        .file_drop => blk: {
+            var paths = e.enif_make_list_from_array(env, null, 0);
+            if (event.paths) |values| {
+                var i = values.len;
+                while (i > 0) {
+                    i -= 1;
+                    paths = e.enif_make_list_cell(env, core.Binary.make(env, values[i]), paths);
+                }
+            }
+
+            break :blk core.Tuple.make(env, &[_]e.ErlNifTerm{
+                core.Atom.make(env, "file_drop"),
+                paths,
+            });
+        },
+        .close => core.Atom.make(env, "close"),
+    };
+}
+
+/// Send the queued events as one message {:zexray_events, events}
+///
+/// NOTE: Consecutive mouse moves are coalesced, only the last position is sent
+fn FlushEvents(sender: *EventSender) void {
+    const env: ?*e.ErlNifEnv = e.enif_alloc_env();
+    defer e.enif_free_env(env);
+
+    var terms: [events.EVENT_QUEUE_CAPACITY]e.ErlNifTerm = undefined;
+    var count: usize = 0;
+    var last_is_move = false;
+
+    while (count < terms.len) {
+        var event = events.queue.pop() orelse break;
+        defer event.deinit();
+
+        const is_move = event.event_type == .mouse_move;
+        if (is_move and last_is_move) count -= 1;
+        last_is_move = is_move;
+
+        terms[count] = make_event(env, event);
+        count += 1;
+    }
+
+    if (count == 0) return;
+
+    const msg = core.Tuple.make(env, &[_]e.ErlNifTerm{
+        core.Atom.make(env, "zexray_events"),
+        e.enif_make_list_from_array(env, &terms, @intCast(count)),
+    });
+
+    if (e.enif_send(null, &sender.pid, env, msg) == 0) {
+        utils.TRACELOG(rl.LOG_WARNING, "EVENTS: Failed to send events", .{});
+        return;
+    }
+
+    _ = sent_events.fetchAdd(count, .monotonic);
+    _ = sent_batches.fetchAdd(1, .monotonic);
+}
+
+/// Sleep until events are pushed, then flush them
+fn SendEvents(sender: *EventSender) void {
+    while (true) {
+        events.queue.signal.wait();
+        events.queue.signal.reset();
+
+        const running = sender.running.load(.acquire);
+        FlushEvents(sender);
+        if (!running) break;
+    }
+}
+
+fn StartEventSender(pid: e.ErlNifPid) !void {
+    const sender = try rl.allocator.create(EventSender);
+    errdefer rl.allocator.destroy(sender);
+
+    sender.* = EventSender{ .pid = pid };
+    sender.thread = try std.Thread.spawn(.{}, SendEvents, .{sender});
+
+    event_sender = sender;
+}
+
+fn StopEventSender() void {
+    if (event_sender) |sender| {
+        sender.running.store(false, .release);
+        events.queue.signal.set();
+        sender.thread.join();
+
+        rl.allocator.destroy(sender);
+        event_sender = null;
+    }
+
+    // Events pushed after the last flush are not delivered
+    events.queue.clear();
+}
+
+/// Stop the subscription and join the sender thread, it runs code of this library
+pub fn deinit() void {
+    events.Unsubscribe();
+    StopEventSender();
+}
+
+//////////////////////////
+//  Event subscription  //
+//////////////////////////
+
+/// Send window and input events to a pid
+///
+/// The events selected by the mask (all by default) are pushed by the GLFW callbacks to a lock-free queue
+/// and sent in batches as {:zexray_events, events} messages, see events.zig for the event types
+///
+/// NOTE: Replaces the previous subscription, the window must be initialized
+fn nif_subscribe_events(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1 or argc == 2);
+
+    // Arguments
+
+    const pid = core.Pid.get(env, argv[0]) catch {
+        return error.invalid_argument_pid;
+    };
+
+    var mask = events.EVENT_ALL;
+    if (argc == 2) {
+        mask = core.UInt.get(env, argv[1]) catch {
+            return error.invalid_argument_mask;
+        };
+    }
+
+    // Function
+
+    events.Unsubscribe();
+    StopEventSender();
+
+    try StartEventSender(pid);
+    errdefer StopEventSender();
+
+    try events.Subscribe(mask);
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Stop sending events, the pending events are dropped
+fn nif_unsubscribe_events(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Function
+
+    events.Unsubscribe();
+    StopEventSender();
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Wait for events (without timeout by default), the window callbacks are called
+///
+/// NOTE: Runs on a dirty CPU scheduler like the other window NIFs: GLFW calls the callbacks
+/// (the only producer of the event queue) on the thread processing the events, so it must be
+/// called from the process owning the window. It blocks a dirty scheduler until the events
+/// arrive, use a timeout or wake_events/0 to return.
+/// The raylib input state is not advanced (use it only while idle, between frames)
+fn nif_wait_events(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0 or argc == 1);
+
+    // Arguments
+
+    var timeout: ?f64 = null;
+    if (argc == 1 and e.enif_is_identical(core.Atom.make(env, "nil"), argv[0]) == 0) {
+        timeout = core.Double.get(env, argv[0]) catch {
+            return error.invalid_argument_timeout;
+        };
+    }
+
+    // Function
+
+    try events.WaitEvents(timeout);
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Wake up a pending wait_events (from any process)
+fn nif_wake_events(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Function
+
+    try events.WakeEvents();
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Get the event statistics: {events sent, messages sent, events dropped (queue full)}
+fn nif_get_event_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        e.enif_make_uint64(env, sent_events.load(.monotonic)),
+        e.enif_make_uint64(env, sent_batches.load(.monotonic)),
+        e.enif_make_uint64(env, events.queue.dropped.load(.monotonic)),
+    });
+}
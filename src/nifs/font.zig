@@ -38,14 +38,23 @@ fn nif_get_font_default(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNi
     // Function
 
     const font = rl.GetFontDefault();
-    defer if (!return_resource) core.Font.unload(font);
-    errdefer if (return_resource) core.Font.unload(font);
+    // Do NOT free font
 
     // Return
 
-    return core.maybe_make_struct_as_resource(core.Font, env, font, return_resource) catch {
-        return error.invalid_return;
-    };
+    if (return_resource) {
+        const resource = core.Font.Resource.create(font) catch {
+            return error.invalid_return;
+        };
+        defer core.Font.Resource.release(resource);
+
+        // Not reclaimed when garbage collected
+        core.Font.Resource.disown(resource);
+
+        return core.Font.Resource.make(env, resource);
+    }
+
+    return core.Font.make(env, font);
 }
 
 /// Load font from file into GPU memory (VRAM)
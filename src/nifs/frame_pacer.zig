@@ -0,0 +1,145 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+
+const core = @import("../core.zig");
+const frame_pacer = @import("../frame_pacer.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Pacing
+    .{ .name = "set_frame_pacer", .arity = 4, .fptr = core.nif_wrapper(nif_set_frame_pacer), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "end_paced_frame", .arity = 2, .fptr = core.nif_wrapper(nif_end_paced_frame), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Stats
+    .{ .name = "get_frame_pacer_stats", .arity = 0, .fptr = core.nif_wrapper(nif_get_frame_pacer_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "reset_frame_pacer_stats", .arity = 0, .fptr = core.nif_wrapper(nif_reset_frame_pacer_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+//////////////
+//  Pacing  //
+//////////////
+
+/// Set the frame pacing (0 for none), the fixed timestep (0 for none), the fixed steps per frame at most and the spin time (in microseconds)
+fn nif_set_frame_pacer(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 4);
+
+    // Arguments
+
+    const target_fps = core.UInt.get(env, argv[0]) catch {
+        return error.invalid_argument_target_fps;
+    };
+
+    const fixed_fps = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_fixed_fps;
+    };
+
+    const max_steps = core.UInt.get(env, argv[2]) catch {
+        return error.invalid_argument_max_steps;
+    };
+
+    const spin_us = core.UInt.get(env, argv[3]) catch {
+        return error.invalid_argument_spin_us;
+    };
+
+    // Function
+
+    frame_pacer.SetFramePacer(.{
+        .target_fps = target_fps,
+        .fixed_fps = fixed_fps,
+        .max_steps = max_steps,
+        .spin_ns = @as(u64, spin_us) * std.time.ns_per_us,
+    });
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// End a frame: swap the screen buffer, wait for the frame deadline and poll the input events,
+/// returns {fixed_steps, alpha, frame_time}
+///
+/// NOTE: Made for custom frame control, EndDrawing already swaps, waits and polls otherwise
+fn nif_end_paced_frame(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const swap = core.Boolean.get(env, argv[0]) catch {
+        return error.invalid_argument_swap;
+    };
+
+    const poll = core.Boolean.get(env, argv[1]) catch {
+        return error.invalid_argument_poll;
+    };
+
+    // Function
+
+    if (swap) rl.SwapScreenBuffer();
+
+    const frame = try frame_pacer.EndPacedFrame();
+
+    if (poll) rl.PollInputEvents();
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        core.UInt.make(env, frame.steps),
+        core.Double.make(env, frame.alpha),
+        core.Double.make(env, frame.frame_time),
+    });
+}
+
+/////////////
+//  Stats  //
+/////////////
+
+/// Get the frame pacer stats, returns
+/// {frames, missed, dropped_steps, window_frames, {mean, min, max, stddev, jitter, p50, p99}, {bucket_width, histogram}}
+fn nif_get_frame_pacer_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Function
+
+    const stats = frame_pacer.GetFramePacerStats();
+
+    // Return
+
+    var term_histogram: [frame_pacer.FRAME_PACER_HISTOGRAM_BUCKETS]e.ErlNifTerm = undefined;
+    for (stats.histogram, 0..) |count, i| term_histogram[i] = core.UInt.make(env, count);
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        e.enif_make_uint64(env, stats.frames),
+        e.enif_make_uint64(env, stats.missed),
+        e.enif_make_uint64(env, stats.dropped_steps),
+        e.enif_make_uint64(env, stats.window_frames),
+        core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Double.make(env, stats.mean),
+            core.Double.make(env, stats.min),
+            core.Double.make(env, stats.max),
+            core.Double.make(env, stats.stddev),
+            core.Double.make(env, stats.jitter),
+            core.Double.make(env, stats.p50),
+            core.Double.make(env, stats.p99),
+        }),
+        core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Double.make(env, stats.bucket_width),
+            e.enif_make_list_from_array(env, &term_histogram, term_histogram.len),
+        }),
+    });
+}
+
+/// Restart the frame pacer counters and frame time window
+fn nif_reset_frame_pacer_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Function
+
+    frame_pacer.ResetFramePacerStats();
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
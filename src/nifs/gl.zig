@@ -32,6 +32,7 @@ pub const exported_nifs = [_]e.ErlNifFunc{
     .{ .name = "rl_color4_byte", .arity = 4, .fptr = core.nif_wrapper(nif_rl_color4_byte), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "rl_color3", .arity = 3, .fptr = core.nif_wrapper(nif_rl_color3), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "rl_color4", .arity = 4, .fptr = core.nif_wrapper(nif_rl_color4), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "rl_vertices", .arity = 3, .fptr = core.nif_wrapper(nif_rl_vertices), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
 
     // Render management
     .{ .name = "rl_set_texture", .arity = 1, .fptr = core.nif_wrapper(nif_rl_set_texture), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
@@ -664,6 +665,130 @@ fn nif_rl_color4(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm)
     return core.Atom.make(env, "ok");
 }
 
+/// Vertex layout flags of the packed vertex binaries (attributes are stored in this order)
+const VERTEX_LAYOUT_POSITION2: c_int = 0x01; // 2 float
+const VERTEX_LAYOUT_POSITION3: c_int = 0x02; // 3 float
+const VERTEX_LAYOUT_TEXCOORD: c_int = 0x04; // 2 float
+const VERTEX_LAYOUT_NORMAL: c_int = 0x08; // 3 float
+const VERTEX_LAYOUT_COLOR: c_int = 0x10; // 4 unsigned byte
+const VERTEX_LAYOUT_ALL: c_int = VERTEX_LAYOUT_POSITION2 | VERTEX_LAYOUT_POSITION3 | VERTEX_LAYOUT_TEXCOORD | VERTEX_LAYOUT_NORMAL | VERTEX_LAYOUT_COLOR;
+
+fn read_float(data: []const u8, offset: usize) f32 {
+    return std.mem.bytesToValue(f32, data[offset..][0..@sizeOf(f32)]);
+}
+
+/// Define many vertices from a packed binary (interleaved attributes, native endianness)
+///
+/// Returns the number of vertices drawn
+///
+/// NOTE: The vertices are submitted in chunks of whole primitives,
+/// the render batch is flushed before a chunk that would overflow it
+fn nif_rl_vertices(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3);
+
+    // Arguments
+
+    const mode = core.Int.get(env, argv[0]) catch {
+        return error.invalid_argument_mode;
+    };
+
+    const layout = core.Int.get(env, argv[1]) catch {
+        return error.invalid_argument_layout;
+    };
+
+    if ((layout & ~VERTEX_LAYOUT_ALL) != 0) {
+        return error.invalid_argument_layout;
+    }
+
+    const data = core.Binary.get_view(env, argv[2]) catch {
+        return error.invalid_argument_data;
+    };
+
+    const has_position2 = (layout & VERTEX_LAYOUT_POSITION2) != 0;
+    const has_position3 = (layout & VERTEX_LAYOUT_POSITION3) != 0;
+    const has_texcoord = (layout & VERTEX_LAYOUT_TEXCOORD) != 0;
+    const has_normal = (layout & VERTEX_LAYOUT_NORMAL) != 0;
+    const has_color = (layout & VERTEX_LAYOUT_COLOR) != 0;
+
+    if (has_position2 == has_position3) {
+        return error.invalid_argument_layout;
+    }
+
+    const primitive_size: usize = switch (mode) {
+        rl.RL_LINES => 2,
+        rl.RL_TRIANGLES => 3,
+        rl.RL_QUADS => 4,
+        else => return error.invalid_argument_mode,
+    };
+
+    var stride: usize = if (has_position2) 2 * @sizeOf(f32) else 3 * @sizeOf(f32);
+    if (has_texcoord) stride += 2 * @sizeOf(f32);
+    if (has_normal) stride += 3 * @sizeOf(f32);
+    if (has_color) stride += 4;
+
+    if (data.len % stride != 0) {
+        return error.invalid_argument_data;
+    }
+
+    const vertex_count = data.len / stride;
+
+    if (vertex_count % primitive_size != 0) {
+        return error.invalid_argument_data;
+    }
+
+    // Function
+
+    // Leave room for one primitive, rlgl checks the limit before accepting a vertex
+    const batch_vertices: usize = rl.RL_DEFAULT_BATCH_BUFFER_ELEMENTS * 4;
+    const chunk_vertices: usize = ((batch_vertices - primitive_size) / primitive_size) * primitive_size;
+
+    var first: usize = 0;
+    while (first < vertex_count) {
+        const count = @min(chunk_vertices, vertex_count - first);
+
+        _ = rl.rlCheckRenderBatchLimit(@intCast(count));
+
+        rl.rlBegin(mode);
+
+        for (first..first + count) |i| {
+            var offset = i * stride;
+
+            const position_offset = offset;
+            offset += if (has_position2) 2 * @sizeOf(f32) else 3 * @sizeOf(f32);
+
+            // Attributes must be set before the vertex position
+            if (has_texcoord) {
+                rl.rlTexCoord2f(read_float(data, offset), read_float(data, offset + 4));
+                offset += 2 * @sizeOf(f32);
+            }
+
+            if (has_normal) {
+                rl.rlNormal3f(read_float(data, offset), read_float(data, offset + 4), read_float(data, offset + 8));
+                offset += 3 * @sizeOf(f32);
+            }
+
+            if (has_color) {
+                rl.rlColor4ub(data[offset], data[offset + 1], data[offset + 2], data[offset + 3]);
+                offset += 4;
+            }
+
+            if (has_position2) {
+                rl.rlVertex2f(read_float(data, position_offset), read_float(data, position_offset + 4));
+            } else {
+                rl.rlVertex3f(read_float(data, position_offset), read_float(data, position_offset + 4), read_float(data, position_offset + 8));
+            }
+        }
+
+        rl.rlEnd();
+
+        first += count;
+    }
+
+    // Return
+
+    return core.UInt.make(env, @intCast(vertex_count));
+}
+
 /////////////////////////
 //  Render management  //
 /////////////////////////
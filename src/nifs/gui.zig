@@ -4,6 +4,7 @@ const e = @import("../erl_nif.zig");
 const rl = @import("../raylib.zig");
 
 const core = @import("../core.zig");
+const gui_frame = @import("../gui_frame.zig");
 
 pub const exported_nifs = [_]e.ErlNifFunc{
     // Global gui state control functions
@@ -90,6 +91,10 @@ pub const exported_nifs = [_]e.ErlNifFunc{
     .{ .name = "gui_color_picker_hsv", .arity = 4, .fptr = core.nif_wrapper(nif_gui_color_picker_hsv), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "gui_color_panel_hsv", .arity = 3, .fptr = core.nif_wrapper(nif_gui_color_panel_hsv), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "gui_color_panel_hsv", .arity = 4, .fptr = core.nif_wrapper(nif_gui_color_panel_hsv), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Declarative frame
+    .{ .name = "gui_frame", .arity = 1, .fptr = core.nif_wrapper(nif_gui_frame), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "gui_frame_reset", .arity = 0, .fptr = core.nif_wrapper(nif_gui_frame_reset), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
 };
 
 //////////////////////////////////////////
@@ -284,14 +289,23 @@ fn nif_gui_get_font(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTer
     // Function
 
     const font = rl.GuiGetFont();
-    defer if (!return_resource) core.Font.unload(font);
-    errdefer if (return_resource) core.Font.unload(font);
+    // Do NOT free font
 
     // Return
 
-    return core.maybe_make_struct_as_resource(core.Font, env, font, return_resource) catch {
-        return error.invalid_return;
-    };
+    if (return_resource) {
+        const resource = core.Font.Resource.create(font) catch {
+            return error.invalid_return;
+        };
+        defer core.Font.Resource.release(resource);
+
+        // Not reclaimed when garbage collected
+        core.Font.Resource.disown(resource);
+
+        return core.Font.Resource.make(env, resource);
+    }
+
+    return core.Font.make(env, font);
 }
 
 ///////////////////////////////
@@ -2155,3 +2169,324 @@ fn nif_gui_color_panel_hsv(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.Er
         return error.invalid_return;
     };
 }
+
+/////////////////////////
+//  Declarative frame  //
+/////////////////////////
+
+const FrameItem = enum {
+    // Global state
+    enable,
+    disable,
+    lock,
+    unlock,
+    state,
+    style,
+
+    // Containers
+    window_box,
+    group_box,
+    panel,
+    scroll_panel,
+
+    // Controls
+    label,
+    button,
+    label_button,
+    toggle,
+    toggle_group,
+    toggle_slider,
+    check_box,
+    combo_box,
+    dropdown_box,
+    spinner,
+    value_box,
+    text_box,
+    slider,
+    slider_bar,
+    progress_bar,
+    status_bar,
+    dummy_rec,
+    line,
+    list_view,
+    color_picker,
+};
+
+/// Runs the items of a gui_frame call, the texts live in the arena until the call returns
+const Frame = struct {
+    env: ?*e.ErlNifEnv,
+    arena: std.mem.Allocator,
+    interactions: std.ArrayListUnmanaged(e.ErlNifTerm) = .{},
+
+    fn emit(self: *Frame, id: e.ErlNifTerm, value: e.ErlNifTerm) !void {
+        try self.interactions.append(self.arena, core.Tuple.make(self.env, &[_]e.ErlNifTerm{ id, value }));
+    }
+
+    fn get_kind(self: *Frame, term: e.ErlNifTerm) !FrameItem {
+        const name = try core.Atom.get(self.arena, self.env, term);
+        return std.meta.stringToEnum(FrameItem, name) orelse error.ArgumentError;
+    }
+
+    /// State kept by id, the whole id is compared (not a hash of it)
+    fn get_state(self: *Frame, id: e.ErlNifTerm) !*gui_frame.ControlState {
+        var binary: e.ErlNifBinary = undefined;
+        if (e.enif_term_to_binary(self.env, id, &binary) == 0) return error.OutOfMemory;
+        defer e.enif_release_binary(&binary);
+
+        return gui_frame.get(binary.data[0..binary.size]);
+    }
+
+    fn get_bounds(self: *Frame, term: e.ErlNifTerm, origin: rl.Vector2) !rl.Rectangle {
+        var bounds = try core.Rectangle.get(self.env, term);
+        bounds.x += origin.x;
+        bounds.y += origin.y;
+        return bounds;
+    }
+
+    fn get_text(self: *Frame, term: e.ErlNifTerm) ![*c]const u8 {
+        const text = try core.Binary.get_view(self.env, term);
+        return (try self.arena.dupeZ(u8, text)).ptr;
+    }
+
+    fn run_list(self: *Frame, list: e.ErlNifTerm, origin: rl.Vector2) anyerror!void {
+        var head: e.ErlNifTerm = undefined;
+        var tail = list;
+        while (e.enif_get_list_cell(self.env, tail, &head, &tail) != 0) {
+            try self.run(head, origin);
+        }
+        if (e.enif_is_empty_list(self.env, tail) == 0) return error.ArgumentError;
+    }
+
+    fn run(self: *Frame, term: e.ErlNifTerm, origin: rl.Vector2) anyerror!void {
+        const env = self.env;
+
+        if (e.enif_is_atom(env, term) != 0) {
+            switch (try self.get_kind(term)) {
+                .enable => rl.GuiEnable(),
+                .disable => rl.GuiDisable(),
+                .lock => rl.GuiLock(),
+                .unlock => rl.GuiUnlock(),
+                else => return error.ArgumentError,
+            }
+            return;
+        }
+
+        const item = try core.Tuple.get(env, term);
+        if (item.len < 2) return error.ArgumentError;
+
+        const kind = try self.get_kind(item[0]);
+        const arity: usize = switch (kind) {
+            .enable, .disable, .lock, .unlock => 1,
+            .state => 2,
+            .label, .status_bar, .dummy_rec, .line => 3,
+            .style, .button, .label_button, .panel, .group_box => 4,
+            .toggle, .toggle_group, .toggle_slider, .check_box, .combo_box, .dropdown_box, .text_box, .list_view, .color_picker, .window_box => 5,
+            .scroll_panel => 6,
+            .spinner, .value_box, .progress_bar => 7,
+            .slider, .slider_bar => 8,
+        };
+        if (item.len != arity) return error.ArgumentError;
+
+        switch (kind) {
+            .enable, .disable, .lock, .unlock => unreachable,
+            .state => rl.GuiSetState(try core.Int.get(env, item[1])),
+            .style => rl.GuiSetStyle(try core.Int.get(env, item[1]), try core.Int.get(env, item[2]), try core.Int.get(env, item[3])),
+
+            .panel, .group_box => {
+                const bounds = try self.get_bounds(item[1], origin);
+                const text = try self.get_text(item[2]);
+                _ = if (kind == .panel) rl.GuiPanel(bounds, text) else rl.GuiGroupBox(bounds, text);
+                try self.run_list(item[3], origin);
+            },
+            .window_box => {
+                const bounds = try self.get_bounds(item[2], origin);
+                if (rl.GuiWindowBox(bounds, try self.get_text(item[3])) != 0) {
+                    try self.emit(item[1], core.Atom.make(env, "closed"));
+                }
+                try self.run_list(item[4], origin);
+            },
+            .scroll_panel => {
+                const bounds = try self.get_bounds(item[2], origin);
+                const text = try self.get_text(item[3]);
+                const content = try core.Rectangle.get(env, item[4]);
+
+                // Copied before running the children, they invalidate the state pointer
+                const state = try self.get_state(item[1]);
+                _ = rl.GuiScrollPanel(bounds, text, content, &state.scroll, &state.view);
+                const scroll = state.scroll;
+                const view = state.view;
+
+                // Children are positioned relative to the scrolled content
+                rl.BeginScissorMode(@intFromFloat(view.x), @intFromFloat(view.y), @intFromFloat(view.width), @intFromFloat(view.height));
+                defer rl.EndScissorMode();
+                try self.run_list(item[5], .{ .x = view.x + scroll.x, .y = view.y + scroll.y });
+            },
+
+            .label, .status_bar, .dummy_rec, .line => {
+                const bounds = try self.get_bounds(item[1], origin);
+                const text = try self.get_text(item[2]);
+                _ = switch (kind) {
+                    .label => rl.GuiLabel(bounds, text),
+                    .status_bar => rl.GuiStatusBar(bounds, text),
+                    .dummy_rec => rl.GuiDummyRec(bounds, text),
+                    else => rl.GuiLine(bounds, text),
+                };
+            },
+            .button, .label_button => {
+                const bounds = try self.get_bounds(item[2], origin);
+                const text = try self.get_text(item[3]);
+                const pressed = if (kind == .button) rl.GuiButton(bounds, text) else rl.GuiLabelButton(bounds, text);
+                if (pressed != 0) try self.emit(item[1], core.Atom.make(env, "pressed"));
+            },
+            .toggle, .check_box => {
+                const bounds = try self.get_bounds(item[2], origin);
+                const text = try self.get_text(item[3]);
+                const previous = try core.Boolean.get(env, item[4]);
+                var active = previous;
+                _ = if (kind == .toggle) rl.GuiToggle(bounds, text, &active) else rl.GuiCheckBox(bounds, text, &active);
+                if (active != previous) try self.emit(item[1], core.Boolean.make(env, active));
+            },
+            .toggle_group, .toggle_slider, .combo_box => {
+                const bounds = try self.get_bounds(item[2], origin);
+                const text = try self.get_text(item[3]);
+                const previous = try core.Int.get(env, item[4]);
+                var active = previous;
+                _ = switch (kind) {
+                    .toggle_group => rl.GuiToggleGroup(bounds, text, &active),
+                    .toggle_slider => rl.GuiToggleSlider(bounds, text, &active),
+                    else => rl.GuiComboBox(bounds, text, &active),
+                };
+                if (active != previous) try self.emit(item[1], core.Int.make(env, active));
+            },
+            .dropdown_box => {
+                const bounds = try self.get_bounds(item[2], origin);
+                const text = try self.get_text(item[3]);
+                const previous = try core.Int.get(env, item[4]);
+                var active = previous;
+                const state = try self.get_state(item[1]);
+                if (rl.GuiDropdownBox(bounds, text, &active, state.edit_mode) != 0) state.edit_mode = !state.edit_mode;
+                if (active != previous) try self.emit(item[1], core.Int.make(env, active));
+            },
+            .spinner, .value_box => {
+                const bounds = try self.get_bounds(item[2], origin);
+                const text = try self.get_text(item[3]);
+                const previous = try core.Int.get(env, item[4]);
+                const min_value = try core.Int.get(env, item[5]);
+                const max_value = try core.Int.get(env, item[6]);
+                var value = previous;
+                const state = try self.get_state(item[1]);
+                const toggled = if (kind == .spinner)
+                    rl.GuiSpinner(bounds, text, &value, min_value, max_value, state.edit_mode)
+                else
+                    rl.GuiValueBox(bounds, text, &value, min_value, max_value, state.edit_mode);
+                if (toggled != 0) state.edit_mode = !state.edit_mode;
+                if (value != previous) try self.emit(item[1], core.Int.make(env, value));
+            },
+            .text_box => {
+                const bounds = try self.get_bounds(item[2], origin);
+                const text = try core.Binary.get_view(env, item[3]);
+                const size = try core.Int.get(env, item[4]);
+                if (size < 1) return error.ArgumentError;
+
+                // The buffer stays native, the submitted text only replaces it when it changes
+                const state = try self.get_state(item[1]);
+                try state.sync_text(text, @intCast(size));
+                const before = std.hash.Wyhash.hash(0, state.get_text());
+                if (rl.GuiTextBox(bounds, state.text.ptr, size, state.edit_mode) != 0) state.edit_mode = !state.edit_mode;
+                const after = state.get_text();
+                if (std.hash.Wyhash.hash(0, after) != before) try self.emit(item[1], core.Binary.make(env, after));
+            },
+            .slider, .slider_bar, .progress_bar => {
+                // The progress bar has no id
+                const offset: usize = if (kind == .progress_bar) 1 else 2;
+                const bounds = try self.get_bounds(item[offset], origin);
+                const text_left = try self.get_text(item[offset + 1]);
+                const text_right = try self.get_text(item[offset + 2]);
+                const previous = try core.Float.get(env, item[offset + 3]);
+                const min_value = try core.Float.get(env, item[offset + 4]);
+                const max_value = try core.Float.get(env, item[offset + 5]);
+                var value = previous;
+                _ = switch (kind) {
+                    .slider => rl.GuiSlider(bounds, text_left, text_right, &value, min_value, max_value),
+                    .slider_bar => rl.GuiSliderBar(bounds, text_left, text_right, &value, min_value, max_value),
+                    else => rl.GuiProgressBar(bounds, text_left, text_right, &value, min_value, max_value),
+                };
+                if (kind != .progress_bar and value != previous) try self.emit(item[1], core.Float.make(env, value));
+            },
+            .list_view => {
+                const bounds = try self.get_bounds(item[2], origin);
+                const text = try self.get_text(item[3]);
+                const previous = try core.Int.get(env, item[4]);
+                var active = previous;
+                const state = try self.get_state(item[1]);
+                _ = rl.GuiListView(bounds, text, &state.scroll_index, &active);
+                if (active != previous) try self.emit(item[1], core.Int.make(env, active));
+            },
+            .color_picker => {
+                const bounds = try self.get_bounds(item[2], origin);
+                const text = try self.get_text(item[3]);
+                const previous = try core.Color.get(env, item[4]);
+                var color = previous;
+                _ = rl.GuiColorPicker(bounds, text, &color);
+                if (!std.meta.eql(color, previous)) try self.emit(item[1], core.Color.make(env, color));
+            },
+        }
+    }
+};
+
+/// Run a list of gui items (controls, containers and global state changes) in order
+///
+/// Controls with an id report their interactions, returns [{id, value}]:
+/// - button, label_button: :pressed
+/// - window_box: :closed
+/// - toggle, check_box: new active state
+/// - toggle_group, toggle_slider, combo_box, dropdown_box, list_view: new active index
+/// - spinner, value_box, slider, slider_bar: new value
+/// - text_box: new text
+/// - color_picker: new color
+///
+/// The edit modes, text box buffers and scroll positions are kept natively by id,
+/// states not used for a number of frames are dropped
+fn nif_gui_frame(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Function
+
+    var arena = std.heap.ArenaAllocator.init(rl.allocator);
+    defer arena.deinit();
+
+    gui_frame.begin_frame();
+    defer gui_frame.end_frame();
+
+    // Items left unrun must not leave the gui disabled or locked
+    const gui_state = rl.GuiGetState();
+    const gui_locked = rl.GuiIsLocked();
+    errdefer {
+        rl.GuiSetState(gui_state);
+        if (gui_locked) rl.GuiLock() else rl.GuiUnlock();
+    }
+
+    var frame = Frame{ .env = env, .arena = arena.allocator() };
+    frame.run_list(argv[0], .{}) catch |err| switch (err) {
+        error.OutOfMemory => return err,
+        else => return error.invalid_argument_items,
+    };
+
+    // Return
+
+    return e.enif_make_list_from_array(env, frame.interactions.items.ptr, @intCast(frame.interactions.items.len));
+}
+
+/// Drop the states kept by gui_frame (edit modes, text box buffers, scroll positions)
+fn nif_gui_frame_reset(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Function
+
+    gui_frame.reset();
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
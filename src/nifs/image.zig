@@ -4,10 +4,14 @@ const e = @import("../erl_nif.zig");
 const rl = @import("../raylib.zig");
 
 const core = @import("../core.zig");
+const image_anim = @import("../image_anim.zig");
+const image_process = @import("../image_process.zig");
 
 pub const exported_nifs = [_]e.ErlNifFunc{
     // Image
     .{ .name = "image_get_data_size", .arity = 4, .fptr = core.nif_wrapper(nif_image_get_data_size), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "set_image_fast_path", .arity = 1, .fptr = core.nif_wrapper(nif_set_image_fast_path), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "is_image_fast_path_enabled", .arity = 0, .fptr = core.nif_wrapper(nif_is_image_fast_path_enabled), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
 
     // Image loading
     .{ .name = "load_image", .arity = 1, .fptr = core.nif_wrapper(nif_load_image), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
@@ -28,6 +32,19 @@ pub const exported_nifs = [_]e.ErlNifFunc{
     .{ .name = "export_image", .arity = 2, .fptr = core.nif_wrapper(nif_export_image), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "export_image_to_memory", .arity = 2, .fptr = core.nif_wrapper(nif_export_image_to_memory), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
 
+    // Image animation stream
+    .{ .name = "load_image_anim_stream", .arity = 1, .fptr = core.nif_wrapper(nif_load_image_anim_stream), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_image_anim_stream", .arity = 2, .fptr = core.nif_wrapper(nif_load_image_anim_stream), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_image_anim_stream_from_memory", .arity = 2, .fptr = core.nif_wrapper(nif_load_image_anim_stream_from_memory), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_image_anim_stream_from_memory", .arity = 3, .fptr = core.nif_wrapper(nif_load_image_anim_stream_from_memory), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_image_anim_stream_info", .arity = 1, .fptr = core.nif_wrapper(nif_get_image_anim_stream_info), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_image_anim_stream_delays", .arity = 1, .fptr = core.nif_wrapper(nif_get_image_anim_stream_delays), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "image_anim_stream_next_frame", .arity = 1, .fptr = core.nif_wrapper(nif_image_anim_stream_next_frame), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "image_anim_stream_seek", .arity = 2, .fptr = core.nif_wrapper(nif_image_anim_stream_seek), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_image_anim_stream_image", .arity = 1, .fptr = core.nif_wrapper(nif_get_image_anim_stream_image), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_image_anim_stream_image", .arity = 2, .fptr = core.nif_wrapper(nif_get_image_anim_stream_image), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "update_texture_from_image_anim_stream", .arity = 2, .fptr = core.nif_wrapper(nif_update_texture_from_image_anim_stream), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
     // Image generation
     .{ .name = "gen_image_color", .arity = 3, .fptr = core.nif_wrapper(nif_gen_image_color), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "gen_image_color", .arity = 4, .fptr = core.nif_wrapper(nif_gen_image_color), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
@@ -61,6 +78,8 @@ pub const exported_nifs = [_]e.ErlNifFunc{
     .{ .name = "image_text_ex", .arity = 6, .fptr = core.nif_wrapper(nif_image_text_ex), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "image_format", .arity = 2, .fptr = core.nif_wrapper(nif_image_format), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "image_format", .arity = 3, .fptr = core.nif_wrapper(nif_image_format), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "image_format_batch", .arity = 2, .fptr = core.nif_wrapper(nif_image_format_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "image_format_batch", .arity = 3, .fptr = core.nif_wrapper(nif_image_format_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "image_to_pot", .arity = 2, .fptr = core.nif_wrapper(nif_image_to_pot), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "image_to_pot", .arity = 3, .fptr = core.nif_wrapper(nif_image_to_pot), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "image_crop", .arity = 2, .fptr = core.nif_wrapper(nif_image_crop), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
@@ -85,6 +104,8 @@ pub const exported_nifs = [_]e.ErlNifFunc{
     .{ .name = "image_resize_canvas", .arity = 7, .fptr = core.nif_wrapper(nif_image_resize_canvas), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "image_mipmaps", .arity = 1, .fptr = core.nif_wrapper(nif_image_mipmaps), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "image_mipmaps", .arity = 2, .fptr = core.nif_wrapper(nif_image_mipmaps), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "image_mipmaps_batch", .arity = 1, .fptr = core.nif_wrapper(nif_image_mipmaps_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "image_mipmaps_batch", .arity = 2, .fptr = core.nif_wrapper(nif_image_mipmaps_batch), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "image_dither", .arity = 5, .fptr = core.nif_wrapper(nif_image_dither), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "image_dither", .arity = 6, .fptr = core.nif_wrapper(nif_image_dither), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "image_flip_vertical", .arity = 1, .fptr = core.nif_wrapper(nif_image_flip_vertical), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
@@ -202,6 +223,37 @@ fn nif_image_get_data_size(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.Er
     return core.UInt.make(env, @intCast(data_size));
 }
 
+/// Enable the vectorized and multithreaded image processing (enabled by default)
+///
+/// When disabled the raylib implementation is used, see image_process.zig for the supported formats
+fn nif_set_image_fast_path(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const enabled = core.Boolean.get(env, argv[0]) catch {
+        return error.invalid_argument_enabled;
+    };
+
+    // Function
+
+    image_process.fast_path.store(enabled, .monotonic);
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Check if the vectorized and multithreaded image processing is enabled
+fn nif_is_image_fast_path_enabled(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Return
+
+    return core.Boolean.make(env, image_process.fast_path.load(.monotonic));
+}
+
 /////////////////////
 //  Image loading  //
 /////////////////////
@@ -553,6 +605,276 @@ fn nif_export_image_to_memory(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e
     return core.Binary.make_c(env, file_data, @intCast(data_size));
 }
 
+//////////////////////////////
+//  Image animation stream  //
+//////////////////////////////
+
+fn get_image_anim_ring_size(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm, index: usize) !usize {
+    if (argc <= index) return image_anim.IMAGE_ANIM_RING_SIZE_DEFAULT;
+
+    const ring_size = try core.UInt.get(env, argv[index]);
+    if (ring_size == 0 or ring_size > image_anim.IMAGE_ANIM_RING_SIZE_MAX) return error.ArgumentError;
+
+    return ring_size;
+}
+
+fn copy_image_anim_pixels(image: *rl.Image, pixels: []const u8) anyerror!void {
+    const data: [*]u8 = @ptrCast(rl.MemAlloc(@intCast(pixels.len)) orelse return error.OutOfMemory);
+    @memcpy(data[0..pixels.len], pixels);
+    image.data = data;
+}
+
+fn update_texture_image_anim_pixels(texture: rl.Texture2D, pixels: []const u8) anyerror!void {
+    rl.UpdateTexture(texture, pixels.ptr);
+}
+
+/// Load animated image stream from file (GIF), frames are decoded on demand into a ring of ring_size frames (2 by default)
+fn nif_load_image_anim_stream(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1 or argc == 2);
+
+    // Arguments
+
+    const arg_file_name = core.ArgumentBinaryCUnknown(core.CString, rl.allocator).get(env, argv[0]) catch {
+        return error.invalid_argument_file_name;
+    };
+    defer arg_file_name.free();
+    const file_name = arg_file_name.data;
+
+    const ring_size = get_image_anim_ring_size(env, argc, argv, 1) catch {
+        return error.invalid_argument_ring_size;
+    };
+
+    // Function
+
+    var data_size: c_int = 0;
+    const file_data = rl.LoadFileData(file_name, &data_size);
+    if (file_data == null) return error.runtime_failed_to_load_file;
+    defer rl.UnloadFileData(file_data);
+
+    const value = image_anim.LoadImageAnimStream(file_data[0..@intCast(data_size)], ring_size) catch |err| switch (err) {
+        error.OutOfMemory => return err,
+        else => return error.runtime_invalid_gif,
+    };
+    errdefer image_anim.UnloadImageAnimStream(value);
+
+    // Return
+
+    return core.ImageAnimStream.make(env, value) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Load animated image stream from memory buffer, file_type refers to extension (only ".gif" is supported)
+fn nif_load_image_anim_stream_from_memory(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Arguments
+
+    const arg_file_type = core.ArgumentBinaryCUnknown(core.CString, rl.allocator).get(env, argv[0]) catch {
+        return error.invalid_argument_file_type;
+    };
+    defer arg_file_type.free();
+    const file_type = arg_file_type.data;
+
+    const file_data = core.Binary.get_view(env, argv[1]) catch {
+        return error.invalid_argument_file_data;
+    };
+
+    const ring_size = get_image_anim_ring_size(env, argc, argv, 2) catch {
+        return error.invalid_argument_ring_size;
+    };
+
+    if (!rl.IsFileExtension(file_type, ".gif")) return error.invalid_argument_file_type;
+
+    // Function
+
+    const value = image_anim.LoadImageAnimStream(file_data, ring_size) catch |err| switch (err) {
+        error.OutOfMemory => return err,
+        else => return error.invalid_argument_file_data,
+    };
+    errdefer image_anim.UnloadImageAnimStream(value);
+
+    // Return
+
+    return core.ImageAnimStream.make(env, value) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Get animated image stream info: {width, height, frame count, current frame}
+fn nif_get_image_anim_stream_info(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const stream = core.ImageAnimStream.get(env, argv[0]) catch {
+        return error.invalid_argument_stream;
+    };
+
+    if (stream.is_unloaded()) return error.invalid_argument_stream;
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        core.UInt.make(env, @intCast(stream.width)),
+        core.UInt.make(env, @intCast(stream.height)),
+        core.UInt.make(env, @intCast(stream.frame_count())),
+        core.UInt.make(env, @intCast(stream.get_current())),
+    });
+}
+
+/// Get animated image stream frame delays (in milliseconds)
+fn nif_get_image_anim_stream_delays(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const stream = core.ImageAnimStream.get(env, argv[0]) catch {
+        return error.invalid_argument_stream;
+    };
+
+    if (stream.is_unloaded()) return error.invalid_argument_stream;
+
+    // Return
+
+    var term = e.enif_make_list_from_array(env, null, 0);
+    var i = stream.frame_count();
+    while (i > 0) {
+        i -= 1;
+        term = e.enif_make_list_cell(env, core.UInt.make(env, stream.get_delay(i)), term);
+    }
+
+    return term;
+}
+
+/// Move animated image stream to the next frame (looping) and decode it, returns the frame index
+fn nif_image_anim_stream_next_frame(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const stream = core.ImageAnimStream.get(env, argv[0]) catch {
+        return error.invalid_argument_stream;
+    };
+
+    // Function
+
+    const frame = stream.next_frame() catch |err| switch (err) {
+        error.OutOfMemory => return err,
+        error.image_anim_stream_unloaded => return error.invalid_argument_stream,
+        else => return error.runtime_invalid_gif,
+    };
+
+    // Return
+
+    return core.UInt.make(env, @intCast(frame));
+}
+
+/// Move animated image stream to a frame and decode it
+fn nif_image_anim_stream_seek(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const stream = core.ImageAnimStream.get(env, argv[0]) catch {
+        return error.invalid_argument_stream;
+    };
+
+    if (stream.is_unloaded()) return error.invalid_argument_stream;
+
+    const frame = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_frame;
+    };
+
+    if (frame >= stream.frame_count()) return error.invalid_argument_frame;
+
+    // Function
+
+    stream.seek(frame) catch |err| switch (err) {
+        error.OutOfMemory => return err,
+        error.image_anim_stream_unloaded => return error.invalid_argument_stream,
+        else => return error.runtime_invalid_gif,
+    };
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Get the current frame of an animated image stream as an image (R8G8B8A8)
+fn nif_get_image_anim_stream_image(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1 or argc == 2);
+
+    // Return type
+
+    const return_resource = core.must_return_resource(env, argc, argv, 1);
+
+    // Arguments
+
+    const stream = core.ImageAnimStream.get(env, argv[0]) catch {
+        return error.invalid_argument_stream;
+    };
+
+    // Function
+
+    var image = rl.Image{
+        .data = null,
+        .width = @intCast(stream.width),
+        .height = @intCast(stream.height),
+        .mipmaps = 1,
+        .format = rl.PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+    };
+
+    stream.with_current_pixels(&image, copy_image_anim_pixels) catch |err| switch (err) {
+        error.OutOfMemory => return error.OutOfMemory,
+        error.image_anim_stream_unloaded => return error.invalid_argument_stream,
+        else => return error.runtime_invalid_gif,
+    };
+    defer if (!return_resource) core.Image.unload(image);
+    errdefer if (return_resource) core.Image.unload(image);
+
+    // Return
+
+    return core.maybe_make_struct_as_resource(core.Image, env, image, return_resource) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Update GPU texture with the current frame of an animated image stream (no copy to Elixir)
+///
+/// NOTE: The texture must have the size of the stream and the R8G8B8A8 pixel format
+fn nif_update_texture_from_image_anim_stream(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const arg_texture = core.Argument(core.Texture2D).get(env, argv[0]) catch {
+        return error.invalid_argument_texture;
+    };
+    defer arg_texture.free();
+    const texture = arg_texture.data;
+
+    const stream = core.ImageAnimStream.get(env, argv[1]) catch {
+        return error.invalid_argument_stream;
+    };
+
+    if (texture.width != stream.width or texture.height != stream.height or texture.format != rl.PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+        return error.invalid_argument_texture;
+    }
+
+    // Function
+
+    stream.with_current_pixels(texture, update_texture_image_anim_pixels) catch |err| switch (err) {
+        error.OutOfMemory => return error.OutOfMemory,
+        error.image_anim_stream_unloaded => return error.invalid_argument_stream,
+        else => return error.runtime_invalid_gif,
+    };
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
 ////////////////////////
 //  Image generation  //
 ////////////////////////
@@ -1194,7 +1516,7 @@ fn nif_image_format(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTer
 
     // Function
 
-    rl.ImageFormat(@ptrCast(image), new_format);
+    try image_process.ImageFormat(image, new_format);
 
     // Return
 
@@ -1203,6 +1525,125 @@ fn nif_image_format(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTer
     };
 }
 
+/// Images of a batch call, the images are converted in place
+///
+/// NOTE: The resources share their data with the images of the batch, they are
+/// written back before returning, even if the batch failed (the data may have
+/// been reallocated)
+const ImageBatch = struct {
+    items: []Item,
+    images: []*rl.Image,
+    made: usize = 0,
+
+    const Item = struct {
+        arg: core.Argument(core.Image),
+        term: e.ErlNifTerm,
+        resource: ?**rl.Image,
+        return_resource: bool,
+    };
+
+    /// Get the list of images from argv[0], index is the position of the return type argument
+    fn get(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm, index: usize) !ImageBatch {
+        const length = core.Array.get_length(env, argv[0]) catch {
+            return error.invalid_argument_images;
+        };
+
+        const items = try rl.allocator.alloc(Item, length);
+        errdefer rl.allocator.free(items);
+
+        const images = try rl.allocator.alloc(*rl.Image, length);
+        errdefer rl.allocator.free(images);
+
+        var count: usize = 0;
+        errdefer for (items[0..count]) |item| item.arg.free();
+
+        var list = argv[0];
+        var head: e.ErlNifTerm = undefined;
+        while (e.enif_get_list_cell(env, list, &head, &list) != 0) {
+            const arg_image = core.Argument(core.Image).get(env, head) catch {
+                return error.invalid_argument_images;
+            };
+
+            items[count] = .{
+                .arg = arg_image,
+                .term = head,
+                .resource = if (arg_image.keep) (core.Image.Resource.get(env, head) catch null) else null,
+                .return_resource = core.must_return_resource_auto(env, argc, argv, index, head),
+            };
+            images[count] = &items[count].arg.data;
+            count += 1;
+
+            // A resource listed twice would be converted (and its data freed) twice
+            if (items[count - 1].resource) |resource| {
+                for (items[0 .. count - 1]) |item| {
+                    if (item.resource == resource) return error.invalid_argument_images;
+                }
+            }
+        }
+
+        return ImageBatch{
+            .items = items,
+            .images = images,
+        };
+    }
+
+    /// Free the images, except the ones already returned as resources
+    fn deinit(self: *ImageBatch) void {
+        for (self.items, 0..) |item, i| {
+            if (!item.return_resource or i >= self.made) item.arg.free();
+        }
+
+        rl.allocator.free(self.images);
+        rl.allocator.free(self.items);
+    }
+
+    /// Update all the resources with their processed image
+    fn write_back(self: *ImageBatch, env: ?*e.ErlNifEnv) void {
+        for (self.items) |item| {
+            // The resource was already fetched in get()
+            if (item.resource != null) core.Image.Resource.update(env, item.term, item.arg.data) catch unreachable;
+        }
+    }
+
+    fn make(self: *ImageBatch, env: ?*e.ErlNifEnv) !e.ErlNifTerm {
+        const terms = try rl.allocator.alloc(e.ErlNifTerm, self.items.len);
+        defer rl.allocator.free(terms);
+
+        for (self.items, 0..) |item, i| {
+            terms[i] = try core.maybe_make_struct_or_resource(core.Image, env, item.term, item.arg.data, item.return_resource);
+            self.made += 1;
+        }
+
+        return e.enif_make_list_from_array(env, terms.ptr, @intCast(terms.len));
+    }
+};
+
+/// Convert many images to the same format in one call, the images are processed in parallel
+fn nif_image_format_batch(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Arguments
+
+    const new_format = core.Int.get(env, argv[1]) catch {
+        return error.invalid_argument_new_format;
+    };
+
+    var batch = try ImageBatch.get(env, argc, argv, 2);
+    defer batch.deinit();
+
+    // Function
+
+    const processed = image_process.ImageFormatBatch(batch.images, new_format);
+    batch.write_back(env);
+    try processed;
+
+    // Return
+
+    return batch.make(env) catch {
+        return error.invalid_return;
+    };
+}
+
 /// Convert image to POT (power-of-two)
 ///
 /// raylib.h
@@ -1412,7 +1853,7 @@ fn nif_image_alpha_premultiply(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const
 
     // Function
 
-    rl.ImageAlphaPremultiply(@ptrCast(image));
+    image_process.ImageAlphaPremultiply(image);
 
     // Return
 
@@ -1647,7 +2088,7 @@ fn nif_image_mipmaps(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTe
 
     // Function
 
-    rl.ImageMipmaps(@ptrCast(image));
+    try image_process.ImageMipmaps(image);
 
     // Return
 
@@ -1656,6 +2097,28 @@ fn nif_image_mipmaps(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTe
     };
 }
 
+/// Compute all mipmap levels for many images in one call, the images are processed in parallel
+fn nif_image_mipmaps_batch(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1 or argc == 2);
+
+    // Arguments
+
+    var batch = try ImageBatch.get(env, argc, argv, 1);
+    defer batch.deinit();
+
+    // Function
+
+    const processed = image_process.ImageMipmapsBatch(batch.images);
+    batch.write_back(env);
+    try processed;
+
+    // Return
+
+    return batch.make(env) catch {
+        return error.invalid_return;
+    };
+}
+
 /// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 ///
 /// raylib.h
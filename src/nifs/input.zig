@@ -0,0 +1,219 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+
+const core = @import("../core.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Input snapshot
+    .{ .name = "get_input_snapshot", .arity = 0, .fptr = core.nif_wrapper(nif_get_input_snapshot), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_input_snapshot", .arity = 1, .fptr = core.nif_wrapper(nif_get_input_snapshot), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+// Limits of rcore (not exposed by raylib.h)
+const MAX_KEYBOARD_KEYS = 512;
+const MAX_KEY_PRESSED_QUEUE = 16;
+const MAX_CHAR_PRESSED_QUEUE = 16;
+const MAX_MOUSE_BUTTONS = 8;
+const MAX_GAMEPADS = 4;
+const MAX_GAMEPAD_BUTTONS = 32;
+
+/// Parts of the input snapshot (bit mask)
+const INPUT_SNAPSHOT_KEYBOARD: c_uint = 0x01;
+const INPUT_SNAPSHOT_CHARS: c_uint = 0x02;
+const INPUT_SNAPSHOT_MOUSE: c_uint = 0x04;
+const INPUT_SNAPSHOT_GAMEPADS: c_uint = 0x08;
+const INPUT_SNAPSHOT_TOUCH: c_uint = 0x10;
+const INPUT_SNAPSHOT_ALL: c_uint = 0x1F;
+
+fn set_bit(bits: []u8, index: usize) void {
+    bits[index / 8] |= @as(u8, 1) << @intCast(index % 8);
+}
+
+fn make_bitset(env: ?*e.ErlNifEnv, bits: []const u8) e.ErlNifTerm {
+    return core.Binary.make(env, bits);
+}
+
+//////////////////////
+//  Input snapshot  //
+//////////////////////
+
+/// Get the input state of the frame in one call
+///
+/// Returns a map with the parts selected by the mask (all by default):
+///
+/// - keyboard: keys_down and keys_down_previous bitsets (bit = key, least significant bit first), keys_pressed queue
+/// - chars: chars_pressed queue (unicode)
+/// - mouse: {x, y, delta_x, delta_y, wheel_x, wheel_y, buttons_down, buttons_down_previous} (buttons as bit masks)
+/// - gamepads: list of {gamepad, buttons_down, buttons_down_previous, axes} for the available gamepads
+/// - touch: list of {id, x, y}
+///
+/// NOTE: The keys pressed and chars pressed queues are consumed
+fn nif_get_input_snapshot(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0 or argc == 1);
+
+    // Arguments
+
+    var mask = INPUT_SNAPSHOT_ALL;
+    if (argc == 1) {
+        mask = core.UInt.get(env, argv[0]) catch {
+            return error.invalid_argument_mask;
+        };
+        if (mask & ~INPUT_SNAPSHOT_ALL != 0) return error.invalid_argument_mask;
+    }
+
+    // Function
+
+    var keys: [8]e.ErlNifTerm = undefined;
+    var values: [8]e.ErlNifTerm = undefined;
+    var count: usize = 0;
+
+    if (mask & INPUT_SNAPSHOT_KEYBOARD != 0) {
+        var down = [_]u8{0} ** (MAX_KEYBOARD_KEYS / 8);
+        var previous = [_]u8{0} ** (MAX_KEYBOARD_KEYS / 8);
+
+        for (0..MAX_KEYBOARD_KEYS) |key| {
+            const key_c: c_int = @intCast(key);
+            const is_down = rl.IsKeyDown(key_c);
+            if (is_down) set_bit(&down, key);
+
+            // Previous frame state derived from the transitions of this frame
+            if ((is_down and !rl.IsKeyPressed(key_c)) or rl.IsKeyReleased(key_c)) set_bit(&previous, key);
+        }
+
+        var pressed: [MAX_KEY_PRESSED_QUEUE]e.ErlNifTerm = undefined;
+        var pressed_count: usize = 0;
+        while (pressed_count < pressed.len) {
+            const key = rl.GetKeyPressed();
+            if (key == 0) break;
+            pressed[pressed_count] = core.Int.make(env, key);
+            pressed_count += 1;
+        }
+
+        keys[count] = core.Atom.make(env, "keys_down");
+        values[count] = make_bitset(env, &down);
+        count += 1;
+
+        keys[count] = core.Atom.make(env, "keys_down_previous");
+        values[count] = make_bitset(env, &previous);
+        count += 1;
+
+        keys[count] = core.Atom.make(env, "keys_pressed");
+        values[count] = e.enif_make_list_from_array(env, &pressed, @intCast(pressed_count));
+        count += 1;
+    }
+
+    if (mask & INPUT_SNAPSHOT_CHARS != 0) {
+        var chars: [MAX_CHAR_PRESSED_QUEUE]e.ErlNifTerm = undefined;
+        var chars_count: usize = 0;
+        while (chars_count < chars.len) {
+            const char = rl.GetCharPressed();
+            if (char == 0) break;
+            chars[chars_count] = core.Int.make(env, char);
+            chars_count += 1;
+        }
+
+        keys[count] = core.Atom.make(env, "chars_pressed");
+        values[count] = e.enif_make_list_from_array(env, &chars, @intCast(chars_count));
+        count += 1;
+    }
+
+    if (mask & INPUT_SNAPSHOT_MOUSE != 0) {
+        var buttons_down: c_uint = 0;
+        var buttons_previous: c_uint = 0;
+
+        for (0..MAX_MOUSE_BUTTONS) |button| {
+            const button_c: c_int = @intCast(button);
+            const bit = @as(c_uint, 1) << @intCast(button);
+            const is_down = rl.IsMouseButtonDown(button_c);
+            if (is_down) buttons_down |= bit;
+            if ((is_down and !rl.IsMouseButtonPressed(button_c)) or rl.IsMouseButtonReleased(button_c)) buttons_previous |= bit;
+        }
+
+        const position = rl.GetMousePosition();
+        const delta = rl.GetMouseDelta();
+        const wheel = rl.GetMouseWheelMoveV();
+
+        keys[count] = core.Atom.make(env, "mouse");
+        values[count] = core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Float.make(env, position.x),
+            core.Float.make(env, position.y),
+            core.Float.make(env, delta.x),
+            core.Float.make(env, delta.y),
+            core.Float.make(env, wheel.x),
+            core.Float.make(env, wheel.y),
+            core.UInt.make(env, buttons_down),
+            core.UInt.make(env, buttons_previous),
+        });
+        count += 1;
+    }
+
+    if (mask & INPUT_SNAPSHOT_GAMEPADS != 0) {
+        var gamepads: [MAX_GAMEPADS]e.ErlNifTerm = undefined;
+        var gamepads_count: usize = 0;
+
+        for (0..MAX_GAMEPADS) |gamepad| {
+            const gamepad_c: c_int = @intCast(gamepad);
+            if (!rl.IsGamepadAvailable(gamepad_c)) continue;
+
+            var buttons_down: c_uint = 0;
+            var buttons_previous: c_uint = 0;
+
+            for (0..MAX_GAMEPAD_BUTTONS) |button| {
+                const button_c: c_int = @intCast(button);
+                const bit = @as(c_uint, 1) << @intCast(button);
+                const is_down = rl.IsGamepadButtonDown(gamepad_c, button_c);
+                if (is_down) buttons_down |= bit;
+                if ((is_down and !rl.IsGamepadButtonPressed(gamepad_c, button_c)) or rl.IsGamepadButtonReleased(gamepad_c, button_c)) buttons_previous |= bit;
+            }
+
+            var axes: [8]e.ErlNifTerm = undefined;
+            const axes_count: usize = @intCast(std.math.clamp(rl.GetGamepadAxisCount(gamepad_c), 0, @as(c_int, axes.len)));
+            for (0..axes_count) |axis| {
+                axes[axis] = core.Float.make(env, rl.GetGamepadAxisMovement(gamepad_c, @intCast(axis)));
+            }
+
+            gamepads[gamepads_count] = core.Tuple.make(env, &[_]e.ErlNifTerm{
+                core.Int.make(env, gamepad_c),
+                core.UInt.make(env, buttons_down),
+                core.UInt.make(env, buttons_previous),
+                e.enif_make_list_from_array(env, &axes, @intCast(axes_count)),
+            });
+            gamepads_count += 1;
+        }
+
+        keys[count] = core.Atom.make(env, "gamepads");
+        values[count] = e.enif_make_list_from_array(env, &gamepads, @intCast(gamepads_count));
+        count += 1;
+    }
+
+    if (mask & INPUT_SNAPSHOT_TOUCH != 0) {
+        var points: [16]e.ErlNifTerm = undefined;
+        const points_count: usize = @intCast(std.math.clamp(rl.GetTouchPointCount(), 0, @as(c_int, points.len)));
+
+        for (0..points_count) |index| {
+            const index_c: c_int = @intCast(index);
+            const position = rl.GetTouchPosition(index_c);
+
+            points[index] = core.Tuple.make(env, &[_]e.ErlNifTerm{
+                core.Int.make(env, rl.GetTouchPointId(index_c)),
+                core.Float.make(env, position.x),
+                core.Float.make(env, position.y),
+            });
+        }
+
+        keys[count] = core.Atom.make(env, "touch");
+        values[count] = e.enif_make_list_from_array(env, &points, @intCast(points_count));
+        count += 1;
+    }
+
+    // Return
+
+    var term: e.ErlNifTerm = undefined;
+    if (e.enif_make_map_from_arrays(env, &keys, &values, count, &term) == 0) {
+        return error.invalid_return;
+    }
+
+    return term;
+}
@@ -0,0 +1,191 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+
+const core = @import("../core.zig");
+const memory = @import("../memory.zig");
+const reclaim = @import("../reclaim.zig");
+const resources = @import("../resources.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Memory
+    .{ .name = "get_memory_stats", .arity = 0, .fptr = core.nif_wrapper(nif_get_memory_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "reset_memory_peaks", .arity = 0, .fptr = core.nif_wrapper(nif_reset_memory_peaks), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Reclaiming
+    .{ .name = "set_resource_reclaim", .arity = 1, .fptr = core.nif_wrapper(nif_set_resource_reclaim), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "is_resource_reclaim_enabled", .arity = 0, .fptr = core.nif_wrapper(nif_is_resource_reclaim_enabled), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "set_resource_reclaim_frame_budget", .arity = 1, .fptr = core.nif_wrapper(nif_set_resource_reclaim_frame_budget), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "reclaim_resources", .arity = 1, .fptr = core.nif_wrapper(nif_reclaim_resources), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+//////////////
+//  Memory  //
+//////////////
+
+fn make_counter(env: ?*e.ErlNifEnv, counter: *const memory.Counter) e.ErlNifTerm {
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        e.enif_make_uint64(env, counter.bytes.load(.monotonic)),
+        e.enif_make_uint64(env, counter.peak_bytes.load(.monotonic)),
+        e.enif_make_uint64(env, counter.count.load(.monotonic)),
+        e.enif_make_uint64(env, counter.peak_count.load(.monotonic)),
+        e.enif_make_uint64(env, counter.total.load(.monotonic)),
+    });
+}
+
+/// Get the native memory stats
+///
+/// Returns {allocations, resources, gpu, reclaim}:
+/// - allocations: [{subsystem, {bytes, peak_bytes, count, peak_count, total}}]
+/// - resources: [{type, {live, peak_live, created, cpu_bytes, gpu_bytes}}] (types created at least once)
+/// - gpu: {bytes, peak_bytes}
+/// - reclaim: [{kind, {pending, reclaimed}}]
+fn nif_get_memory_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Return
+
+    const subsystems = std.meta.fields(memory.Subsystem);
+    var term_allocations: [subsystems.len]e.ErlNifTerm = undefined;
+    inline for (subsystems, 0..) |subsystem, i| {
+        term_allocations[i] = core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Atom.make(env, subsystem.name),
+            make_counter(env, &memory.allocations[subsystem.value]),
+        });
+    }
+
+    const resource_types = std.meta.fields(resources.ResourceTypeKey);
+    var term_resources: [resource_types.len]e.ErlNifTerm = undefined;
+    var resource_count: usize = 0;
+    inline for (resource_types) |resource_type| {
+        const entry = &memory.census[resource_type.value];
+        const created = entry.live.total.load(.monotonic);
+
+        if (created > 0) {
+            term_resources[resource_count] = core.Tuple.make(env, &[_]e.ErlNifTerm{
+                core.Atom.make(env, resource_type.name),
+                core.Tuple.make(env, &[_]e.ErlNifTerm{
+                    e.enif_make_uint64(env, entry.live.count.load(.monotonic)),
+                    e.enif_make_uint64(env, entry.live.peak_count.load(.monotonic)),
+                    e.enif_make_uint64(env, created),
+                    e.enif_make_uint64(env, entry.cpu_bytes.load(.monotonic)),
+                    e.enif_make_uint64(env, entry.gpu_bytes.load(.monotonic)),
+                }),
+            });
+            resource_count += 1;
+        }
+    }
+
+    const term_gpu = core.Tuple.make(env, &[_]e.ErlNifTerm{
+        e.enif_make_uint64(env, memory.gpu.bytes.load(.monotonic)),
+        e.enif_make_uint64(env, memory.gpu.peak_bytes.load(.monotonic)),
+    });
+
+    const kinds = std.meta.fields(reclaim.Kind);
+    var term_reclaim: [kinds.len]e.ErlNifTerm = undefined;
+    inline for (kinds, 0..) |kind, i| {
+        const queue = &reclaim.queues[kind.value];
+        term_reclaim[i] = core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Atom.make(env, kind.name),
+            core.Tuple.make(env, &[_]e.ErlNifTerm{
+                e.enif_make_uint64(env, queue.pending.load(.monotonic)),
+                e.enif_make_uint64(env, queue.reclaimed.load(.monotonic)),
+            }),
+        });
+    }
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        e.enif_make_list_from_array(env, &term_allocations, term_allocations.len),
+        e.enif_make_list_from_array(env, &term_resources, @intCast(resource_count)),
+        term_gpu,
+        e.enif_make_list_from_array(env, &term_reclaim, term_reclaim.len),
+    });
+}
+
+/// Restart the peak counters from the current values
+fn nif_reset_memory_peaks(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Function
+
+    memory.reset_peaks();
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+//////////////////
+//  Reclaiming  //
+//////////////////
+
+/// Reclaim the payloads of garbage collected resources (enabled by default)
+fn nif_set_resource_reclaim(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const enabled = core.Boolean.get(env, argv[0]) catch {
+        return error.invalid_argument_enabled;
+    };
+
+    // Function
+
+    reclaim.enabled.store(enabled, .monotonic);
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Check if the payloads of garbage collected resources are reclaimed
+fn nif_is_resource_reclaim_enabled(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Return
+
+    return core.Boolean.make(env, reclaim.enabled.load(.monotonic));
+}
+
+/// Set the time (in microseconds) spent releasing CPU payloads at the end of each frame
+fn nif_set_resource_reclaim_frame_budget(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const budget_us = core.UInt.get(env, argv[0]) catch {
+        return error.invalid_argument_budget_us;
+    };
+
+    // Function
+
+    reclaim.frame_budget_us.store(budget_us, .monotonic);
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Release the pending CPU payloads during budget_us microseconds at most, returns the number released
+///
+/// NOTE: The GL payloads are only released by end_drawing and close_window
+fn nif_reclaim_resources(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const budget_us = core.UInt.get(env, argv[0]) catch {
+        return error.invalid_argument_budget_us;
+    };
+
+    // Function
+
+    const released = reclaim.flush(budget_us);
+
+    // Return
+
+    return e.enif_make_uint64(env, released);
+}
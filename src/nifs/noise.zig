@@ -0,0 +1,203 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+
+const core = @import("../core.zig");
+const noise = @import("../noise.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Noise generation
+    .{ .name = "gen_noise_field", .arity = 4, .fptr = core.nif_wrapper(nif_gen_noise_field), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "gen_image_noise", .arity = 3, .fptr = core.nif_wrapper(nif_gen_image_noise), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "gen_image_noise", .arity = 4, .fptr = core.nif_wrapper(nif_gen_image_noise), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "gen_mesh_heightmap_noise", .arity = 4, .fptr = core.nif_wrapper(nif_gen_mesh_heightmap_noise), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "gen_mesh_heightmap_noise", .arity = 5, .fptr = core.nif_wrapper(nif_gen_mesh_heightmap_noise), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+////////////////////////
+//  Noise generation  //
+////////////////////////
+
+fn get_enum(comptime T: type, env: ?*e.ErlNifEnv, term: e.ErlNifTerm) !T {
+    const name = try core.Atom.get(rl.allocator, env, term);
+    defer core.Atom.free(rl.allocator, name);
+
+    return std.meta.stringToEnum(T, name) orelse error.ArgumentError;
+}
+
+/// {kind, fractal, dimensions, seed, frequency, octaves, lacunarity, gain, warp_amplitude, warp_frequency, offset_x, offset_y, offset_z}
+fn get_params(env: ?*e.ErlNifEnv, term: e.ErlNifTerm) !noise.Params {
+    const record = try core.Tuple.get(env, term);
+    if (record.len != 13) return error.ArgumentError;
+
+    const dimensions = try core.UInt.get(env, record[2]);
+    if (dimensions != 2 and dimensions != 3) return error.ArgumentError;
+
+    const octaves = try core.UInt.get(env, record[5]);
+    if (octaves < 1 or octaves > noise.max_octaves) return error.ArgumentError;
+
+    return .{
+        .kind = try get_enum(noise.Kind, env, record[0]),
+        .fractal = try get_enum(noise.Fractal, env, record[1]),
+        .dimensions = @intCast(dimensions),
+        .seed = @intCast(try core.UInt.get(env, record[3])),
+        .frequency = try get_finite(env, record[4]),
+        .octaves = @intCast(octaves),
+        .lacunarity = try get_finite(env, record[6]),
+        .gain = try get_finite(env, record[7]),
+        .warp_amplitude = try get_finite(env, record[8]),
+        .warp_frequency = try get_finite(env, record[9]),
+        .offset = .{
+            try get_finite(env, record[10]),
+            try get_finite(env, record[11]),
+            try get_finite(env, record[12]),
+        },
+    };
+}
+
+fn get_finite(env: ?*e.ErlNifEnv, term: e.ErlNifTerm) !f32 {
+    const value = try core.Float.get(env, term);
+    if (!std.math.isFinite(value)) return error.ArgumentError;
+    return value;
+}
+
+fn get_size(env: ?*e.ErlNifEnv, term: e.ErlNifTerm) !usize {
+    const size = try core.Int.get(env, term);
+    if (size < 1 or size > std.math.maxInt(c_int)) return error.ArgumentError;
+    return @intCast(size);
+}
+
+/// Generate a noise field as a binary of packed native endian f32 values in [-1, 1]
+///
+/// The values are ordered by x, then y, then z, a depth greater than 1 uses 3D noise
+fn nif_gen_noise_field(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 4);
+
+    // Arguments
+
+    const width = get_size(env, argv[0]) catch {
+        return error.invalid_argument_width;
+    };
+
+    const height = get_size(env, argv[1]) catch {
+        return error.invalid_argument_height;
+    };
+
+    const depth = get_size(env, argv[2]) catch {
+        return error.invalid_argument_depth;
+    };
+
+    const params = get_params(env, argv[3]) catch {
+        return error.invalid_argument_params;
+    };
+
+    // Function
+
+    const count = std.math.mul(usize, std.math.mul(usize, width, height) catch {
+        return error.invalid_argument_height;
+    }, depth) catch {
+        return error.invalid_argument_depth;
+    };
+    const buffer_size = std.math.mul(usize, count, @sizeOf(f32)) catch {
+        return error.invalid_argument_depth;
+    };
+
+    var term: e.ErlNifTerm = undefined;
+    const buffer = e.enif_make_new_binary(env, buffer_size, &term);
+    if (buffer == null) return error.OutOfMemory;
+    const values: [*]align(1) f32 = @ptrCast(buffer);
+
+    noise.fill_values(params, width, height, depth, values[0..count]);
+
+    // Return
+
+    return term;
+}
+
+/// Generate image: noise field (grayscale, black at -1 and white at 1)
+fn nif_gen_image_noise(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3 or argc == 4);
+
+    // Return type
+
+    const return_resource = core.must_return_resource(env, argc, argv, 3);
+
+    // Arguments
+
+    const width = get_size(env, argv[0]) catch {
+        return error.invalid_argument_width;
+    };
+
+    const height = get_size(env, argv[1]) catch {
+        return error.invalid_argument_height;
+    };
+
+    const params = get_params(env, argv[2]) catch {
+        return error.invalid_argument_params;
+    };
+
+    // Function
+
+    const image = noise.gen_image(params, width, height) catch |err| switch (err) {
+        error.invalid_size => return error.invalid_argument_height,
+        else => return err,
+    };
+    defer if (!return_resource) core.Image.unload(image);
+    errdefer if (return_resource) core.Image.unload(image);
+
+    // Return
+
+    return core.maybe_make_struct_as_resource(core.Image, env, image, return_resource) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Generate heightmap mesh from a noise field, the heightmap image never leaves native memory
+///
+/// NOTE: raylib samples the heightmap with 8 bits of precision
+fn nif_gen_mesh_heightmap_noise(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 4 or argc == 5);
+
+    // Return type
+
+    const return_resource = core.must_return_resource(env, argc, argv, 4);
+
+    // Arguments
+
+    const width = get_size(env, argv[0]) catch {
+        return error.invalid_argument_width;
+    };
+
+    const height = get_size(env, argv[1]) catch {
+        return error.invalid_argument_height;
+    };
+
+    const params = get_params(env, argv[2]) catch {
+        return error.invalid_argument_params;
+    };
+
+    const arg_size = core.Argument(core.Vector3).get(env, argv[3]) catch {
+        return error.invalid_argument_size;
+    };
+    defer arg_size.free();
+    const size = arg_size.data;
+
+    // Function
+
+    const heightmap = noise.gen_image(params, width, height) catch |err| switch (err) {
+        error.invalid_size => return error.invalid_argument_height,
+        else => return err,
+    };
+    defer rl.UnloadImage(heightmap);
+
+    const mesh = rl.GenMeshHeightmap(heightmap, size);
+    defer if (!return_resource) core.Mesh.unload(mesh);
+    errdefer if (return_resource) core.Mesh.unload(mesh);
+
+    // Return
+
+    return core.maybe_make_struct_as_resource(core.Mesh, env, mesh, return_resource) catch {
+        return error.invalid_return;
+    };
+}
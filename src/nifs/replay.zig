@@ -0,0 +1,239 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+
+const core = @import("../core.zig");
+const replay = @import("../replay.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Loading
+    .{ .name = "load_replay", .arity = 7, .fptr = core.nif_wrapper(nif_load_replay), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "rewind_replay", .arity = 1, .fptr = core.nif_wrapper(nif_rewind_replay), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Frames
+    .{ .name = "begin_replay_frame", .arity = 1, .fptr = core.nif_wrapper(nif_begin_replay_frame), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "end_replay_frame", .arity = 1, .fptr = core.nif_wrapper(nif_end_replay_frame), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Stats
+    .{ .name = "get_replay_stats", .arity = 1, .fptr = core.nif_wrapper(nif_get_replay_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_replay_frames", .arity = 1, .fptr = core.nif_wrapper(nif_get_replay_frames), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+///////////////
+//  Loading  //
+///////////////
+
+/// Load a replay from an automation event list (or the file it was exported to) rendering to a render texture,
+/// returns the replay resource
+fn nif_load_replay(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 7);
+
+    // Arguments
+
+    const width = core.Int.get(env, argv[1]) catch {
+        return error.invalid_argument_width;
+    };
+
+    const height = core.Int.get(env, argv[2]) catch {
+        return error.invalid_argument_height;
+    };
+
+    const fixed_fps = core.UInt.get(env, argv[3]) catch {
+        return error.invalid_argument_fixed_fps;
+    };
+
+    const frame_count = core.UInt.get(env, argv[4]) catch {
+        return error.invalid_argument_frame_count;
+    };
+
+    const checksums = core.Boolean.get(env, argv[5]) catch {
+        return error.invalid_argument_checksums;
+    };
+
+    var seed: ?c_uint = null;
+    if (e.enif_is_identical(core.Atom.make(env, "nil"), argv[6]) == 0) {
+        seed = core.UInt.get(env, argv[6]) catch {
+            return error.invalid_argument_seed;
+        };
+    }
+
+    const params = replay.Params{
+        .width = width,
+        .height = height,
+        .fixed_fps = fixed_fps,
+        .frame_count = frame_count,
+        .checksums = checksums,
+        .seed = seed,
+    };
+
+    // Function
+
+    const value = if (e.enif_is_binary(env, argv[0]) != 0) blk: {
+        const arg_file_name = core.ArgumentBinaryCUnknown(core.CString, rl.allocator).get(env, argv[0]) catch {
+            return error.invalid_argument_file_name;
+        };
+        defer arg_file_name.free();
+
+        const list = rl.LoadAutomationEventList(arg_file_name.data);
+        defer rl.UnloadAutomationEventList(list);
+
+        if (list.events == null) return error.invalid_argument_file_name;
+
+        break :blk try replay.LoadReplay(list.events[0..list.count], params);
+    } else blk: {
+        const arg_list = core.Argument(core.AutomationEventList).get(env, argv[0]) catch {
+            return error.invalid_argument_events;
+        };
+        defer arg_list.free();
+
+        const list = arg_list.data;
+        if (list.events == null) return error.invalid_argument_events;
+
+        break :blk try replay.LoadReplay(list.events[0..@min(list.count, list.capacity)], params);
+    };
+    errdefer {
+        replay.UnloadReplay(value);
+        value.deinit();
+    }
+
+    // Return
+
+    return core.Replay.make(env, value) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Go back to the first frame of the replay, the frame times and checksums are cleared
+fn nif_rewind_replay(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const value = core.Replay.get(env, argv[0]) catch {
+        return error.invalid_argument_replay;
+    };
+
+    // Function
+
+    value.rewind();
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+//////////////
+//  Frames  //
+//////////////
+
+/// Poll the input, play the events of the next frame and start drawing to the replay render texture,
+/// returns {frame, dt} with the fixed timestep or :done when all the frames have run
+///
+/// NOTE: Replaces BeginDrawing, nothing waits for vsync
+fn nif_begin_replay_frame(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const value = core.Replay.get(env, argv[0]) catch {
+        return error.invalid_argument_replay;
+    };
+
+    // Function
+
+    const frame = (try value.begin_frame()) orelse return core.Atom.make(env, "done");
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        core.UInt.make(env, frame.index),
+        core.Double.make(env, frame.dt),
+    });
+}
+
+/// Stop drawing to the replay render texture and record the frame, returns the frame time (in seconds)
+///
+/// NOTE: Replaces EndDrawing, the screen buffer is not swapped
+fn nif_end_replay_frame(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const value = core.Replay.get(env, argv[0]) catch {
+        return error.invalid_argument_replay;
+    };
+
+    // Function
+
+    const frame_time = try value.end_frame();
+
+    // Return
+
+    return core.Double.make(env, frame_time);
+}
+
+/////////////
+//  Stats  //
+/////////////
+
+/// Get the frame time stats of the frames run so far, returns
+/// {frames, events, {total, mean, min, max, stddev, p50, p90, p99}}
+fn nif_get_replay_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const value = core.Replay.get(env, argv[0]) catch {
+        return error.invalid_argument_replay;
+    };
+
+    // Function
+
+    const stats = try value.get_stats();
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        e.enif_make_uint64(env, stats.frames),
+        e.enif_make_uint64(env, stats.events),
+        core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Double.make(env, stats.total),
+            core.Double.make(env, stats.mean),
+            core.Double.make(env, stats.min),
+            core.Double.make(env, stats.max),
+            core.Double.make(env, stats.stddev),
+            core.Double.make(env, stats.p50),
+            core.Double.make(env, stats.p90),
+            core.Double.make(env, stats.p99),
+        }),
+    });
+}
+
+/// Get the frames run so far, returns a list of {frame_time, checksum} (checksum is nil without checksums)
+fn nif_get_replay_frames(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const value = core.Replay.get(env, argv[0]) catch {
+        return error.invalid_argument_replay;
+    };
+
+    // Return
+
+    const times = value.times.items;
+    const checksums = value.checksums.items;
+
+    const terms = try rl.allocator.alloc(e.ErlNifTerm, times.len);
+    defer rl.allocator.free(terms);
+
+    for (times, 0..) |time, i| {
+        terms[i] = core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Double.make(env, @as(f64, @floatFromInt(time)) / std.time.ns_per_s),
+            if (i < checksums.len) e.enif_make_uint64(env, checksums[i]) else core.Atom.make(env, "nil"),
+        });
+    }
+
+    return e.enif_make_list_from_array(env, terms.ptr, @intCast(terms.len));
+}
@@ -298,6 +298,36 @@ pub const exported_nifs = [_]e.ErlNifFunc{
     .{ .name = "automation_event_list_from_resource", .arity = 1, .fptr = core.nif_wrapper(nif_automation_event_list_from_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "automation_event_list_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_automation_event_list_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "automation_event_list_update_resource", .arity = 2, .fptr = core.nif_wrapper(nif_automation_event_list_update_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Scene
+    .{ .name = "scene_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_scene_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // UniformSet
+    .{ .name = "uniform_set_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_uniform_set_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // ImageAnimStream
+    .{ .name = "image_anim_stream_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_image_anim_stream_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // AssetPack
+    .{ .name = "asset_pack_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_asset_pack_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // TextureStream
+    .{ .name = "texture_stream_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_texture_stream_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // DisplayList
+    .{ .name = "display_list_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_display_list_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // VoicePool
+    .{ .name = "voice_pool_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_voice_pool_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Terrain
+    .{ .name = "terrain_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_terrain_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // SpriteAtlas
+    .{ .name = "sprite_atlas_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_sprite_atlas_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Replay
+    .{ .name = "replay_free_resource", .arity = 1, .fptr = core.nif_wrapper(nif_replay_free_resource), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
 };
 
 ///////////////
@@ -1144,6 +1174,9 @@ fn nif_texture_to_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.Er
     };
     defer core.Texture.Resource.release(resource);
 
+    // The GL objects may be shared with other values, not reclaimed when garbage collected
+    core.Texture.Resource.disown(resource);
+
     return core.Texture.Resource.make(env, resource);
 }
 
@@ -1203,6 +1236,9 @@ fn nif_texture_2d_to_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e
     };
     defer core.Texture2D.Resource.release(resource);
 
+    // The GL objects may be shared with other values, not reclaimed when garbage collected
+    core.Texture2D.Resource.disown(resource);
+
     return core.Texture2D.Resource.make(env, resource);
 }
 
@@ -1262,6 +1298,9 @@ fn nif_texture_cubemap_to_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]co
     };
     defer core.TextureCubemap.Resource.release(resource);
 
+    // The GL objects may be shared with other values, not reclaimed when garbage collected
+    core.TextureCubemap.Resource.disown(resource);
+
     return core.TextureCubemap.Resource.make(env, resource);
 }
 
@@ -1321,6 +1360,9 @@ fn nif_render_texture_to_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]con
     };
     defer core.RenderTexture.Resource.release(resource);
 
+    // The GL objects may be shared with other values, not reclaimed when garbage collected
+    core.RenderTexture.Resource.disown(resource);
+
     return core.RenderTexture.Resource.make(env, resource);
 }
 
@@ -1380,6 +1422,9 @@ fn nif_render_texture_2d_to_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]
     };
     defer core.RenderTexture2D.Resource.release(resource);
 
+    // The GL objects may be shared with other values, not reclaimed when garbage collected
+    core.RenderTexture2D.Resource.disown(resource);
+
     return core.RenderTexture2D.Resource.make(env, resource);
 }
 
@@ -1557,6 +1602,9 @@ fn nif_font_to_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNi
     };
     defer core.Font.Resource.release(resource);
 
+    // The GL objects may be shared with other values, not reclaimed when garbage collected
+    core.Font.Resource.disown(resource);
+
     return core.Font.Resource.make(env, resource);
 }
 
@@ -1793,6 +1841,9 @@ fn nif_mesh_to_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNi
     };
     defer core.Mesh.Resource.release(resource);
 
+    // The GL objects may be shared with other values, not reclaimed when garbage collected
+    core.Mesh.Resource.disown(resource);
+
     return core.Mesh.Resource.make(env, resource);
 }
 
@@ -1852,6 +1903,9 @@ fn nif_shader_to_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.Erl
     };
     defer core.Shader.Resource.release(resource);
 
+    // The GL objects may be shared with other values, not reclaimed when garbage collected
+    core.Shader.Resource.disown(resource);
+
     return core.Shader.Resource.make(env, resource);
 }
 
@@ -2147,6 +2201,9 @@ fn nif_model_to_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlN
     };
     defer core.Model.Resource.release(resource);
 
+    // The GL objects may be shared with other values, not reclaimed when garbage collected
+    core.Model.Resource.disown(resource);
+
     return core.Model.Resource.make(env, resource);
 }
 
@@ -3190,3 +3247,163 @@ fn nif_automation_event_list_update_resource(env: ?*e.ErlNifEnv, argc: c_int, ar
 
     return core.Atom.make(env, "ok");
 }
+
+/////////////
+//  Scene  //
+/////////////
+
+fn nif_scene_free_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    const resource = core.Scene.Resource.get(env, argv[0]) catch {
+        return error.invalid_argument_resource;
+    };
+
+    core.Scene.Resource.free(resource);
+
+    return core.Atom.make(env, "ok");
+}
+
+//////////////////
+//  UniformSet  //
+//////////////////
+
+fn nif_uniform_set_free_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    const resource = core.UniformSet.Resource.get(env, argv[0]) catch {
+        return error.invalid_argument_resource;
+    };
+
+    core.UniformSet.Resource.free(resource);
+
+    return core.Atom.make(env, "ok");
+}
+
+///////////////////////
+//  ImageAnimStream  //
+///////////////////////
+
+fn nif_image_anim_stream_free_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    const resource = core.ImageAnimStream.Resource.get(env, argv[0]) catch {
+        return error.invalid_argument_resource;
+    };
+
+    core.ImageAnimStream.Resource.free(resource);
+
+    return core.Atom.make(env, "ok");
+}
+
+/////////////////
+//  AssetPack  //
+/////////////////
+
+fn nif_asset_pack_free_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    const resource = core.AssetPack.Resource.get(env, argv[0]) catch {
+        return error.invalid_argument_resource;
+    };
+
+    core.AssetPack.Resource.free(resource);
+
+    return core.Atom.make(env, "ok");
+}
+
+/////////////////////
+//  TextureStream  //
+/////////////////////
+
+fn nif_texture_stream_free_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    const resource = core.TextureStream.Resource.get(env, argv[0]) catch {
+        return error.invalid_argument_resource;
+    };
+
+    core.TextureStream.Resource.free(resource);
+
+    return core.Atom.make(env, "ok");
+}
+
+///////////////////
+//  DisplayList  //
+///////////////////
+
+fn nif_display_list_free_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    const resource = core.DisplayList.Resource.get(env, argv[0]) catch {
+        return error.invalid_argument_resource;
+    };
+
+    core.DisplayList.Resource.free(resource);
+
+    return core.Atom.make(env, "ok");
+}
+
+/////////////////
+//  VoicePool  //
+/////////////////
+
+fn nif_voice_pool_free_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    const resource = core.VoicePool.Resource.get(env, argv[0]) catch {
+        return error.invalid_argument_resource;
+    };
+
+    core.VoicePool.Resource.free(resource);
+
+    return core.Atom.make(env, "ok");
+}
+
+///////////////
+//  Terrain  //
+///////////////
+
+fn nif_terrain_free_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    const resource = core.Terrain.Resource.get(env, argv[0]) catch {
+        return error.invalid_argument_resource;
+    };
+
+    core.Terrain.Resource.free(resource);
+
+    return core.Atom.make(env, "ok");
+}
+
+///////////////////
+//  SpriteAtlas  //
+///////////////////
+
+fn nif_sprite_atlas_free_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    const resource = core.SpriteAtlas.Resource.get(env, argv[0]) catch {
+        return error.invalid_argument_resource;
+    };
+
+    core.SpriteAtlas.Resource.free(resource);
+
+    return core.Atom.make(env, "ok");
+}
+
+//////////////
+//  Replay  //
+//////////////
+
+fn nif_replay_free_resource(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    const resource = core.Replay.Resource.get(env, argv[0]) catch {
+        return error.invalid_argument_resource;
+    };
+
+    core.Replay.Resource.free(resource);
+
+    return core.Atom.make(env, "ok");
+}
@@ -0,0 +1,445 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+const core = @import("../core.zig");
+const scene = @import("../scene.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Scene management
+    .{ .name = "load_scene", .arity = 0, .fptr = core.nif_wrapper(nif_load_scene), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "scene_clear", .arity = 1, .fptr = core.nif_wrapper(nif_scene_clear), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_scene_stats", .arity = 1, .fptr = core.nif_wrapper(nif_get_scene_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Scene nodes
+    .{ .name = "scene_set_node_model", .arity = 6, .fptr = core.nif_wrapper(nif_scene_set_node_model), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "scene_set_node_mesh", .arity = 7, .fptr = core.nif_wrapper(nif_scene_set_node_mesh), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "scene_set_node_transform", .arity = 3, .fptr = core.nif_wrapper(nif_scene_set_node_transform), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "scene_set_node_transforms", .arity = 2, .fptr = core.nif_wrapper(nif_scene_set_node_transforms), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "scene_set_node_parent", .arity = 3, .fptr = core.nif_wrapper(nif_scene_set_node_parent), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "scene_set_node_tint", .arity = 3, .fptr = core.nif_wrapper(nif_scene_set_node_tint), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "scene_set_node_visible", .arity = 3, .fptr = core.nif_wrapper(nif_scene_set_node_visible), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "scene_remove_node", .arity = 2, .fptr = core.nif_wrapper(nif_scene_remove_node), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Scene drawing
+    .{ .name = "scene_draw", .arity = 2, .fptr = core.nif_wrapper(nif_scene_draw), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+fn get_parent(env: ?*e.ErlNifEnv, term: e.ErlNifTerm) !?u32 {
+    if (e.enif_is_identical(core.Atom.make(env, "nil"), term) != 0) {
+        return null;
+    }
+
+    return @intCast(try core.UInt.get(env, term));
+}
+
+////////////////////////
+//  Scene management  //
+////////////////////////
+
+/// Load an empty scene
+fn nif_load_scene(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 0);
+    _ = argv;
+
+    // Function
+
+    const value = try scene.LoadScene();
+    errdefer scene.UnloadScene(value);
+
+    // Return
+
+    return core.Scene.make(env, value) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Remove all the nodes from the scene
+fn nif_scene_clear(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    // Function
+
+    value.clear();
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Get the scene statistics of the last draw {nodes, drawn, culled, draw_calls}
+fn nif_get_scene_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    // Function
+
+    const stats = value.get_stats();
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        core.UInt.make(env, stats.nodes),
+        core.UInt.make(env, stats.drawn),
+        core.UInt.make(env, stats.culled),
+        core.UInt.make(env, stats.draw_calls),
+    });
+}
+
+///////////////////
+//  Scene nodes  //
+///////////////////
+
+/// Insert or replace a node drawing a model
+///
+/// NOTE: The model must be a resource, it is kept alive by the scene
+fn nif_scene_set_node_model(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 6);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    const id = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_id;
+    };
+
+    const parent = get_parent(env, argv[2]) catch {
+        return error.invalid_argument_parent;
+    };
+
+    const arg_transform = core.Argument(core.Matrix).get(env, argv[3]) catch {
+        return error.invalid_argument_transform;
+    };
+    defer arg_transform.free();
+    const transform = arg_transform.data;
+
+    const model = core.Model.Resource.get(env, argv[4]) catch {
+        return error.invalid_argument_model;
+    };
+
+    const arg_tint = core.Argument(core.Color).get(env, argv[5]) catch {
+        return error.invalid_argument_tint;
+    };
+    defer arg_tint.free();
+    const tint = arg_tint.data;
+
+    // Function
+
+    try value.set_node(.{
+        .id = @intCast(id),
+        .parent = parent,
+        .transform = transform,
+        .tint = tint,
+        .drawable = .{ .model = model },
+    });
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Insert or replace a node drawing a mesh with a material
+///
+/// NOTE: The mesh and the material must be resources, they are kept alive by the scene
+fn nif_scene_set_node_mesh(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 7);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    const id = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_id;
+    };
+
+    const parent = get_parent(env, argv[2]) catch {
+        return error.invalid_argument_parent;
+    };
+
+    const arg_transform = core.Argument(core.Matrix).get(env, argv[3]) catch {
+        return error.invalid_argument_transform;
+    };
+    defer arg_transform.free();
+    const transform = arg_transform.data;
+
+    const mesh = core.Mesh.Resource.get(env, argv[4]) catch {
+        return error.invalid_argument_mesh;
+    };
+
+    const material = core.Material.Resource.get(env, argv[5]) catch {
+        return error.invalid_argument_material;
+    };
+
+    const arg_tint = core.Argument(core.Color).get(env, argv[6]) catch {
+        return error.invalid_argument_tint;
+    };
+    defer arg_tint.free();
+    const tint = arg_tint.data;
+
+    // Function
+
+    try value.set_node(.{
+        .id = @intCast(id),
+        .parent = parent,
+        .transform = transform,
+        .tint = tint,
+        .drawable = .{ .mesh = .{ .mesh = mesh, .material = material } },
+    });
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Set the node local transform (relative to the parent)
+fn nif_scene_set_node_transform(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    const id = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_id;
+    };
+
+    const arg_transform = core.Argument(core.Matrix).get(env, argv[2]) catch {
+        return error.invalid_argument_transform;
+    };
+    defer arg_transform.free();
+    const transform = arg_transform.data;
+
+    // Function
+
+    const found = value.set_node_transform(@intCast(id), transform);
+
+    // Return
+
+    return core.Boolean.make(env, found);
+}
+
+/// Set the local transform of many nodes at once, list of {id, transform}
+///
+/// Returns the number of nodes updated
+fn nif_scene_set_node_transforms(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    if (e.enif_is_list(env, argv[1]) == 0) {
+        return error.invalid_argument_transforms;
+    }
+
+    // Function
+
+    var updated: c_uint = 0;
+
+    var list = argv[1];
+    var head: e.ErlNifTerm = undefined;
+    while (e.enif_get_list_cell(env, list, &head, &list) != 0) {
+        const record = core.Tuple.get(env, head) catch {
+            return error.invalid_argument_transforms;
+        };
+        if (record.len != 2) {
+            return error.invalid_argument_transforms;
+        }
+
+        const id = core.UInt.get(env, record[0]) catch {
+            return error.invalid_argument_transforms;
+        };
+
+        const arg_transform = core.Argument(core.Matrix).get(env, record[1]) catch {
+            return error.invalid_argument_transforms;
+        };
+        defer arg_transform.free();
+
+        if (value.set_node_transform(@intCast(id), arg_transform.data)) {
+            updated += 1;
+        }
+    }
+
+    // Return
+
+    return core.UInt.make(env, updated);
+}
+
+/// Set the node parent (nil for a root node)
+fn nif_scene_set_node_parent(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    const id = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_id;
+    };
+
+    const parent = get_parent(env, argv[2]) catch {
+        return error.invalid_argument_parent;
+    };
+
+    // Function
+
+    const found = value.set_node_parent(@intCast(id), parent);
+
+    // Return
+
+    return core.Boolean.make(env, found);
+}
+
+/// Set the node tint
+fn nif_scene_set_node_tint(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    const id = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_id;
+    };
+
+    const arg_tint = core.Argument(core.Color).get(env, argv[2]) catch {
+        return error.invalid_argument_tint;
+    };
+    defer arg_tint.free();
+    const tint = arg_tint.data;
+
+    // Function
+
+    const found = value.set_node_tint(@intCast(id), tint);
+
+    // Return
+
+    return core.Boolean.make(env, found);
+}
+
+/// Set the node visibility (hidden nodes hide their children)
+fn nif_scene_set_node_visible(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    const id = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_id;
+    };
+
+    const visible = core.Boolean.get(env, argv[2]) catch {
+        return error.invalid_argument_visible;
+    };
+
+    // Function
+
+    const found = value.set_node_visible(@intCast(id), visible);
+
+    // Return
+
+    return core.Boolean.make(env, found);
+}
+
+/// Remove a node from the scene (the children become root nodes)
+fn nif_scene_remove_node(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    const id = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_id;
+    };
+
+    // Function
+
+    const found = value.remove_node(@intCast(id));
+
+    // Return
+
+    return core.Boolean.make(env, found);
+}
+
+/////////////////////
+//  Scene drawing  //
+/////////////////////
+
+/// Draw the visible nodes of the scene (frustum culled and sorted by material)
+///
+/// NOTE: Must be called inside begin_mode_3d/1 with the same camera
+fn nif_scene_draw(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const arg_scene = core.Argument(core.Scene).get(env, argv[0]) catch {
+        return error.invalid_argument_scene;
+    };
+    defer arg_scene.free();
+    const value = arg_scene.data;
+
+    const arg_camera = core.Argument(core.Camera3D).get(env, argv[1]) catch {
+        return error.invalid_argument_camera;
+    };
+    defer arg_camera.free();
+    const camera = arg_camera.data;
+
+    // Function
+
+    _ = try value.draw(camera);
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
@@ -4,6 +4,7 @@ const e = @import("../erl_nif.zig");
 const rl = @import("../raylib.zig");
 
 const core = @import("../core.zig");
+const uniform_set = @import("../uniform_set.zig");
 
 pub const exported_nifs = [_]e.ErlNifFunc{
     // Shader
@@ -18,6 +19,16 @@ pub const exported_nifs = [_]e.ErlNifFunc{
     .{ .name = "set_shader_value_v", .arity = 4, .fptr = core.nif_wrapper(nif_set_shader_value_v), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "set_shader_value_matrix", .arity = 3, .fptr = core.nif_wrapper(nif_set_shader_value_matrix), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "set_shader_value_texture", .arity = 3, .fptr = core.nif_wrapper(nif_set_shader_value_texture), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Uniform set
+    .{ .name = "load_uniform_set", .arity = 2, .fptr = core.nif_wrapper(nif_load_uniform_set), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_uniform_set", .arity = 3, .fptr = core.nif_wrapper(nif_load_uniform_set), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_uniform_set_layout", .arity = 1, .fptr = core.nif_wrapper(nif_get_uniform_set_layout), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "update_uniform_set", .arity = 2, .fptr = core.nif_wrapper(nif_update_uniform_set), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "set_uniform_set_values", .arity = 2, .fptr = core.nif_wrapper(nif_set_uniform_set_values), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "apply_uniform_set", .arity = 1, .fptr = core.nif_wrapper(nif_apply_uniform_set), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "invalidate_uniform_set", .arity = 1, .fptr = core.nif_wrapper(nif_invalidate_uniform_set), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_uniform_set_stats", .arity = 1, .fptr = core.nif_wrapper(nif_get_uniform_set_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
 };
 
 //////////////
@@ -536,3 +547,382 @@ fn nif_set_shader_value_texture(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const
 
     return core.Atom.make(env, "ok");
 }
+
+///////////////////
+//  Uniform set  //
+///////////////////
+
+/// Get a uniform name from an atom or a binary (no allocation)
+fn get_uniform_name(env: ?*e.ErlNifEnv, term: e.ErlNifTerm, buffer: []u8) ![]const u8 {
+    if (e.enif_is_atom(env, term) != 0) {
+        const len = e.enif_get_atom(env, term, buffer.ptr, @intCast(buffer.len), e.ERL_NIF_LATIN1);
+        if (len <= 0) return error.ArgumentError;
+        return buffer[0..@intCast(len - 1)];
+    }
+
+    return core.Binary.get_view(env, term);
+}
+
+/// Get a uniform type, uniform data type value or :matrix
+fn get_uniform_type(env: ?*e.ErlNifEnv, term: e.ErlNifTerm) !c_int {
+    if (e.enif_is_identical(core.Atom.make(env, "matrix"), term) != 0) {
+        return uniform_set.UNIFORM_MATRIX;
+    }
+
+    return core.Int.get(env, term);
+}
+
+/// Write a number component of the uniform type
+fn write_uniform_component(env: ?*e.ErlNifEnv, term: e.ErlNifTerm, uniform_type: c_int, out: []u8, pos: *usize) !void {
+    if (pos.* + 4 > out.len) return error.ArgumentError;
+
+    const dest = out[pos.*..][0..4];
+    switch (uniform_type) {
+        rl.RL_SHADER_UNIFORM_INT, rl.RL_SHADER_UNIFORM_IVEC2, rl.RL_SHADER_UNIFORM_IVEC3, rl.RL_SHADER_UNIFORM_IVEC4, rl.RL_SHADER_UNIFORM_SAMPLER2D => {
+            dest.* = @bitCast(try core.Int.get(env, term));
+        },
+        rl.RL_SHADER_UNIFORM_UINT, rl.RL_SHADER_UNIFORM_UIVEC2, rl.RL_SHADER_UNIFORM_UIVEC3, rl.RL_SHADER_UNIFORM_UIVEC4 => {
+            dest.* = @bitCast(try core.UInt.get(env, term));
+        },
+        else => {
+            dest.* = @bitCast(try core.Float.get(env, term));
+        },
+    }
+    pos.* += 4;
+}
+
+/// Write the bytes of a decoded value
+fn write_uniform_bytes(value: anytype, out: []u8, pos: *usize) !void {
+    const bytes = std.mem.asBytes(&value);
+    if (pos.* + bytes.len > out.len) return error.ArgumentError;
+
+    @memcpy(out[pos.*..][0..bytes.len], bytes);
+    pos.* += bytes.len;
+}
+
+/// Write one element of the uniform type from a record (vectors, matrix)
+fn write_uniform_record(env: ?*e.ErlNifEnv, term: e.ErlNifTerm, uniform_type: c_int, out: []u8, pos: *usize) !void {
+    switch (uniform_type) {
+        rl.RL_SHADER_UNIFORM_VEC2 => try write_uniform_bytes(try core.Vector2.get(env, term), out, pos),
+        rl.RL_SHADER_UNIFORM_VEC3 => try write_uniform_bytes(try core.Vector3.get(env, term), out, pos),
+        rl.RL_SHADER_UNIFORM_VEC4 => try write_uniform_bytes(try core.Vector4.get(env, term), out, pos),
+        rl.RL_SHADER_UNIFORM_IVEC2 => try write_uniform_bytes(try core.IVector2.get(env, term), out, pos),
+        rl.RL_SHADER_UNIFORM_IVEC3 => try write_uniform_bytes(try core.IVector3.get(env, term), out, pos),
+        rl.RL_SHADER_UNIFORM_IVEC4 => try write_uniform_bytes(try core.IVector4.get(env, term), out, pos),
+        rl.RL_SHADER_UNIFORM_UIVEC2 => try write_uniform_bytes(try core.UIVector2.get(env, term), out, pos),
+        rl.RL_SHADER_UNIFORM_UIVEC3 => try write_uniform_bytes(try core.UIVector3.get(env, term), out, pos),
+        rl.RL_SHADER_UNIFORM_UIVEC4 => try write_uniform_bytes(try core.UIVector4.get(env, term), out, pos),
+        uniform_set.UNIFORM_MATRIX => try write_uniform_bytes(try core.Matrix.get(env, term), out, pos),
+        else => return error.ArgumentError,
+    }
+}
+
+/// Encode a uniform value: binary, number, record or list of numbers/records
+fn write_uniform_value(env: ?*e.ErlNifEnv, term: e.ErlNifTerm, uniform_type: c_int, out: []u8, pos: *usize) !void {
+    if (e.enif_is_binary(env, term) != 0) {
+        const value = try core.Binary.get_view(env, term);
+        if (pos.* + value.len > out.len) return error.ArgumentError;
+        @memcpy(out[pos.*..][0..value.len], value);
+        pos.* += value.len;
+    } else if (e.enif_is_number(env, term) != 0) {
+        try write_uniform_component(env, term, uniform_type, out, pos);
+    } else if (e.enif_is_tuple(env, term) != 0) {
+        try write_uniform_record(env, term, uniform_type, out, pos);
+    } else if (e.enif_is_list(env, term) != 0) {
+        var list = term;
+        var head: e.ErlNifTerm = undefined;
+        while (e.enif_get_list_cell(env, list, &head, &list) != 0) {
+            try write_uniform_value(env, head, uniform_type, out, pos);
+        }
+    } else {
+        return error.ArgumentError;
+    }
+}
+
+/// Load a uniform set for the shader, resolving the uniform locations once
+///
+/// The uniforms are a list of {name, uniform_type} or {name, uniform_type, count},
+/// uniform_type is a shader uniform data type or :matrix
+///
+/// If binding is set, the values are uploaded as one shader buffer bound to this index
+/// (requires OpenGL 4.3, falls back to uniforms otherwise)
+fn nif_load_uniform_set(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Arguments
+
+    const arg_shader = core.Argument(core.Shader).get(env, argv[0]) catch {
+        return error.invalid_argument_shader;
+    };
+    defer arg_shader.free();
+    const shader = arg_shader.data;
+
+    const uniforms_length = core.Array.get_length(env, argv[1]) catch {
+        return error.invalid_argument_uniforms;
+    };
+
+    var binding: ?c_uint = null;
+    if (argc == 3 and e.enif_is_identical(core.Atom.make(env, "nil"), argv[2]) == 0) {
+        binding = core.UInt.get(env, argv[2]) catch {
+            return error.invalid_argument_binding;
+        };
+    }
+
+    const descs = try rl.allocator.alloc(uniform_set.UniformDesc, uniforms_length);
+    defer rl.allocator.free(descs);
+
+    const name_buffers = try rl.allocator.alloc([256]u8, uniforms_length);
+    defer rl.allocator.free(name_buffers);
+
+    var list = argv[1];
+    var head: e.ErlNifTerm = undefined;
+    var i: usize = 0;
+    while (e.enif_get_list_cell(env, list, &head, &list) != 0) : (i += 1) {
+        const record = core.Tuple.get(env, head) catch {
+            return error.invalid_argument_uniforms;
+        };
+        if (record.len != 2 and record.len != 3) {
+            return error.invalid_argument_uniforms;
+        }
+
+        descs[i] = uniform_set.UniformDesc{
+            .name = get_uniform_name(env, record[0], &name_buffers[i]) catch {
+                return error.invalid_argument_uniforms;
+            },
+            .uniform_type = get_uniform_type(env, record[1]) catch {
+                return error.invalid_argument_uniforms;
+            },
+            .count = if (record.len == 3) core.Int.get(env, record[2]) catch {
+                return error.invalid_argument_uniforms;
+            } else 1,
+        };
+    }
+
+    // Function
+
+    const value = uniform_set.LoadUniformSet(shader, descs, binding) catch |err| switch (err) {
+        error.OutOfMemory => return err,
+        else => return error.invalid_argument_uniforms,
+    };
+    errdefer {
+        uniform_set.UnloadUniformSet(value);
+        value.deinit();
+    }
+
+    // Return
+
+    return core.UniformSet.make(env, value) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Get the uniform set layout, list of {name, location, offset, size} in the staging buffer order
+///
+/// NOTE: With a shader buffer the staging buffer follows the std430 layout (vec3 aligned and strided as vec4)
+fn nif_get_uniform_set_layout(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const arg_uniform_set = core.Argument(core.UniformSet).get(env, argv[0]) catch {
+        return error.invalid_argument_uniform_set;
+    };
+    defer arg_uniform_set.free();
+    const value = arg_uniform_set.data;
+
+    // Return
+
+    var term = e.enif_make_list(env, 0);
+
+    var i = value.uniforms.len;
+    while (i > 0) {
+        i -= 1;
+        const uniform = value.uniforms[i];
+        const item = core.Tuple.make(env, &[_]e.ErlNifTerm{
+            core.Binary.make(env, uniform.name),
+            core.Int.make(env, uniform.location),
+            core.UInt.make(env, @intCast(uniform.offset)),
+            core.UInt.make(env, @intCast(uniform.span)),
+        });
+        term = e.enif_make_list_cell(env, item, term);
+    }
+
+    return term;
+}
+
+/// Replace all the uniform values from a packed binary (staging buffer layout)
+///
+/// Only the uniforms whose bytes changed are uploaded by apply_uniform_set/1
+fn nif_update_uniform_set(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const arg_uniform_set = core.Argument(core.UniformSet).get(env, argv[0]) catch {
+        return error.invalid_argument_uniform_set;
+    };
+    defer arg_uniform_set.free();
+    const value = arg_uniform_set.data;
+
+    const data = core.Binary.get_view(env, argv[1]) catch {
+        return error.invalid_argument_data;
+    };
+
+    // Function
+
+    value.write_all(data) catch {
+        return error.invalid_argument_data;
+    };
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Set uniform values from a map or a keyword list of name => value
+///
+/// A value is a binary, a number, a vector/matrix record or a list of them
+fn nif_set_uniform_set_values(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const arg_uniform_set = core.Argument(core.UniformSet).get(env, argv[0]) catch {
+        return error.invalid_argument_uniform_set;
+    };
+    defer arg_uniform_set.free();
+    const value = arg_uniform_set.data;
+
+    // Function
+
+    var buffer: [@sizeOf(rl.Matrix) * 64]u8 = undefined;
+    var name_buffer: [256]u8 = undefined;
+
+    const Set = struct {
+        fn put(s_env: ?*e.ErlNifEnv, set: *uniform_set.UniformSet, key: e.ErlNifTerm, term: e.ErlNifTerm, out: []u8, name_out: []u8) !void {
+            const name = try get_uniform_name(s_env, key, name_out);
+            const index = set.index_of(name) orelse return error.ArgumentError;
+            const uniform = set.uniforms[index];
+
+            var heap: ?[]u8 = null;
+            defer if (heap) |h| rl.allocator.free(h);
+
+            const dest = if (uniform.size <= out.len) out[0..uniform.size] else blk: {
+                heap = try rl.allocator.alloc(u8, uniform.size);
+                break :blk heap.?;
+            };
+
+            var pos: usize = 0;
+            try write_uniform_value(s_env, term, uniform.uniform_type, dest, &pos);
+            if (pos != uniform.size) return error.ArgumentError;
+
+            try set.write(index, dest);
+        }
+    };
+
+    if (e.enif_is_map(env, argv[1]) != 0) {
+        var iter: e.ErlNifMapIterator = undefined;
+        if (e.enif_map_iterator_create(env, argv[1], &iter, e.ERL_NIF_MAP_ITERATOR_FIRST) == 0) {
+            return error.invalid_argument_values;
+        }
+        defer e.enif_map_iterator_destroy(env, &iter);
+
+        var key: e.ErlNifTerm = undefined;
+        var term: e.ErlNifTerm = undefined;
+        while (e.enif_map_iterator_get_pair(env, &iter, &key, &term) != 0) {
+            Set.put(env, value, key, term, &buffer, &name_buffer) catch |err| switch (err) {
+                error.OutOfMemory => return err,
+                else => return error.invalid_argument_values,
+            };
+            _ = e.enif_map_iterator_next(env, &iter);
+        }
+    } else {
+        var list = argv[1];
+        var head: e.ErlNifTerm = undefined;
+        while (e.enif_get_list_cell(env, list, &head, &list) != 0) {
+            const record = core.Tuple.get(env, head) catch {
+                return error.invalid_argument_values;
+            };
+            if (record.len != 2) {
+                return error.invalid_argument_values;
+            }
+
+            Set.put(env, value, record[0], record[1], &buffer, &name_buffer) catch |err| switch (err) {
+                error.OutOfMemory => return err,
+                else => return error.invalid_argument_values,
+            };
+        }
+    }
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Upload the dirty uniforms of the set to its shader, returns the number of uniforms uploaded
+///
+/// NOTE: Use it inside begin_shader_mode/1 (or use begin_shader_mode/2)
+fn nif_apply_uniform_set(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const arg_uniform_set = core.Argument(core.UniformSet).get(env, argv[0]) catch {
+        return error.invalid_argument_uniform_set;
+    };
+    defer arg_uniform_set.free();
+    const value = arg_uniform_set.data;
+
+    // Function
+
+    const uploaded = value.apply();
+
+    // Return
+
+    return core.UInt.make(env, uploaded);
+}
+
+/// Mark all the uniforms of the set dirty (after the shader values were changed elsewhere)
+fn nif_invalidate_uniform_set(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const arg_uniform_set = core.Argument(core.UniformSet).get(env, argv[0]) catch {
+        return error.invalid_argument_uniform_set;
+    };
+    defer arg_uniform_set.free();
+    const value = arg_uniform_set.data;
+
+    // Function
+
+    value.invalidate();
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Get the uniform set statistics, returns {uploads, skipped}
+fn nif_get_uniform_set_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const arg_uniform_set = core.Argument(core.UniformSet).get(env, argv[0]) catch {
+        return error.invalid_argument_uniform_set;
+    };
+    defer arg_uniform_set.free();
+    const value = arg_uniform_set.data;
+
+    // Function
+
+    const stats = value.get_stats();
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        e.enif_make_uint64(env, stats.uploads),
+        e.enif_make_uint64(env, stats.skipped),
+    });
+}
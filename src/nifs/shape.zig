@@ -146,9 +146,19 @@ fn nif_get_shapes_texture(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.Erl
 
     // Return
 
-    return core.maybe_make_struct_as_resource(core.Texture2D, env, texture, return_resource) catch {
-        return error.invalid_return;
-    };
+    if (return_resource) {
+        const resource = core.Texture2D.Resource.create(texture) catch {
+            return error.invalid_return;
+        };
+        defer core.Texture2D.Resource.release(resource);
+
+        // Not reclaimed when garbage collected
+        core.Texture2D.Resource.disown(resource);
+
+        return core.Texture2D.Resource.make(env, resource);
+    }
+
+    return core.Texture2D.make(env, texture);
 }
 
 /// Get texture source rectangle that is used for shapes drawing
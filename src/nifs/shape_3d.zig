@@ -995,8 +995,53 @@ fn nif_load_model(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm)
     };
 }
 
+fn copy_mesh_array(comptime T: type, data: [*c]T, count: usize) ![*c]T {
+    if (data == null or count == 0) return null;
+
+    const size = std.math.cast(c_uint, std.math.mul(usize, count, @sizeOf(T)) catch return error.OutOfMemory) orelse return error.OutOfMemory;
+    const copy: [*c]T = @ptrCast(@alignCast(rl.MemAlloc(size) orelse return error.OutOfMemory));
+    @memcpy(copy[0..count], data[0..count]);
+
+    return copy;
+}
+
+/// Copy the CPU data of a mesh and upload it to new GL objects
+fn copy_mesh(mesh: rl.Mesh) !rl.Mesh {
+    if (mesh.vertices == null or mesh.vertexCount <= 0) return error.invalid_mesh;
+
+    const vertex_count: usize = @intCast(mesh.vertexCount);
+    const triangle_count: usize = @intCast(@max(mesh.triangleCount, 0));
+    const bone_count: usize = @intCast(@max(mesh.boneCount, 0));
+
+    var copy = rl.Mesh{
+        .vertexCount = mesh.vertexCount,
+        .triangleCount = mesh.triangleCount,
+        .boneCount = mesh.boneCount,
+    };
+    errdefer core.Mesh.free(copy);
+
+    copy.vertices = try copy_mesh_array(f32, mesh.vertices, vertex_count * 3);
+    copy.texcoords = try copy_mesh_array(f32, mesh.texcoords, vertex_count * 2);
+    copy.texcoords2 = try copy_mesh_array(f32, mesh.texcoords2, vertex_count * 2);
+    copy.normals = try copy_mesh_array(f32, mesh.normals, vertex_count * 3);
+    copy.tangents = try copy_mesh_array(f32, mesh.tangents, vertex_count * 4);
+    copy.colors = try copy_mesh_array(u8, mesh.colors, vertex_count * 4);
+    copy.indices = try copy_mesh_array(c_ushort, mesh.indices, triangle_count * 3);
+    copy.animVertices = try copy_mesh_array(f32, mesh.animVertices, vertex_count * 3);
+    copy.animNormals = try copy_mesh_array(f32, mesh.animNormals, vertex_count * 3);
+    copy.boneIds = try copy_mesh_array(u8, mesh.boneIds, vertex_count * 4);
+    copy.boneWeights = try copy_mesh_array(f32, mesh.boneWeights, vertex_count * 4);
+    copy.boneMatrices = try copy_mesh_array(rl.Matrix, mesh.boneMatrices, bone_count);
+
+    rl.UploadMesh(&copy, false);
+
+    return copy;
+}
+
 /// Load model from generated mesh (default material)
 ///
+/// NOTE: The model gets a copy of the mesh (uploaded again), the mesh is not shared
+///
 /// raylib.h
 /// RLAPI Model LoadModelFromMesh(Mesh mesh);
 fn nif_load_model_from_mesh(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
@@ -1016,7 +1061,14 @@ fn nif_load_model_from_mesh(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.E
 
     // Function
 
-    const model = rl.LoadModelFromMesh(mesh);
+    // The model owns (and unloads) its mesh, it gets its own copy of the mesh data and GL objects
+    // (the mesh argument is a resource owning its payload, or a value freed after the call)
+    const model_mesh = copy_mesh(mesh) catch |err| switch (err) {
+        error.invalid_mesh => return error.invalid_argument_mesh,
+        else => return err,
+    };
+
+    const model = rl.LoadModelFromMesh(model_mesh);
     defer if (!return_resource) core.Model.unload(model);
     errdefer if (return_resource) core.Model.unload(model);
 
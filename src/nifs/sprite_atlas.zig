@@ -0,0 +1,265 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+
+const core = @import("../core.zig");
+const sprite_atlas = @import("../sprite_atlas.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Loading
+    .{ .name = "load_sprite_atlas", .arity = 5, .fptr = core.nif_wrapper(nif_load_sprite_atlas), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_sprite_atlas_info", .arity = 1, .fptr = core.nif_wrapper(nif_get_sprite_atlas_info), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_sprite_rec", .arity = 2, .fptr = core.nif_wrapper(nif_get_sprite_rec), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_sprite_rec", .arity = 3, .fptr = core.nif_wrapper(nif_get_sprite_rec), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Drawing
+    .{ .name = "draw_sprite", .arity = 7, .fptr = core.nif_wrapper(nif_draw_sprite), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "draw_sprites", .arity = 2, .fptr = core.nif_wrapper(nif_draw_sprites), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+///////////////
+//  Loading  //
+///////////////
+
+/// Pack images in one texture, returns {atlas, sprites} with the source rectangle of each sprite (the id is the index)
+fn nif_load_sprite_atlas(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 5);
+
+    // Arguments
+
+    const length = core.Array.get_length(env, argv[0]) catch {
+        return error.invalid_argument_images;
+    };
+
+    const args = try rl.allocator.alloc(core.Argument(core.Image), length);
+    defer rl.allocator.free(args);
+
+    const images = try rl.allocator.alloc(rl.Image, length);
+    defer rl.allocator.free(images);
+
+    var count: usize = 0;
+    defer for (args[0..count]) |arg| arg.free();
+
+    var list = argv[0];
+    var head: e.ErlNifTerm = undefined;
+    while (e.enif_get_list_cell(env, list, &head, &list) != 0) {
+        args[count] = core.Argument(core.Image).get(env, head) catch {
+            return error.invalid_argument_images;
+        };
+        images[count] = args[count].data;
+        count += 1;
+    }
+
+    const padding = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_padding;
+    };
+
+    const max_size = core.UInt.get(env, argv[2]) catch {
+        return error.invalid_argument_max_size;
+    };
+
+    // Bounded by the atlas size, so the padded sizes can not overflow
+    if (padding > max_size / 2) return error.invalid_argument_padding;
+
+    const mipmaps = core.Boolean.get(env, argv[3]) catch {
+        return error.invalid_argument_mipmaps;
+    };
+
+    const filter = core.Int.get(env, argv[4]) catch {
+        return error.invalid_argument_filter;
+    };
+
+    // Function
+
+    const atlas = try sprite_atlas.LoadSpriteAtlas(images[0..count], .{
+        .padding = padding,
+        .max_size = max_size,
+        .mipmaps = mipmaps,
+        .filter = filter,
+    });
+    errdefer {
+        sprite_atlas.UnloadSpriteAtlas(atlas);
+        atlas.deinit();
+    }
+
+    // Return
+
+    const terms = try rl.allocator.alloc(e.ErlNifTerm, atlas.sprites.len);
+    defer rl.allocator.free(terms);
+
+    for (atlas.sprites, 0..) |sprite, i| terms[i] = core.Rectangle.make(env, sprite);
+
+    const term_sprites = e.enif_make_list_from_array(env, terms.ptr, @intCast(terms.len));
+
+    const term_atlas = core.SpriteAtlas.make(env, atlas) catch {
+        return error.invalid_return;
+    };
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{ term_atlas, term_sprites });
+}
+
+/// Get the sprite atlas info, returns {width, height, sprites, mipmaps, occupancy}
+fn nif_get_sprite_atlas_info(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const atlas = core.SpriteAtlas.get(env, argv[0]) catch {
+        return error.invalid_argument_atlas;
+    };
+
+    // Function
+
+    const info = atlas.get_info();
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        core.Int.make(env, info.width),
+        core.Int.make(env, info.height),
+        e.enif_make_uint64(env, info.sprites),
+        core.Int.make(env, info.mipmaps),
+        core.Float.make(env, info.occupancy),
+    });
+}
+
+/// Get the source rectangle of a sprite in the atlas texture
+fn nif_get_sprite_rec(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2 or argc == 3);
+
+    // Return type
+
+    const return_resource = core.must_return_resource(env, argc, argv, 2);
+
+    // Arguments
+
+    const atlas = core.SpriteAtlas.get(env, argv[0]) catch {
+        return error.invalid_argument_atlas;
+    };
+
+    const id = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_id;
+    };
+
+    // Function
+
+    const rec = atlas.get_sprite(id) orelse return error.invalid_argument_id;
+
+    // Return
+
+    return core.maybe_make_struct_as_resource(core.Rectangle, env, rec, return_resource) catch {
+        return error.invalid_return;
+    };
+}
+
+///////////////
+//  Drawing  //
+///////////////
+
+/// Draw a sprite of the atlas, origin and rotation as in DrawTexturePro (origin relative to the scaled sprite)
+fn nif_draw_sprite(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 7);
+
+    // Arguments
+
+    const atlas = core.SpriteAtlas.get(env, argv[0]) catch {
+        return error.invalid_argument_atlas;
+    };
+
+    const id = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_id;
+    };
+
+    const arg_position = core.Argument(core.Vector2).get(env, argv[2]) catch {
+        return error.invalid_argument_position;
+    };
+    defer arg_position.free();
+    const position = arg_position.data;
+
+    const arg_origin = core.Argument(core.Vector2).get(env, argv[3]) catch {
+        return error.invalid_argument_origin;
+    };
+    defer arg_origin.free();
+    const origin = arg_origin.data;
+
+    const rotation = core.Float.get(env, argv[4]) catch {
+        return error.invalid_argument_rotation;
+    };
+
+    const scale = core.Float.get(env, argv[5]) catch {
+        return error.invalid_argument_scale;
+    };
+
+    const arg_tint = core.Argument(core.Color).get(env, argv[6]) catch {
+        return error.invalid_argument_tint;
+    };
+    defer arg_tint.free();
+    const tint = arg_tint.data;
+
+    // Function
+
+    atlas.draw(id, position, origin, rotation, scale, tint) catch {
+        return error.invalid_argument_id;
+    };
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Draw many sprites of the atlas in one call, each sprite is {id, x, y, rotation, scale, tint}
+/// centered on (x, y) and rotated around its center
+///
+/// NOTE: The texture stays bound, the sprites go to the same rlgl batch
+fn nif_draw_sprites(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const atlas = core.SpriteAtlas.get(env, argv[0]) catch {
+        return error.invalid_argument_atlas;
+    };
+
+    // Function
+
+    var list = argv[1];
+    var head: e.ErlNifTerm = undefined;
+    while (e.enif_get_list_cell(env, list, &head, &list) != 0) {
+        const record = core.Tuple.get(env, head) catch {
+            return error.invalid_argument_sprites;
+        };
+        if (record.len != 6) return error.invalid_argument_sprites;
+
+        const id = core.UInt.get(env, record[0]) catch {
+            return error.invalid_argument_sprites;
+        };
+
+        const position = rl.Vector2{
+            .x = core.Float.get(env, record[1]) catch return error.invalid_argument_sprites,
+            .y = core.Float.get(env, record[2]) catch return error.invalid_argument_sprites,
+        };
+
+        const rotation = core.Float.get(env, record[3]) catch {
+            return error.invalid_argument_sprites;
+        };
+
+        const scale = core.Float.get(env, record[4]) catch {
+            return error.invalid_argument_sprites;
+        };
+
+        const arg_tint = core.Argument(core.Color).get(env, record[5]) catch {
+            return error.invalid_argument_sprites;
+        };
+        defer arg_tint.free();
+
+        const sprite = atlas.get_sprite(id) orelse return error.invalid_argument_sprites;
+        const origin = rl.Vector2{ .x = sprite.width * scale * 0.5, .y = sprite.height * scale * 0.5 };
+
+        try atlas.draw(id, position, origin, rotation, scale, arg_tint.data);
+    }
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
@@ -0,0 +1,223 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+
+const core = @import("../core.zig");
+const terrain = @import("../terrain.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Loading
+    .{ .name = "load_terrain", .arity = 6, .fptr = core.nif_wrapper(nif_load_terrain), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Drawing
+    .{ .name = "draw_terrain", .arity = 4, .fptr = core.nif_wrapper(nif_draw_terrain), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_terrain_stats", .arity = 1, .fptr = core.nif_wrapper(nif_get_terrain_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Queries
+    .{ .name = "get_terrain_height", .arity = 3, .fptr = core.nif_wrapper(nif_get_terrain_height), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_terrain_normal", .arity = 3, .fptr = core.nif_wrapper(nif_get_terrain_normal), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_terrain_normal", .arity = 4, .fptr = core.nif_wrapper(nif_get_terrain_normal), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+///////////////
+//  Loading  //
+///////////////
+
+/// Load a terrain from a heightmap split in chunks with several levels of detail, returns the terrain resource
+fn nif_load_terrain(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 6);
+
+    // Arguments
+
+    const arg_heightmap = core.Argument(core.Image).get(env, argv[0]) catch {
+        return error.invalid_argument_heightmap;
+    };
+    defer arg_heightmap.free();
+    const heightmap = arg_heightmap.data;
+
+    const arg_size = core.Argument(core.Vector3).get(env, argv[1]) catch {
+        return error.invalid_argument_size;
+    };
+    defer arg_size.free();
+    const size = arg_size.data;
+
+    const arg_position = core.Argument(core.Vector3).get(env, argv[2]) catch {
+        return error.invalid_argument_position;
+    };
+    defer arg_position.free();
+    const position = arg_position.data;
+
+    const chunk_size = core.UInt.get(env, argv[3]) catch {
+        return error.invalid_argument_chunk_size;
+    };
+
+    const lod_levels = core.UInt.get(env, argv[4]) catch {
+        return error.invalid_argument_lod_levels;
+    };
+
+    const skirt_depth = core.Float.get(env, argv[5]) catch {
+        return error.invalid_argument_skirt_depth;
+    };
+
+    // Function
+
+    const value = try terrain.LoadTerrain(heightmap, .{
+        .size = size,
+        .position = position,
+        .chunk_size = chunk_size,
+        .lod_levels = lod_levels,
+        .skirt_depth = skirt_depth,
+    });
+    errdefer {
+        terrain.UnloadTerrain(value);
+        value.deinit();
+    }
+
+    // Return
+
+    return core.Terrain.make(env, value) catch {
+        return error.invalid_return;
+    };
+}
+
+///////////////
+//  Drawing  //
+///////////////
+
+/// Draw the visible chunks of a terrain with a material (nil for the default one),
+/// the level of detail drops every time the distance to the camera doubles past lod_distance
+///
+/// NOTE: Must be called inside BeginMode3D() with the same camera
+fn nif_draw_terrain(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 4);
+
+    // Arguments
+
+    const value = core.Terrain.get(env, argv[0]) catch {
+        return error.invalid_argument_terrain;
+    };
+
+    const arg_camera = core.Argument(core.Camera3D).get(env, argv[1]) catch {
+        return error.invalid_argument_camera;
+    };
+    defer arg_camera.free();
+    const camera = arg_camera.data;
+
+    const lod_distance = core.Float.get(env, argv[3]) catch {
+        return error.invalid_argument_lod_distance;
+    };
+
+    // Function
+
+    if (e.enif_is_identical(core.Atom.make(env, "nil"), argv[2]) != 0) {
+        var maps = std.mem.zeroes([rl.MAX_MATERIAL_MAPS]rl.MaterialMap);
+        maps[rl.MATERIAL_MAP_DIFFUSE].texture.id = rl.rlGetTextureIdDefault();
+        maps[rl.MATERIAL_MAP_DIFFUSE].color = rl.Color{ .r = 255, .g = 255, .b = 255, .a = 255 };
+
+        const material = rl.Material{
+            .shader = .{ .id = rl.rlGetShaderIdDefault(), .locs = rl.rlGetShaderLocsDefault() },
+            .maps = &maps,
+            .params = .{ 0.0, 0.0, 0.0, 0.0 },
+        };
+
+        _ = value.draw(camera, material, lod_distance) catch |err| switch (err) {
+            error.terrain_unloaded => return error.invalid_argument_terrain,
+        };
+    } else {
+        const arg_material = core.Argument(core.Material).get(env, argv[2]) catch {
+            return error.invalid_argument_material;
+        };
+        defer arg_material.free();
+
+        _ = value.draw(camera, arg_material.data, lod_distance) catch |err| switch (err) {
+            error.terrain_unloaded => return error.invalid_argument_terrain,
+        };
+    }
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/// Get the terrain statistics of the last draw {chunks, drawn, culled, triangles}
+fn nif_get_terrain_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const value = core.Terrain.get(env, argv[0]) catch {
+        return error.invalid_argument_terrain;
+    };
+
+    // Return
+
+    const stats = value.stats;
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        core.UInt.make(env, stats.chunks),
+        core.UInt.make(env, stats.drawn),
+        core.UInt.make(env, stats.culled),
+        core.UInt.make(env, stats.triangles),
+    });
+}
+
+///////////////
+//  Queries  //
+///////////////
+
+/// Get the terrain height at a world position (x, z), on the full resolution surface
+fn nif_get_terrain_height(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3);
+
+    // Arguments
+
+    const value = core.Terrain.get(env, argv[0]) catch {
+        return error.invalid_argument_terrain;
+    };
+
+    const x = core.Float.get(env, argv[1]) catch {
+        return error.invalid_argument_x;
+    };
+
+    const z = core.Float.get(env, argv[2]) catch {
+        return error.invalid_argument_z;
+    };
+
+    // Return
+
+    return core.Float.make(env, value.get_height(x, z));
+}
+
+/// Get the terrain normal at a world position (x, z)
+fn nif_get_terrain_normal(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3 or argc == 4);
+
+    // Return type
+
+    const return_resource = core.must_return_resource(env, argc, argv, 3);
+
+    // Arguments
+
+    const value = core.Terrain.get(env, argv[0]) catch {
+        return error.invalid_argument_terrain;
+    };
+
+    const x = core.Float.get(env, argv[1]) catch {
+        return error.invalid_argument_x;
+    };
+
+    const z = core.Float.get(env, argv[2]) catch {
+        return error.invalid_argument_z;
+    };
+
+    // Function
+
+    const normal = value.get_normal(x, z);
+
+    // Return
+
+    return core.maybe_make_struct_as_resource(core.Vector3, env, normal, return_resource) catch {
+        return error.invalid_return;
+    };
+}
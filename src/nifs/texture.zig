@@ -4,6 +4,7 @@ const e = @import("../erl_nif.zig");
 const rl = @import("../raylib.zig");
 
 const core = @import("../core.zig");
+const texture_stream = @import("../texture_stream.zig");
 
 pub const exported_nifs = [_]e.ErlNifFunc{
     // Texture loading
@@ -20,6 +21,13 @@ pub const exported_nifs = [_]e.ErlNifFunc{
     .{ .name = "update_texture", .arity = 2, .fptr = core.nif_wrapper(nif_update_texture), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "update_texture_rec", .arity = 3, .fptr = core.nif_wrapper(nif_update_texture_rec), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
 
+    // Texture streaming
+    .{ .name = "load_texture_stream", .arity = 3, .fptr = core.nif_wrapper(nif_load_texture_stream), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "load_texture_stream", .arity = 4, .fptr = core.nif_wrapper(nif_load_texture_stream), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "update_texture_stream", .arity = 2, .fptr = core.nif_wrapper(nif_update_texture_stream), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_texture_stream_texture", .arity = 1, .fptr = core.nif_wrapper(nif_get_texture_stream_texture), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "get_texture_stream_stats", .arity = 1, .fptr = core.nif_wrapper(nif_get_texture_stream_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
     // Texture configuration
     .{ .name = "gen_texture_mipmaps", .arity = 1, .fptr = core.nif_wrapper(nif_gen_texture_mipmaps), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
     .{ .name = "gen_texture_mipmaps", .arity = 2, .fptr = core.nif_wrapper(nif_gen_texture_mipmaps), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
@@ -236,15 +244,17 @@ fn nif_update_texture(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifT
     defer arg_texture.free();
     const texture = arg_texture.data;
 
-    const arg_pixels = core.ArgumentBinary(core.Binary, rl.allocator).get(env, argv[1]) catch {
+    // Read in place, the texture is updated before returning
+    const pixels = core.Binary.get_view(env, argv[1]) catch {
         return error.invalid_argument_pixels;
     };
-    defer arg_pixels.free();
-    const pixels = arg_pixels.data;
+    if (pixels.len < core.Image.get_data_size(texture.width, texture.height, texture.format, 1)) {
+        return error.invalid_argument_pixels;
+    }
 
     // Function
 
-    rl.UpdateTexture(texture, @ptrCast(pixels));
+    rl.UpdateTexture(texture, @ptrCast(pixels.ptr));
 
     // Return
 
@@ -272,21 +282,169 @@ fn nif_update_texture_rec(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.Erl
     defer arg_rec.free();
     const rec = arg_rec.data;
 
-    const arg_pixels = core.ArgumentBinary(core.Binary, rl.allocator).get(env, argv[2]) catch {
+    // The rectangle must lie inside the texture (checked before any integer conversion)
+    if (!std.math.isFinite(rec.x) or !std.math.isFinite(rec.y) or !std.math.isFinite(rec.width) or !std.math.isFinite(rec.height)) {
+        return error.invalid_argument_rec;
+    }
+    if (rec.x < 0 or rec.y < 0 or rec.width < 0 or rec.height < 0) {
+        return error.invalid_argument_rec;
+    }
+    if (rec.x + rec.width > @as(f32, @floatFromInt(texture.width)) or rec.y + rec.height > @as(f32, @floatFromInt(texture.height))) {
+        return error.invalid_argument_rec;
+    }
+
+    // Read in place, the texture is updated before returning
+    const pixels = core.Binary.get_view(env, argv[2]) catch {
         return error.invalid_argument_pixels;
     };
-    defer arg_pixels.free();
-    const pixels = arg_pixels.data;
+    if (pixels.len < core.Image.get_data_size(@intFromFloat(rec.width), @intFromFloat(rec.height), texture.format, 1)) {
+        return error.invalid_argument_pixels;
+    }
 
     // Function
 
-    rl.UpdateTextureRec(texture, rec, @ptrCast(pixels));
+    rl.UpdateTextureRec(texture, rec, @ptrCast(pixels.ptr));
 
     // Return
 
     return core.Atom.make(env, "ok");
 }
 
+/////////////////////////
+//  Texture streaming  //
+/////////////////////////
+
+/// Load a texture updated every frame through a ring of pixel buffers (3 by default, up to 8)
+///
+/// The frames are written straight into a persistently mapped pixel buffer (OpenGL 4.4 or ARB_buffer_storage),
+/// or a buffer mapped on each update (OpenGL 3.3 or ES 3.0), and copied to the texture asynchronously.
+/// Without pixel buffers (other OpenGL versions and platforms) the texture is updated synchronously.
+fn nif_load_texture_stream(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 3 or argc == 4);
+
+    // Arguments
+
+    const width = core.Int.get(env, argv[0]) catch {
+        return error.invalid_argument_width;
+    };
+
+    const height = core.Int.get(env, argv[1]) catch {
+        return error.invalid_argument_height;
+    };
+
+    const format = core.Int.get(env, argv[2]) catch {
+        return error.invalid_argument_format;
+    };
+
+    var buffers: usize = texture_stream.TEXTURE_STREAM_DEFAULT_BUFFERS;
+    if (argc == 4) {
+        buffers = core.UInt.get(env, argv[3]) catch {
+            return error.invalid_argument_buffers;
+        };
+        if (buffers < 1 or buffers > texture_stream.TEXTURE_STREAM_MAX_BUFFERS) {
+            return error.invalid_argument_buffers;
+        }
+    }
+
+    // Function
+
+    const value = texture_stream.LoadTextureStream(width, height, format, buffers) catch |err| switch (err) {
+        error.OutOfMemory => return err,
+        error.invalid_texture_stream => return error.invalid_argument_format,
+        else => return error.runtime_failed_to_load_texture_stream,
+    };
+    errdefer {
+        texture_stream.UnloadTextureStream(value);
+        value.deinit();
+    }
+
+    // Return
+
+    return core.TextureStream.make(env, value) catch {
+        return error.invalid_return;
+    };
+}
+
+/// Upload a frame to the texture stream, returns false if the frame was dropped (all the pixel buffers in use)
+///
+/// NOTE: The pixels are copied once, straight from the binary into the pixel buffer
+fn nif_update_texture_stream(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const stream = core.TextureStream.get(env, argv[0]) catch {
+        return error.invalid_argument_stream;
+    };
+
+    const pixels = core.Binary.get_view(env, argv[1]) catch {
+        return error.invalid_argument_pixels;
+    };
+    if (pixels.len < stream.frame_size) {
+        return error.invalid_argument_pixels;
+    }
+
+    // Function
+
+    const uploaded = stream.update(pixels) catch |err| switch (err) {
+        error.texture_stream_unloaded => return error.invalid_argument_stream,
+        else => return error.runtime_failed_to_update_texture_stream,
+    };
+
+    // Return
+
+    return core.Boolean.make(env, uploaded);
+}
+
+/// Get the texture of the texture stream (owned by the stream, it must not be unloaded)
+///
+/// NOTE: The texture is a copy of the stream texture, it dangles once the stream is freed
+fn nif_get_texture_stream_texture(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const stream = core.TextureStream.get(env, argv[0]) catch {
+        return error.invalid_argument_stream;
+    };
+
+    // Function
+
+    const texture = stream.get_texture();
+    if (texture.id == 0) return error.invalid_argument_stream;
+
+    // Return
+
+    return core.Texture2D.make(env, texture);
+}
+
+/// Get the texture stream statistics: {mode, uploaded, dropped, last latency (us), average latency (us)}
+///
+/// The latency goes from the write into the pixel buffer until the GPU copied it to the texture
+fn nif_get_texture_stream_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const stream = core.TextureStream.get(env, argv[0]) catch {
+        return error.invalid_argument_stream;
+    };
+
+    // Function
+
+    const stats = stream.get_stats();
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        core.Atom.make(env, @tagName(stream.get_mode())),
+        e.enif_make_uint64(env, stats.uploaded),
+        e.enif_make_uint64(env, stats.dropped),
+        e.enif_make_uint64(env, stats.latency_last_us),
+        e.enif_make_uint64(env, stats.latency_average_us()),
+    });
+}
+
 /////////////////////////////
 //  Texture configuration  //
 /////////////////////////////
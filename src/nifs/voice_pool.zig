@@ -0,0 +1,221 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("../erl_nif.zig");
+const rl = @import("../raylib.zig");
+
+const core = @import("../core.zig");
+const voice_pool = @import("../voice_pool.zig");
+
+pub const exported_nifs = [_]e.ErlNifFunc{
+    // Loading
+    .{ .name = "load_voice_pool", .arity = 2, .fptr = core.nif_wrapper(nif_load_voice_pool), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Playing
+    .{ .name = "play_voice", .arity = 6, .fptr = core.nif_wrapper(nif_play_voice), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "play_voice_3d", .arity = 6, .fptr = core.nif_wrapper(nif_play_voice_3d), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "stop_voice_pool", .arity = 1, .fptr = core.nif_wrapper(nif_stop_voice_pool), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+
+    // Stats
+    .{ .name = "get_voice_pool_stats", .arity = 1, .fptr = core.nif_wrapper(nif_get_voice_pool_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+    .{ .name = "reset_voice_pool_stats", .arity = 1, .fptr = core.nif_wrapper(nif_reset_voice_pool_stats), .flags = e.ERL_NIF_DIRTY_JOB_CPU_BOUND },
+};
+
+///////////////
+//  Loading  //
+///////////////
+
+/// Load a pool of voices created as aliases of a sound, returns the voice pool resource
+fn nif_load_voice_pool(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 2);
+
+    // Arguments
+
+    const arg_sound = core.Argument(core.Sound).get(env, argv[0]) catch {
+        return error.invalid_argument_sound;
+    };
+    defer arg_sound.free();
+    const sound = arg_sound.data;
+    const source = if (arg_sound.keep) core.Sound.Resource.get(env, argv[0]) catch null else null;
+
+    const voices = core.UInt.get(env, argv[1]) catch {
+        return error.invalid_argument_voices;
+    };
+
+    // Function
+
+    const pool = try voice_pool.LoadVoicePool(sound, source, voices);
+    errdefer {
+        voice_pool.UnloadVoicePool(pool);
+        pool.deinit();
+    }
+
+    // Return
+
+    return core.VoicePool.make(env, pool) catch {
+        return error.invalid_return;
+    };
+}
+
+///////////////
+//  Playing  //
+///////////////
+
+fn make_voice(env: ?*e.ErlNifEnv, voice: ?usize) e.ErlNifTerm {
+    return if (voice) |index| e.enif_make_uint64(env, index) else core.Atom.make(env, "nil");
+}
+
+/// Play a sound on a voice of the pool, returns the voice index or nil when dropped
+///
+/// NOTE: Never allocates, an idle voice is used or a voice of the same or a lower priority is stolen (the oldest first)
+fn nif_play_voice(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 6);
+
+    // Arguments
+
+    const pool = core.VoicePool.get(env, argv[0]) catch {
+        return error.invalid_argument_pool;
+    };
+
+    const arg_sound = core.Argument(core.Sound).get(env, argv[1]) catch {
+        return error.invalid_argument_sound;
+    };
+    defer arg_sound.free();
+    const sound = arg_sound.data;
+    const source = if (arg_sound.keep) core.Sound.Resource.get(env, argv[1]) catch null else null;
+
+    const volume = core.Float.get(env, argv[2]) catch {
+        return error.invalid_argument_volume;
+    };
+
+    const pitch = core.Float.get(env, argv[3]) catch {
+        return error.invalid_argument_pitch;
+    };
+
+    const pan = core.Float.get(env, argv[4]) catch {
+        return error.invalid_argument_pan;
+    };
+
+    const priority = core.Int.get(env, argv[5]) catch {
+        return error.invalid_argument_priority;
+    };
+
+    // Function
+
+    const voice = try pool.play(sound, source, .{ .volume = volume, .pitch = pitch, .pan = pan, .priority = priority });
+
+    // Return
+
+    return make_voice(env, voice);
+}
+
+/// Play a sound at a position on a voice of the pool, attenuated and panned for the audio 3D mode listener
+fn nif_play_voice_3d(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 6);
+
+    // Arguments
+
+    const pool = core.VoicePool.get(env, argv[0]) catch {
+        return error.invalid_argument_pool;
+    };
+
+    const arg_sound = core.Argument(core.Sound).get(env, argv[1]) catch {
+        return error.invalid_argument_sound;
+    };
+    defer arg_sound.free();
+    const sound = arg_sound.data;
+    const source = if (arg_sound.keep) core.Sound.Resource.get(env, argv[1]) catch null else null;
+
+    const arg_position = core.Argument(core.Vector3).get(env, argv[2]) catch {
+        return error.invalid_argument_position;
+    };
+    defer arg_position.free();
+    const position = arg_position.data;
+
+    const volume = core.Float.get(env, argv[3]) catch {
+        return error.invalid_argument_volume;
+    };
+
+    const pitch = core.Float.get(env, argv[4]) catch {
+        return error.invalid_argument_pitch;
+    };
+
+    const priority = core.Int.get(env, argv[5]) catch {
+        return error.invalid_argument_priority;
+    };
+
+    // Function
+
+    const voice = try pool.play_3d(sound, source, position, .{ .volume = volume, .pitch = pitch, .priority = priority });
+
+    // Return
+
+    return make_voice(env, voice);
+}
+
+/// Stop all the voices of the pool
+fn nif_stop_voice_pool(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const pool = core.VoicePool.get(env, argv[0]) catch {
+        return error.invalid_argument_pool;
+    };
+
+    // Function
+
+    pool.stop();
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
+
+/////////////
+//  Stats  //
+/////////////
+
+/// Get the voice pool counters, returns {voices, active, played, stolen, dropped, culled}
+fn nif_get_voice_pool_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const pool = core.VoicePool.get(env, argv[0]) catch {
+        return error.invalid_argument_pool;
+    };
+
+    // Function
+
+    const stats = pool.get_stats();
+
+    // Return
+
+    return core.Tuple.make(env, &[_]e.ErlNifTerm{
+        e.enif_make_uint64(env, stats.voices),
+        e.enif_make_uint64(env, stats.active),
+        e.enif_make_uint64(env, stats.played),
+        e.enif_make_uint64(env, stats.stolen),
+        e.enif_make_uint64(env, stats.dropped),
+        e.enif_make_uint64(env, stats.culled),
+    });
+}
+
+/// Restart the played, stolen, dropped and culled counters
+fn nif_reset_voice_pool_stats(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTerm) !e.ErlNifTerm {
+    assert(argc == 1);
+
+    // Arguments
+
+    const pool = core.VoicePool.get(env, argv[0]) catch {
+        return error.invalid_argument_pool;
+    };
+
+    // Function
+
+    pool.reset_stats();
+
+    // Return
+
+    return core.Atom.make(env, "ok");
+}
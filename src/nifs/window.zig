@@ -4,6 +4,7 @@ const e = @import("../erl_nif.zig");
 const rl = @import("../raylib.zig");
 
 const core = @import("../core.zig");
+const reclaim = @import("../reclaim.zig");
 
 pub const exported_nifs = [_]e.ErlNifFunc{
     // Window
@@ -100,8 +101,14 @@ fn nif_close_window(env: ?*e.ErlNifEnv, argc: c_int, argv: [*c]const e.ErlNifTer
 
     // Function
 
+    // GL payloads of garbage collected resources, the context is still current
+    _ = reclaim.flush_gpu();
+
     rl.CloseWindow();
 
+    // GL payloads queued meanwhile or later belong to a destroyed context
+    reclaim.close_context();
+
     // Return
 
     return core.Atom.make(env, "ok");
@@ -0,0 +1,521 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+const workers = @import("./workers.zig");
+
+pub const allocator = rl.allocator;
+
+/// Points evaluated per vector step
+const lanes = 8;
+
+/// Minimum points per chunk of work sent to the worker pool
+const points_per_chunk = 16 * 1024;
+
+const F = @Vector(lanes, f32);
+const I = @Vector(lanes, i32);
+const U = @Vector(lanes, u32);
+
+//////////////
+//  Params  //
+//////////////
+
+pub const Kind = enum(u8) {
+    perlin,
+    simplex,
+    value,
+    /// Distance to the nearest feature point (Worley F1)
+    cellular,
+};
+
+pub const Fractal = enum(u8) {
+    none,
+    fbm,
+    ridged,
+    turbulence,
+};
+
+pub const max_octaves = 16;
+
+/// Noise evaluated at (position + offset) * frequency, the position is in pixels
+pub const Params = struct {
+    kind: Kind = .perlin,
+    fractal: Fractal = .none,
+    /// 2 or 3, a 2D field with 3 dimensions is a slice of 3D noise at offset z
+    dimensions: u8 = 2,
+    seed: u32 = 0,
+    frequency: f32 = 1.0 / 32.0,
+    /// Fractal octaves (1 to max_octaves), each one with frequency * lacunarity and amplitude * gain
+    octaves: u8 = 4,
+    lacunarity: f32 = 2.0,
+    gain: f32 = 0.5,
+    /// Domain warping: the position is displaced by warp_amplitude pixels of noise at warp_frequency
+    warp_amplitude: f32 = 0.0,
+    warp_frequency: f32 = 1.0 / 64.0,
+    offset: [3]f32 = .{ 0.0, 0.0, 0.0 },
+};
+
+/////////////
+//  Utils  //
+/////////////
+
+fn splat(value: f32) F {
+    return @splat(value);
+}
+
+fn splat_i(value: i32) I {
+    return @splat(value);
+}
+
+fn splat_u(value: u32) U {
+    return @splat(value);
+}
+
+fn shr(value: U, comptime bits: u5) U {
+    return value >> @as(@Vector(lanes, u5), @splat(bits));
+}
+
+/// Integer lattice hash, the same cell always gets the same value for a seed
+fn hash(seed: u32, x: I, y: I, z: I) U {
+    var h: U = @splat(seed);
+    h ^= @as(U, @bitCast(x)) *% splat_u(0x27d4eb2d);
+    h ^= @as(U, @bitCast(y)) *% splat_u(0x165667b1);
+    h ^= @as(U, @bitCast(z)) *% splat_u(0x9e3779b1);
+    h ^= shr(h, 15);
+    h *%= splat_u(0x2c1b3c6d);
+    h ^= shr(h, 12);
+    h *%= splat_u(0x297a2d39);
+    h ^= shr(h, 15);
+    return h;
+}
+
+/// Bits of a hash as a value in [0, 1)
+fn unit(bits: U, comptime count: u5) F {
+    const mask = splat_u((@as(u32, 1) << count) - 1);
+    return @as(F, @floatFromInt(bits & mask)) * splat(1.0 / @as(f32, @floatFromInt(@as(u32, 1) << count)));
+}
+
+/// Dot product with one of the 12 edge gradients of a cube (improved Perlin noise)
+fn grad(h: U, x: F, y: F, z: F) F {
+    const b = h & splat_u(15);
+    const u = @select(f32, b < splat_u(8), x, y);
+    const v = @select(f32, b < splat_u(4), y, @select(f32, (b & splat_u(13)) == splat_u(12), x, z));
+    return @select(f32, (b & splat_u(1)) == splat_u(0), u, -u) + @select(f32, (b & splat_u(2)) == splat_u(0), v, -v);
+}
+
+fn fade(t: F) F {
+    return t * t * t * (t * (t * splat(6.0) - splat(15.0)) + splat(10.0));
+}
+
+fn lerp(a: F, b: F, t: F) F {
+    return a + (b - a) * t;
+}
+
+fn select01(condition: @Vector(lanes, bool)) F {
+    return @select(f32, condition, splat(1.0), splat(0.0));
+}
+
+///////////////
+//  Kernels  //
+///////////////
+
+/// Largest f32 below 2^31
+const lattice_max = 2147483520.0;
+
+/// Integer lattice coordinate of a floored value, clamped to the i32 range (NaN goes to the lower bound)
+///
+/// NOTE: f32 has no fractional part left long before the bounds, the noise is flat out there anyway
+fn lattice(floor: F) I {
+    return @intFromFloat(@min(@max(floor, splat(-lattice_max)), splat(lattice_max)));
+}
+
+/// Lattice cell of a coordinate and the position inside it
+const Cell = struct {
+    i: I,
+    f: F,
+
+    fn of(value: F) Cell {
+        const floor = @floor(value);
+        return .{ .i = lattice(floor), .f = value - floor };
+    }
+};
+
+fn perlin2(seed: u32, x: F, y: F) F {
+    const cx = Cell.of(x);
+    const cy = Cell.of(y);
+    const z = splat_i(0);
+    const zf = splat(0.0);
+    const x1 = cx.i +% splat_i(1);
+    const y1 = cy.i +% splat_i(1);
+    const one = splat(1.0);
+
+    const n00 = grad(hash(seed, cx.i, cy.i, z), cx.f, cy.f, zf);
+    const n10 = grad(hash(seed, x1, cy.i, z), cx.f - one, cy.f, zf);
+    const n01 = grad(hash(seed, cx.i, y1, z), cx.f, cy.f - one, zf);
+    const n11 = grad(hash(seed, x1, y1, z), cx.f - one, cy.f - one, zf);
+
+    const u = fade(cx.f);
+    return lerp(lerp(n00, n10, u), lerp(n01, n11, u), fade(cy.f));
+}
+
+fn perlin3(seed: u32, x: F, y: F, z: F) F {
+    const cx = Cell.of(x);
+    const cy = Cell.of(y);
+    const cz = Cell.of(z);
+    const x1 = cx.i +% splat_i(1);
+    const y1 = cy.i +% splat_i(1);
+    const z1 = cz.i +% splat_i(1);
+    const one = splat(1.0);
+
+    const n000 = grad(hash(seed, cx.i, cy.i, cz.i), cx.f, cy.f, cz.f);
+    const n100 = grad(hash(seed, x1, cy.i, cz.i), cx.f - one, cy.f, cz.f);
+    const n010 = grad(hash(seed, cx.i, y1, cz.i), cx.f, cy.f - one, cz.f);
+    const n110 = grad(hash(seed, x1, y1, cz.i), cx.f - one, cy.f - one, cz.f);
+    const n001 = grad(hash(seed, cx.i, cy.i, z1), cx.f, cy.f, cz.f - one);
+    const n101 = grad(hash(seed, x1, cy.i, z1), cx.f - one, cy.f, cz.f - one);
+    const n011 = grad(hash(seed, cx.i, y1, z1), cx.f, cy.f - one, cz.f - one);
+    const n111 = grad(hash(seed, x1, y1, z1), cx.f - one, cy.f - one, cz.f - one);
+
+    const u = fade(cx.f);
+    const v = fade(cy.f);
+    return lerp(
+        lerp(lerp(n000, n100, u), lerp(n010, n110, u), v),
+        lerp(lerp(n001, n101, u), lerp(n011, n111, u), v),
+        fade(cz.f),
+    );
+}
+
+fn value_at(seed: u32, x: I, y: I, z: I) F {
+    return unit(shr(hash(seed, x, y, z), 8), 24) * splat(2.0) - splat(1.0);
+}
+
+fn value2(seed: u32, x: F, y: F) F {
+    const cx = Cell.of(x);
+    const cy = Cell.of(y);
+    const z = splat_i(0);
+    const x1 = cx.i +% splat_i(1);
+    const y1 = cy.i +% splat_i(1);
+
+    const u = fade(cx.f);
+    return lerp(
+        lerp(value_at(seed, cx.i, cy.i, z), value_at(seed, x1, cy.i, z), u),
+        lerp(value_at(seed, cx.i, y1, z), value_at(seed, x1, y1, z), u),
+        fade(cy.f),
+    );
+}
+
+fn value3(seed: u32, x: F, y: F, z: F) F {
+    const cx = Cell.of(x);
+    const cy = Cell.of(y);
+    const cz = Cell.of(z);
+    const x1 = cx.i +% splat_i(1);
+    const y1 = cy.i +% splat_i(1);
+    const z1 = cz.i +% splat_i(1);
+
+    const u = fade(cx.f);
+    const v = fade(cy.f);
+    return lerp(
+        lerp(
+            lerp(value_at(seed, cx.i, cy.i, cz.i), value_at(seed, x1, cy.i, cz.i), u),
+            lerp(value_at(seed, cx.i, y1, cz.i), value_at(seed, x1, y1, cz.i), u),
+            v,
+        ),
+        lerp(
+            lerp(value_at(seed, cx.i, cy.i, z1), value_at(seed, x1, cy.i, z1), u),
+            lerp(value_at(seed, cx.i, y1, z1), value_at(seed, x1, y1, z1), u),
+            v,
+        ),
+        fade(cz.f),
+    );
+}
+
+fn simplex_corner(h: U, x: F, y: F, z: F, comptime radius: f32) F {
+    const t = @max(splat(radius) - x * x - y * y - z * z, splat(0.0));
+    const t2 = t * t;
+    return t2 * t2 * grad(h, x, y, z);
+}
+
+fn simplex2(seed: u32, x: F, y: F) F {
+    const f2 = 0.36602540378443865; // (sqrt(3) - 1) / 2
+    const g2 = 0.21132486540518713; // (3 - sqrt(3)) / 6
+
+    const s = (x + y) * splat(f2);
+    const i = @floor(x + s);
+    const j = @floor(y + s);
+    const t = (i + j) * splat(g2);
+    const x0 = x - (i - t);
+    const y0 = y - (j - t);
+
+    // Lower or upper triangle of the skewed cell
+    const i1 = select01(x0 > y0);
+    const j1 = splat(1.0) - i1;
+
+    const x1 = x0 - i1 + splat(g2);
+    const y1 = y0 - j1 + splat(g2);
+    const x2 = x0 - splat(1.0 - 2.0 * g2);
+    const y2 = y0 - splat(1.0 - 2.0 * g2);
+
+    const ii = lattice(i);
+    const jj = lattice(j);
+    const z = splat_i(0);
+    const zf = splat(0.0);
+
+    const n0 = simplex_corner(hash(seed, ii, jj, z), x0, y0, zf, 0.5);
+    const n1 = simplex_corner(hash(seed, ii +% @as(I, @intFromFloat(i1)), jj +% @as(I, @intFromFloat(j1)), z), x1, y1, zf, 0.5);
+    const n2 = simplex_corner(hash(seed, ii +% splat_i(1), jj +% splat_i(1), z), x2, y2, zf, 0.5);
+
+    return splat(70.0) * (n0 + n1 + n2);
+}
+
+fn simplex3(seed: u32, x: F, y: F, z: F) F {
+    const f3 = 1.0 / 3.0;
+    const g3 = 1.0 / 6.0;
+
+    const s = (x + y + z) * splat(f3);
+    const i = @floor(x + s);
+    const j = @floor(y + s);
+    const k = @floor(z + s);
+    const t = (i + j + k) * splat(g3);
+    const x0 = x - (i - t);
+    const y0 = y - (j - t);
+    const z0 = z - (k - t);
+
+    // Rank of each coordinate (0 to 2, each comparison gives one point) selects the simplex
+    const rank_x = select01(x0 > y0) + select01(x0 > z0);
+    const rank_y = select01(y0 >= x0) + select01(y0 > z0);
+    const rank_z = select01(z0 >= x0) + select01(z0 >= y0);
+
+    const i1 = select01(rank_x >= splat(2.0));
+    const j1 = select01(rank_y >= splat(2.0));
+    const k1 = select01(rank_z >= splat(2.0));
+    const i2 = select01(rank_x >= splat(1.0));
+    const j2 = select01(rank_y >= splat(1.0));
+    const k2 = select01(rank_z >= splat(1.0));
+
+    const ii = lattice(i);
+    const jj = lattice(j);
+    const kk = lattice(k);
+
+    const n0 = simplex_corner(hash(seed, ii, jj, kk), x0, y0, z0, 0.6);
+    const n1 = simplex_corner(
+        hash(seed, ii +% @as(I, @intFromFloat(i1)), jj +% @as(I, @intFromFloat(j1)), kk +% @as(I, @intFromFloat(k1))),
+        x0 - i1 + splat(g3),
+        y0 - j1 + splat(g3),
+        z0 - k1 + splat(g3),
+        0.6,
+    );
+    const n2 = simplex_corner(
+        hash(seed, ii +% @as(I, @intFromFloat(i2)), jj +% @as(I, @intFromFloat(j2)), kk +% @as(I, @intFromFloat(k2))),
+        x0 - i2 + splat(2.0 * g3),
+        y0 - j2 + splat(2.0 * g3),
+        z0 - k2 + splat(2.0 * g3),
+        0.6,
+    );
+    const n3 = simplex_corner(
+        hash(seed, ii +% splat_i(1), jj +% splat_i(1), kk +% splat_i(1)),
+        x0 - splat(1.0 - 3.0 * g3),
+        y0 - splat(1.0 - 3.0 * g3),
+        z0 - splat(1.0 - 3.0 * g3),
+        0.6,
+    );
+
+    return splat(32.0) * (n0 + n1 + n2 + n3);
+}
+
+const offsets = [_]i32{ -1, 0, 1 };
+
+/// Distance to the nearest feature point (one jittered point per cell) mapped from [0, 1] to [-1, 1]
+fn cellular2(seed: u32, x: F, y: F) F {
+    const cx = Cell.of(x);
+    const cy = Cell.of(y);
+    const z = splat_i(0);
+
+    var nearest = splat(2.0);
+    inline for (offsets) |dy| {
+        inline for (offsets) |dx| {
+            const h = hash(seed, cx.i +% splat_i(dx), cy.i +% splat_i(dy), z);
+            const px = splat(@floatFromInt(dx)) + unit(h, 16) - cx.f;
+            const py = splat(@floatFromInt(dy)) + unit(shr(h, 16), 16) - cy.f;
+            nearest = @min(nearest, px * px + py * py);
+        }
+    }
+
+    return @min(@sqrt(nearest), splat(1.0)) * splat(2.0) - splat(1.0);
+}
+
+fn cellular3(seed: u32, x: F, y: F, z: F) F {
+    const cx = Cell.of(x);
+    const cy = Cell.of(y);
+    const cz = Cell.of(z);
+
+    var nearest = splat(3.0);
+    inline for (offsets) |dz| {
+        inline for (offsets) |dy| {
+            inline for (offsets) |dx| {
+                const h = hash(seed, cx.i +% splat_i(dx), cy.i +% splat_i(dy), cz.i +% splat_i(dz));
+                const px = splat(@floatFromInt(dx)) + unit(h, 10) - cx.f;
+                const py = splat(@floatFromInt(dy)) + unit(shr(h, 10), 10) - cy.f;
+                const pz = splat(@floatFromInt(dz)) + unit(shr(h, 20), 10) - cz.f;
+                nearest = @min(nearest, px * px + py * py + pz * pz);
+            }
+        }
+    }
+
+    return @min(@sqrt(nearest), splat(1.0)) * splat(2.0) - splat(1.0);
+}
+
+/////////////////
+//  Combiners  //
+/////////////////
+
+fn sample(params: *const Params, seed: u32, x: F, y: F, z: F) F {
+    if (params.dimensions == 3) {
+        return switch (params.kind) {
+            .perlin => perlin3(seed, x, y, z),
+            .simplex => simplex3(seed, x, y, z),
+            .value => value3(seed, x, y, z),
+            .cellular => cellular3(seed, x, y, z),
+        };
+    }
+
+    return switch (params.kind) {
+        .perlin => perlin2(seed, x, y),
+        .simplex => simplex2(seed, x, y),
+        .value => value2(seed, x, y),
+        .cellular => cellular2(seed, x, y),
+    };
+}
+
+/// Octaves of noise combined, normalized to [-1, 1]
+fn fractal(params: *const Params, x: F, y: F, z: F) F {
+    if (params.fractal == .none) return sample(params, params.seed, x, y, z);
+
+    var sum = splat(0.0);
+    var amplitude: f32 = 1.0;
+    var total: f32 = 0.0;
+    var frequency: f32 = 1.0;
+
+    for (0..params.octaves) |octave| {
+        const seed = params.seed +% @as(u32, @intCast(octave));
+        const n = sample(params, seed, x * splat(frequency), y * splat(frequency), z * splat(frequency));
+
+        const value = switch (params.fractal) {
+            .none, .fbm => n,
+            .ridged => blk: {
+                const ridge = splat(1.0) - @abs(n);
+                break :blk ridge * ridge;
+            },
+            .turbulence => @abs(n),
+        };
+
+        sum += value * splat(amplitude);
+        total += amplitude;
+        amplitude *= params.gain;
+        frequency *= params.lacunarity;
+    }
+
+    if (total > 0.0) sum /= splat(total);
+
+    // Ridged and turbulence sums are in [0, 1]
+    return if (params.fractal == .fbm) sum else sum * splat(2.0) - splat(1.0);
+}
+
+/// Noise at positions in pixels (before offset and frequency), clamped to [-1, 1]
+fn evaluate(params: *const Params, x: F, y: F, z: F) F {
+    var px = x + splat(params.offset[0]);
+    var py = y + splat(params.offset[1]);
+    var pz = z + splat(params.offset[2]);
+
+    if (params.warp_amplitude != 0.0) {
+        const wf = splat(params.warp_frequency);
+        const wx = px * wf;
+        const wy = py * wf;
+        const wz = pz * wf;
+        const amplitude = splat(params.warp_amplitude);
+
+        px += amplitude * sample(params, params.seed +% 0x9e3779b9, wx, wy, wz);
+        py += amplitude * sample(params, params.seed +% 0x7f4a7c15, wx, wy, wz);
+        if (params.dimensions == 3) pz += amplitude * sample(params, params.seed +% 0x3c6ef372, wx, wy, wz);
+    }
+
+    const frequency = splat(params.frequency);
+    const n = fractal(params, px * frequency, py * frequency, pz * frequency);
+    return @min(@max(n, splat(-1.0)), splat(1.0));
+}
+
+/////////////
+//  Field  //
+/////////////
+
+/// Grid evaluated row by row across the worker pool, x varies fastest then y then z
+const FieldJob = struct {
+    params: *const Params,
+    width: usize,
+    height: usize,
+    /// Packed f32 values in [-1, 1]
+    values: ?[*]align(1) f32 = null,
+    /// 8 bit grayscale pixels
+    pixels: ?[*]u8 = null,
+
+    fn run(job: *const FieldJob, start: usize, end: usize) void {
+        const iota = std.simd.iota(f32, lanes);
+
+        for (start..end) |row| {
+            const y = splat(@floatFromInt(row % job.height));
+            const z = splat(@floatFromInt(row / job.height));
+            const base = row * job.width;
+
+            var x: usize = 0;
+            while (x < job.width) : (x += lanes) {
+                const n = evaluate(job.params, splat(@floatFromInt(x)) + iota, y, z);
+                const count = @min(lanes, job.width - x);
+
+                if (job.values) |values| {
+                    const out: [lanes]f32 = n;
+                    @memcpy(values[base + x ..][0..count], out[0..count]);
+                }
+
+                if (job.pixels) |pixels| {
+                    const gray: @Vector(lanes, u8) = @intFromFloat(@min(@max((n * splat(0.5) + splat(0.5)) * splat(255.0) + splat(0.5), splat(0.0)), splat(255.0)));
+                    const out: [lanes]u8 = gray;
+                    @memcpy(pixels[base + x ..][0..count], out[0..count]);
+                }
+            }
+        }
+    }
+};
+
+fn fill(job: *const FieldJob, rows: usize) void {
+    workers.parallel_for(rows, @max(points_per_chunk / @max(job.width, 1), 1), job, FieldJob.run);
+}
+
+/// Evaluate a width x height x depth field into packed f32 values in [-1, 1]
+///
+/// NOTE: Fields with a depth greater than 1 use 3D noise
+pub fn fill_values(params: Params, width: usize, height: usize, depth: usize, values: []align(1) f32) void {
+    std.debug.assert(values.len == width * height * depth);
+
+    var field_params = params;
+    if (depth > 1) field_params.dimensions = 3;
+
+    const job = FieldJob{ .params = &field_params, .width = width, .height = height, .values = values.ptr };
+    fill(&job, height * depth);
+}
+
+/// Generate a grayscale image, black at -1 and white at 1
+///
+/// Returns error.invalid_size when the image does not fit in a raylib allocation
+pub fn gen_image(params: Params, width: usize, height: usize) !rl.Image {
+    const size = std.math.mul(usize, width, height) catch return error.invalid_size;
+    const data_size = std.math.cast(c_uint, size) orelse return error.invalid_size;
+    const data: [*]u8 = @ptrCast(rl.MemAlloc(data_size) orelse return error.OutOfMemory);
+
+    const job = FieldJob{ .params = &params, .width = width, .height = height, .pixels = data };
+    fill(&job, height);
+
+    return .{
+        .data = data,
+        .width = @intCast(width),
+        .height = @intCast(height),
+        .mipmaps = 1,
+        .format = rl.PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,
+    };
+}
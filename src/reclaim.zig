@@ -0,0 +1,151 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+const utils = @import("./utils.zig");
+
+pub const allocator = rl.allocator;
+
+//////////////////
+//  Reclaiming  //
+//////////////////
+
+/// Where the payload of a garbage collected resource can be released
+pub const Kind = enum(u8) {
+    /// GL objects, released on the thread drawing (end_drawing, close_window)
+    gpu,
+    /// Native memory only, released by a time budgeted flush
+    cpu,
+};
+
+/// Reclaim payloads of garbage collected resources (free_resource is still needed for immediate release)
+pub var enabled = std.atomic.Value(bool).init(true);
+
+/// Time spent releasing CPU payloads at the end of each frame
+pub var frame_budget_us = std.atomic.Value(u32).init(1000);
+
+/// GL context the GL payloads belong to, changed when the window is closed
+///
+/// The ids of a destroyed context may be reused by the next one, payloads of an
+/// older context are discarded (only their CPU side is freed)
+pub var context = std.atomic.Value(u32).init(0);
+
+const Node = struct {
+    next: ?*Node = null,
+    payload: *anyopaque,
+    release: *const fn (*anyopaque) void,
+    discard: *const fn (*anyopaque) void,
+    context: u32,
+};
+
+/// Lock-free stack pushed by the resource destructors (any thread), drained by a single thread at a time
+const Queue = struct {
+    head: std.atomic.Value(?*Node) = std.atomic.Value(?*Node).init(null),
+    pending: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+    reclaimed: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+
+    // Nodes taken from head and not released yet, owned by the thread holding drain_mutex
+    backlog: ?*Node = null,
+    drain_mutex: std.Thread.Mutex = .{},
+
+    fn push(self: *Queue, node: *Node) void {
+        _ = self.pending.fetchAdd(1, .monotonic);
+
+        var head = self.head.load(.monotonic);
+        while (true) {
+            node.next = head;
+            head = self.head.cmpxchgWeak(head, node, .release, .monotonic) orelse return;
+        }
+    }
+
+    /// Release the pending payloads until the deadline (nanoTimestamp), returns the number released
+    ///
+    /// Payloads of another GL context than current_context are discarded instead
+    fn drain(self: *Queue, deadline: ?i128, current_context: ?u32) usize {
+        // Another thread is draining, it will take the new nodes too
+        if (!self.drain_mutex.tryLock()) return 0;
+        defer self.drain_mutex.unlock();
+
+        // Oldest first: reverse the pushed nodes after the backlog
+        var pushed = self.head.swap(null, .acquire);
+        var reversed: ?*Node = null;
+        while (pushed) |node| {
+            pushed = node.next;
+            node.next = reversed;
+            reversed = node;
+        }
+
+        if (self.backlog) |backlog| {
+            var tail = backlog;
+            while (tail.next) |next| tail = next;
+            tail.next = reversed;
+        } else {
+            self.backlog = reversed;
+        }
+
+        var released: usize = 0;
+        while (self.backlog) |node| {
+            if (deadline) |d| {
+                if (released > 0 and std.time.nanoTimestamp() >= d) break;
+            }
+
+            self.backlog = node.next;
+            if (current_context == null or current_context.? == node.context) {
+                node.release(node.payload);
+            } else {
+                node.discard(node.payload);
+            }
+            allocator.destroy(node);
+            released += 1;
+        }
+
+        _ = self.pending.fetchSub(released, .monotonic);
+        _ = self.reclaimed.fetchAdd(released, .monotonic);
+
+        return released;
+    }
+};
+
+pub var queues = [_]Queue{.{}} ** std.meta.fields(Kind).len;
+
+/// Queue a payload, release(payload) is called later on a thread allowed to release it
+///
+/// GL payloads of a closed GL context (payload_context) are discarded with discard(payload) instead
+///
+/// Returns false if the payload could not be queued (reclaiming disabled, GL context closed or out of memory)
+pub fn push(kind: Kind, payload_context: u32, payload: *anyopaque, release: *const fn (*anyopaque) void, discard: *const fn (*anyopaque) void) bool {
+    if (!enabled.load(.monotonic)) return false;
+    if (kind == .gpu and payload_context != context.load(.monotonic)) return false;
+
+    const node = allocator.create(Node) catch {
+        utils.TRACELOG(rl.LOG_WARNING, "RECLAIM: Out of memory, payload not reclaimed", .{});
+        return false;
+    };
+    node.* = .{ .payload = payload, .release = release, .discard = discard, .context = payload_context };
+
+    queues[@intFromEnum(kind)].push(node);
+    return true;
+}
+
+/// Release the CPU payloads during budget_us microseconds at most (at least one is released)
+pub fn flush(budget_us: u64) usize {
+    const deadline = std.time.nanoTimestamp() + @as(i128, budget_us) * std.time.ns_per_us;
+    return queues[@intFromEnum(Kind.cpu)].drain(deadline, null);
+}
+
+/// Release the GL payloads, must be called on the thread drawing while the window is open
+pub fn flush_gpu() usize {
+    return queues[@intFromEnum(Kind.gpu)].drain(null, context.load(.monotonic));
+}
+
+/// Called after the GL context is destroyed (close_window), the GL payloads left are discarded
+pub fn close_context() void {
+    _ = context.fetchAdd(1, .monotonic);
+    _ = queues[@intFromEnum(Kind.gpu)].drain(null, context.load(.monotonic));
+}
+
+/// Called after each frame
+pub fn end_frame() void {
+    _ = flush_gpu();
+    if (queues[@intFromEnum(Kind.cpu)].pending.load(.monotonic) > 0) {
+        _ = flush(frame_budget_us.load(.monotonic));
+    }
+}
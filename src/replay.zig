@@ -0,0 +1,366 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+const utils = @import("./utils.zig");
+
+pub const allocator = rl.allocator;
+
+// Limits of rcore (not exposed by raylib.h)
+const MAX_KEYBOARD_KEYS = 512;
+const MAX_MOUSE_BUTTONS = 8;
+const MAX_TOUCH_POINTS = 8;
+const MAX_GAMEPADS = 4;
+const MAX_GAMEPAD_BUTTONS = 32;
+const MAX_GAMEPAD_AXIS = 8;
+
+// Automation event types of rcore (not exposed by raylib.h either)
+const INPUT_KEY_UP: c_uint = 1;
+const INPUT_KEY_DOWN: c_uint = 2;
+const INPUT_MOUSE_BUTTON_UP: c_uint = 5;
+const INPUT_MOUSE_BUTTON_DOWN: c_uint = 6;
+const INPUT_MOUSE_POSITION: c_uint = 7;
+const INPUT_MOUSE_WHEEL_MOTION: c_uint = 8;
+const INPUT_GAMEPAD_CONNECT: c_uint = 9;
+const INPUT_GAMEPAD_DISCONNECT: c_uint = 10;
+const INPUT_GAMEPAD_BUTTON_UP: c_uint = 11;
+const INPUT_GAMEPAD_BUTTON_DOWN: c_uint = 12;
+const INPUT_GAMEPAD_AXIS_MOTION: c_uint = 13;
+const INPUT_TOUCH_UP: c_uint = 14;
+const INPUT_TOUCH_DOWN: c_uint = 15;
+const INPUT_TOUCH_POSITION: c_uint = 16;
+const INPUT_GESTURE: c_uint = 17;
+
+pub const Params = struct {
+    /// Size of the offscreen render texture
+    width: c_int,
+    height: c_int,
+    /// Fixed timestep given to each frame, the frames run as fast as possible whatever it is
+    fixed_fps: u32 = 60,
+    /// Frames to run, 0 to stop after the frame of the last event
+    frame_count: u32 = 0,
+    /// Hash the render texture pixels at the end of each frame
+    checksums: bool = false,
+    /// Random seed set when the replay starts (and restarts), null to keep the current one
+    seed: ?c_uint = null,
+};
+
+pub const Frame = struct {
+    index: u32,
+    /// Fixed timestep (in seconds)
+    dt: f64,
+};
+
+/// Frame times of the frames run so far (in seconds)
+pub const ReplayStats = struct {
+    frames: usize,
+    events: usize,
+    total: f64,
+    mean: f64,
+    min: f64,
+    max: f64,
+    stddev: f64,
+    p50: f64,
+    p90: f64,
+    p99: f64,
+};
+
+/// Input state set by the events played so far
+///
+/// The live input polled each frame is overwritten with it, the replay only sees its own events
+const ReplayInput = struct {
+    keys: [MAX_KEYBOARD_KEYS]bool = [_]bool{false} ** MAX_KEYBOARD_KEYS,
+    mouse_buttons: [MAX_MOUSE_BUTTONS]bool = [_]bool{false} ** MAX_MOUSE_BUTTONS,
+    mouse_position: [2]c_int = .{ 0, 0 },
+    touches: [MAX_TOUCH_POINTS]bool = [_]bool{false} ** MAX_TOUCH_POINTS,
+    touch_positions: [MAX_TOUCH_POINTS][2]c_int = [_][2]c_int{.{ 0, 0 }} ** MAX_TOUCH_POINTS,
+    gamepads: [MAX_GAMEPADS]bool = [_]bool{false} ** MAX_GAMEPADS,
+    gamepad_buttons: [MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS]bool = [_][MAX_GAMEPAD_BUTTONS]bool{[_]bool{false} ** MAX_GAMEPAD_BUTTONS} ** MAX_GAMEPADS,
+    /// Raw axis values (32768 = 1.0) as in the events
+    gamepad_axes: [MAX_GAMEPADS][MAX_GAMEPAD_AXIS]c_int = [_][MAX_GAMEPAD_AXIS]c_int{[_]c_int{0} ** MAX_GAMEPAD_AXIS} ** MAX_GAMEPADS,
+    gesture: c_int = rl.GESTURE_NONE,
+
+    fn index(value: c_int, len: usize) ?usize {
+        if (value < 0 or value >= len) return null;
+        return @as(usize, @intCast(value));
+    }
+
+    /// Track the state changed by a played event, the events out of the rcore limits are ignored
+    fn set(self: *ReplayInput, event: rl.AutomationEvent) void {
+        const params = event.params;
+
+        switch (event.type) {
+            INPUT_KEY_UP, INPUT_KEY_DOWN => if (index(params[0], MAX_KEYBOARD_KEYS)) |key| {
+                self.keys[key] = event.type == INPUT_KEY_DOWN;
+            },
+            INPUT_MOUSE_BUTTON_UP, INPUT_MOUSE_BUTTON_DOWN => if (index(params[0], MAX_MOUSE_BUTTONS)) |button| {
+                self.mouse_buttons[button] = event.type == INPUT_MOUSE_BUTTON_DOWN;
+            },
+            INPUT_MOUSE_POSITION => self.mouse_position = .{ params[0], params[1] },
+            INPUT_TOUCH_UP, INPUT_TOUCH_DOWN => if (index(params[0], MAX_TOUCH_POINTS)) |point| {
+                self.touches[point] = event.type == INPUT_TOUCH_DOWN;
+            },
+            INPUT_TOUCH_POSITION => if (index(params[0], MAX_TOUCH_POINTS)) |point| {
+                self.touch_positions[point] = .{ params[1], params[2] };
+            },
+            INPUT_GAMEPAD_CONNECT, INPUT_GAMEPAD_DISCONNECT => if (index(params[0], MAX_GAMEPADS)) |gamepad| {
+                self.gamepads[gamepad] = event.type == INPUT_GAMEPAD_CONNECT;
+            },
+            INPUT_GAMEPAD_BUTTON_UP, INPUT_GAMEPAD_BUTTON_DOWN => if (index(params[0], MAX_GAMEPADS)) |gamepad| {
+                if (index(params[1], MAX_GAMEPAD_BUTTONS)) |button| {
+                    self.gamepad_buttons[gamepad][button] = event.type == INPUT_GAMEPAD_BUTTON_DOWN;
+                }
+            },
+            INPUT_GAMEPAD_AXIS_MOTION => if (index(params[0], MAX_GAMEPADS)) |gamepad| {
+                if (index(params[1], MAX_GAMEPAD_AXIS)) |axis| {
+                    self.gamepad_axes[gamepad][axis] = params[2];
+                }
+            },
+            INPUT_GESTURE => self.gesture = params[0],
+            else => {},
+        }
+    }
+
+    /// Overwrite the current input state, the previous one (taken before polling) is already the replay one
+    fn restore(self: *const ReplayInput) void {
+        // The live keys and chars pressed were queued while polling
+        while (rl.GetKeyPressed() != 0) {}
+        while (rl.GetCharPressed() != 0) {}
+
+        for (self.keys, 0..) |down, key| {
+            play(if (down) INPUT_KEY_DOWN else INPUT_KEY_UP, .{ @intCast(key), 0, 0, 0 });
+        }
+
+        for (self.mouse_buttons, 0..) |down, button| {
+            play(if (down) INPUT_MOUSE_BUTTON_DOWN else INPUT_MOUSE_BUTTON_UP, .{ @intCast(button), 0, 0, 0 });
+        }
+        play(INPUT_MOUSE_POSITION, .{ self.mouse_position[0], self.mouse_position[1], 0, 0 });
+        play(INPUT_MOUSE_WHEEL_MOTION, .{ 0, 0, 0, 0 });
+
+        for (self.touches, self.touch_positions, 0..) |down, position, point| {
+            play(if (down) INPUT_TOUCH_DOWN else INPUT_TOUCH_UP, .{ @intCast(point), 0, 0, 0 });
+            play(INPUT_TOUCH_POSITION, .{ @intCast(point), position[0], position[1], 0 });
+        }
+
+        for (self.gamepads, self.gamepad_buttons, self.gamepad_axes, 0..) |connected, buttons, axes, gamepad| {
+            play(if (connected) INPUT_GAMEPAD_CONNECT else INPUT_GAMEPAD_DISCONNECT, .{ @intCast(gamepad), 0, 0, 0 });
+
+            for (buttons, 0..) |down, button| {
+                play(if (down) INPUT_GAMEPAD_BUTTON_DOWN else INPUT_GAMEPAD_BUTTON_UP, .{ @intCast(gamepad), @intCast(button), 0, 0 });
+            }
+            for (axes, 0..) |value, axis| {
+                play(INPUT_GAMEPAD_AXIS_MOTION, .{ @intCast(gamepad), @intCast(axis), value, 0 });
+            }
+        }
+
+        play(INPUT_GESTURE, .{ self.gesture, 0, 0, 0 });
+    }
+
+    fn play(event_type: c_uint, params: [4]c_int) void {
+        rl.PlayAutomationEvent(.{ .frame = 0, .type = event_type, .params = params });
+    }
+};
+
+/// Recorded automation events played back frame by frame into the input state, rendering offscreen
+///
+/// The frames are not paced and the screen buffer is never swapped, nothing waits for vsync
+pub const Replay = struct {
+    params: Params,
+    /// Events sorted by frame
+    events: []rl.AutomationEvent,
+    target: rl.RenderTexture2D,
+    frame_count: u32,
+
+    frame: u32 = 0,
+    next_event: usize = 0,
+    input: ReplayInput = .{},
+    in_frame: bool = false,
+    timer: std.time.Timer,
+    frame_start: u64 = 0,
+    /// Frame times (in nanoseconds) and checksums of the frames run so far
+    times: std.ArrayList(u64),
+    checksums: std.ArrayList(u64),
+
+    /// Release the CPU memory, the render texture must be unloaded before
+    pub fn deinit(self: *Replay) void {
+        self.times.deinit();
+        self.checksums.deinit();
+        allocator.free(self.events);
+        allocator.destroy(self);
+    }
+
+    /// Release the render texture
+    ///
+    /// NOTE: A frame left open is not ended, the texture is released by the reclaim queue between other frames
+    pub fn unload(self: *Replay) void {
+        self.in_frame = false;
+
+        if (self.target.id > 0) rl.UnloadRenderTexture(self.target);
+        self.target = std.mem.zeroes(rl.RenderTexture2D);
+    }
+
+    pub fn is_done(self: *const Replay) bool {
+        return self.frame >= self.frame_count;
+    }
+
+    /// Go back to the first frame, the frame records are cleared
+    pub fn rewind(self: *Replay) void {
+        if (self.in_frame) rl.EndTextureMode();
+        self.in_frame = false;
+
+        self.frame = 0;
+        self.next_event = 0;
+        self.input = .{};
+        self.times.clearRetainingCapacity();
+        self.checksums.clearRetainingCapacity();
+
+        if (self.params.seed) |seed| rl.SetRandomSeed(seed);
+    }
+
+    /// Poll the input, play the events of the frame and start drawing to the render texture,
+    /// returns null when all the frames have run
+    pub fn begin_frame(self: *Replay) !?Frame {
+        if (self.in_frame) return error.frame_not_ended;
+        if (self.is_done()) return null;
+
+        // The previous input state takes the current one (the window events are still processed),
+        // the live input is then replaced by the replay one before the events of the frame change it
+        rl.PollInputEvents();
+        self.input.restore();
+
+        while (self.next_event < self.events.len and self.events[self.next_event].frame <= self.frame) : (self.next_event += 1) {
+            const event = self.events[self.next_event];
+            rl.PlayAutomationEvent(event);
+            self.input.set(event);
+        }
+
+        rl.BeginTextureMode(self.target);
+
+        self.in_frame = true;
+        self.frame_start = self.timer.read();
+
+        return .{
+            .index = self.frame,
+            .dt = 1.0 / @as(f64, @floatFromInt(@max(self.params.fixed_fps, 1))),
+        };
+    }
+
+    /// Stop drawing to the render texture and record the frame time (and checksum), returns the frame time
+    ///
+    /// NOTE: Reading the pixels back for the checksum waits for the GPU, the frame time includes the rendering then
+    pub fn end_frame(self: *Replay) !f64 {
+        if (!self.in_frame) return error.frame_not_begun;
+
+        rl.EndTextureMode();
+        self.in_frame = false;
+
+        if (self.params.checksums) {
+            try self.checksums.append(try self.get_checksum());
+        }
+
+        const elapsed = self.timer.read() - self.frame_start;
+        try self.times.append(elapsed);
+
+        self.frame += 1;
+
+        return seconds(elapsed);
+    }
+
+    fn get_checksum(self: *const Replay) !u64 {
+        const texture = self.target.texture;
+
+        const pixels: [*]u8 = @ptrCast(rl.rlReadTexturePixels(texture.id, texture.width, texture.height, texture.format) orelse return error.invalid_target);
+        defer rl.MemFree(pixels);
+
+        const size: usize = @intCast(rl.GetPixelDataSize(texture.width, texture.height, texture.format));
+
+        return std.hash.XxHash64.hash(0, pixels[0..size]);
+    }
+
+    pub fn get_stats(self: *const Replay) !ReplayStats {
+        var stats = ReplayStats{
+            .frames = self.times.items.len,
+            .events = self.next_event,
+            .total = 0.0,
+            .mean = 0.0,
+            .min = 0.0,
+            .max = 0.0,
+            .stddev = 0.0,
+            .p50 = 0.0,
+            .p90 = 0.0,
+            .p99 = 0.0,
+        };
+
+        const count = self.times.items.len;
+        if (count == 0) return stats;
+
+        const sorted = try allocator.dupe(u64, self.times.items);
+        defer allocator.free(sorted);
+        std.mem.sort(u64, sorted, {}, std.sort.asc(u64));
+
+        for (sorted) |time| stats.total += seconds(time);
+
+        const n: f64 = @floatFromInt(count);
+        stats.mean = stats.total / n;
+        stats.min = seconds(sorted[0]);
+        stats.max = seconds(sorted[count - 1]);
+        stats.p50 = seconds(sorted[(count - 1) / 2]);
+        stats.p90 = seconds(sorted[((count - 1) * 90) / 100]);
+        stats.p99 = seconds(sorted[((count - 1) * 99) / 100]);
+
+        var variance: f64 = 0.0;
+        for (sorted) |time| {
+            const t = seconds(time);
+            variance += (t - stats.mean) * (t - stats.mean);
+        }
+        stats.stddev = @sqrt(variance / n);
+
+        return stats;
+    }
+};
+
+fn seconds(ns: u64) f64 {
+    return @as(f64, @floatFromInt(ns)) / std.time.ns_per_s;
+}
+
+fn event_frame_less(_: void, a: rl.AutomationEvent, b: rl.AutomationEvent) bool {
+    return a.frame < b.frame;
+}
+
+/// Load a replay of automation events (copied), the render texture needs the window to be initialized
+pub fn LoadReplay(events: []const rl.AutomationEvent, params: Params) !*Replay {
+    if (events.len == 0) return error.invalid_events;
+    if (params.width <= 0 or params.height <= 0) return error.invalid_size;
+
+    const timer = try std.time.Timer.start();
+
+    const sorted = try allocator.dupe(rl.AutomationEvent, events);
+    errdefer allocator.free(sorted);
+
+    // Stable, the events of the same frame keep their recorded order (and linear on a recording, already in order)
+    std.sort.insertion(rl.AutomationEvent, sorted, {}, event_frame_less);
+
+    const target = rl.LoadRenderTexture(params.width, params.height);
+    errdefer rl.UnloadRenderTexture(target);
+
+    if (!rl.IsRenderTextureValid(target)) return error.invalid_target;
+
+    const self = try allocator.create(Replay);
+    self.* = .{
+        .params = params,
+        .events = sorted,
+        .target = target,
+        .frame_count = if (params.frame_count > 0) params.frame_count else sorted[sorted.len - 1].frame + 1,
+        .timer = timer,
+        .times = std.ArrayList(u64).init(allocator),
+        .checksums = std.ArrayList(u64).init(allocator),
+    };
+
+    if (params.seed) |seed| rl.SetRandomSeed(seed);
+
+    utils.TRACELOG(rl.LOG_INFO, "REPLAY: Replay loaded (%i events, %i frames)", .{ @as(c_int, @intCast(sorted.len)), @as(c_int, @intCast(self.frame_count)) });
+
+    return self;
+}
+
+pub fn UnloadReplay(replay: *Replay) void {
+    replay.unload();
+}
@@ -56,6 +56,16 @@ pub const ResourceType = struct {
     file_path_list: *e.ErlNifResourceType = undefined,
     automation_event: *e.ErlNifResourceType = undefined,
     automation_event_list: *e.ErlNifResourceType = undefined,
+    scene: *e.ErlNifResourceType = undefined,
+    uniform_set: *e.ErlNifResourceType = undefined,
+    image_anim_stream: *e.ErlNifResourceType = undefined,
+    asset_pack: *e.ErlNifResourceType = undefined,
+    texture_stream: *e.ErlNifResourceType = undefined,
+    display_list: *e.ErlNifResourceType = undefined,
+    voice_pool: *e.ErlNifResourceType = undefined,
+    terrain: *e.ErlNifResourceType = undefined,
+    sprite_atlas: *e.ErlNifResourceType = undefined,
+    replay: *e.ErlNifResourceType = undefined,
 
     pub const allocator: std.mem.Allocator = e.allocator;
 
@@ -266,6 +276,46 @@ pub const ResourceType = struct {
     pub fn automation_event_list_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
         core.AutomationEventList.Resource.destroy(@ptrCast(@alignCast(obj.?)));
     }
+
+    pub fn scene_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
+        core.Scene.Resource.destroy(@ptrCast(@alignCast(obj.?)));
+    }
+
+    pub fn uniform_set_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
+        core.UniformSet.Resource.destroy(@ptrCast(@alignCast(obj.?)));
+    }
+
+    pub fn image_anim_stream_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
+        core.ImageAnimStream.Resource.destroy(@ptrCast(@alignCast(obj.?)));
+    }
+
+    pub fn asset_pack_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
+        core.AssetPack.Resource.destroy(@ptrCast(@alignCast(obj.?)));
+    }
+
+    pub fn texture_stream_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
+        core.TextureStream.Resource.destroy(@ptrCast(@alignCast(obj.?)));
+    }
+
+    pub fn display_list_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
+        core.DisplayList.Resource.destroy(@ptrCast(@alignCast(obj.?)));
+    }
+
+    pub fn voice_pool_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
+        core.VoicePool.Resource.destroy(@ptrCast(@alignCast(obj.?)));
+    }
+
+    pub fn terrain_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
+        core.Terrain.Resource.destroy(@ptrCast(@alignCast(obj.?)));
+    }
+
+    pub fn sprite_atlas_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
+        core.SpriteAtlas.Resource.destroy(@ptrCast(@alignCast(obj.?)));
+    }
+
+    pub fn replay_dtor(_: ?*e.ErlNifEnv, obj: ?*anyopaque) callconv(.C) void {
+        core.Replay.Resource.destroy(@ptrCast(@alignCast(obj.?)));
+    }
 };
 
 pub var resource_type = ResourceType{};
@@ -323,6 +373,16 @@ pub const ResourceTypeKey = enum {
     file_path_list,
     automation_event,
     automation_event_list,
+    scene,
+    uniform_set,
+    image_anim_stream,
+    asset_pack,
+    texture_stream,
+    display_list,
+    voice_pool,
+    terrain,
+    sprite_atlas,
+    replay,
 };
 
 pub fn get_resource_type_from_key(key: ResourceTypeKey) *e.ErlNifResourceType {
@@ -379,6 +439,16 @@ pub fn get_resource_type_from_key(key: ResourceTypeKey) *e.ErlNifResourceType {
         .file_path_list => resource_type.file_path_list,
         .automation_event => resource_type.automation_event,
         .automation_event_list => resource_type.automation_event_list,
+        .scene => resource_type.scene,
+        .uniform_set => resource_type.uniform_set,
+        .image_anim_stream => resource_type.image_anim_stream,
+        .asset_pack => resource_type.asset_pack,
+        .texture_stream => resource_type.texture_stream,
+        .display_list => resource_type.display_list,
+        .voice_pool => resource_type.voice_pool,
+        .terrain => resource_type.terrain,
+        .sprite_atlas => resource_type.sprite_atlas,
+        .replay => resource_type.replay,
     };
 }
 
@@ -437,6 +507,16 @@ pub fn load_resources(env: ?*e.ErlNifEnv) bool {
     resource_type.file_path_list = e.enif_open_resource_type(env, null, "Zexray.Resource.FilePathList", &ResourceType.file_path_list_dtor, flags, null) orelse return false;
     resource_type.automation_event = e.enif_open_resource_type(env, null, "Zexray.Resource.AutomationEvent", &ResourceType.automation_event_dtor, flags, null) orelse return false;
     resource_type.automation_event_list = e.enif_open_resource_type(env, null, "Zexray.Resource.AutomationEventList", &ResourceType.automation_event_list_dtor, flags, null) orelse return false;
+    resource_type.scene = e.enif_open_resource_type(env, null, "Zexray.Resource.Scene", &ResourceType.scene_dtor, flags, null) orelse return false;
+    resource_type.uniform_set = e.enif_open_resource_type(env, null, "Zexray.Resource.UniformSet", &ResourceType.uniform_set_dtor, flags, null) orelse return false;
+    resource_type.image_anim_stream = e.enif_open_resource_type(env, null, "Zexray.Resource.ImageAnimStream", &ResourceType.image_anim_stream_dtor, flags, null) orelse return false;
+    resource_type.asset_pack = e.enif_open_resource_type(env, null, "Zexray.Resource.AssetPack", &ResourceType.asset_pack_dtor, flags, null) orelse return false;
+    resource_type.texture_stream = e.enif_open_resource_type(env, null, "Zexray.Resource.TextureStream", &ResourceType.texture_stream_dtor, flags, null) orelse return false;
+    resource_type.display_list = e.enif_open_resource_type(env, null, "Zexray.Resource.DisplayList", &ResourceType.display_list_dtor, flags, null) orelse return false;
+    resource_type.voice_pool = e.enif_open_resource_type(env, null, "Zexray.Resource.VoicePool", &ResourceType.voice_pool_dtor, flags, null) orelse return false;
+    resource_type.terrain = e.enif_open_resource_type(env, null, "Zexray.Resource.Terrain", &ResourceType.terrain_dtor, flags, null) orelse return false;
+    resource_type.sprite_atlas = e.enif_open_resource_type(env, null, "Zexray.Resource.SpriteAtlas", &ResourceType.sprite_atlas_dtor, flags, null) orelse return false;
+    resource_type.replay = e.enif_open_resource_type(env, null, "Zexray.Resource.Replay", &ResourceType.replay_dtor, flags, null) orelse return false;
 
     return true;
 }
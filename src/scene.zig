@@ -0,0 +1,473 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const e = @import("./erl_nif.zig");
+const rl = @import("./raylib.zig");
+
+pub const allocator = rl.allocator;
+
+const matrix_identity = rl.Matrix{ .m0 = 1.0, .m5 = 1.0, .m10 = 1.0, .m15 = 1.0 };
+const color_white = rl.Color{ .r = 255, .g = 255, .b = 255, .a = 255 };
+
+/// Drawable attached to a scene node
+///
+/// NOTE: The pointers are resource objects kept alive by the node,
+/// they are released when the node is replaced or removed
+pub const SceneDrawable = union(enum) {
+    none: void,
+    model: **rl.Model,
+    mesh: struct {
+        mesh: **rl.Mesh,
+        material: **rl.Material,
+    },
+
+    fn keep(self: SceneDrawable) void {
+        switch (self) {
+            .none => {},
+            .model => |model| e.enif_keep_resource(@ptrCast(model)),
+            .mesh => |mesh| {
+                e.enif_keep_resource(@ptrCast(mesh.mesh));
+                e.enif_keep_resource(@ptrCast(mesh.material));
+            },
+        }
+    }
+
+    fn release(self: SceneDrawable) void {
+        switch (self) {
+            .none => {},
+            .model => |model| e.enif_release_resource(@ptrCast(model)),
+            .mesh => |mesh| {
+                e.enif_release_resource(@ptrCast(mesh.mesh));
+                e.enif_release_resource(@ptrCast(mesh.material));
+            },
+        }
+    }
+
+    fn bounding_box(self: SceneDrawable) rl.BoundingBox {
+        return switch (self) {
+            .none => rl.BoundingBox{},
+            .model => |model| model_bounding_box(model.*.*),
+            .mesh => |mesh| rl.GetMeshBoundingBox(mesh.mesh.*.*),
+        };
+    }
+};
+
+/// Model bounding box (model space), built from the mesh boxes
+///
+/// NOTE: GetModelBoundingBox() already applies the model transform, which is applied again when drawing
+fn model_bounding_box(model: rl.Model) rl.BoundingBox {
+    const mesh_count: usize = @intCast(@max(model.meshCount, 0));
+    if (mesh_count == 0) return rl.BoundingBox{};
+
+    var box = rl.GetMeshBoundingBox(model.meshes[0]);
+    for (1..mesh_count) |m| {
+        const mesh_box = rl.GetMeshBoundingBox(model.meshes[m]);
+        box.min = rl.Vector3Min(box.min, mesh_box.min);
+        box.max = rl.Vector3Max(box.max, mesh_box.max);
+    }
+
+    return TransformBoundingBox(box, model.transform);
+}
+
+/// Scene node
+pub const SceneNode = struct {
+    id: u32 = 0,
+    parent: ?u32 = null,
+    transform: rl.Matrix = matrix_identity, // Local transform (relative to the parent)
+    tint: rl.Color = color_white,
+    visible: bool = true,
+    drawable: SceneDrawable = .none,
+
+    bounds: rl.BoundingBox = rl.BoundingBox{}, // Cached drawable bounding box (local space)
+    world: rl.Matrix = matrix_identity, // Cached world transform
+    world_visible: bool = true, // Cached visibility (the node and all its parents are visible)
+    world_frame: u64 = 0, // Frame the world transform and visibility were computed
+};
+
+/// Scene draw statistics (last draw)
+pub const SceneStats = struct {
+    nodes: c_uint = 0,
+    drawn: c_uint = 0,
+    culled: c_uint = 0,
+    draw_calls: c_uint = 0,
+};
+
+/// Single mesh draw, sorted by material state before drawing
+const SceneDrawItem = struct {
+    key: u64,
+    mesh: rl.Mesh,
+    material: *rl.Material,
+    transform: rl.Matrix,
+    tint: rl.Color,
+
+    fn less_than(_: void, a: SceneDrawItem, b: SceneDrawItem) bool {
+        if (a.key != b.key) return a.key < b.key;
+        return a.mesh.vaoId < b.mesh.vaoId;
+    }
+};
+
+/// Frustum planes (a, b, c, d) with the normals pointing inside
+pub const Frustum = struct {
+    planes: [6]rl.Vector4,
+
+    pub fn from_camera(camera: rl.Camera3D) Frustum {
+        var width = rl.rlGetFramebufferWidth();
+        var height = rl.rlGetFramebufferHeight();
+        if (width <= 0 or height <= 0) {
+            width = rl.GetRenderWidth();
+            height = rl.GetRenderHeight();
+        }
+        const aspect: f64 = @as(f64, @floatFromInt(width)) / @as(f64, @floatFromInt(@max(height, 1)));
+
+        // Same projection used by BeginMode3D()
+        const near: f64 = rl.RL_CULL_DISTANCE_NEAR;
+        const far: f64 = rl.RL_CULL_DISTANCE_FAR;
+
+        const projection = if (camera.projection == rl.CAMERA_PERSPECTIVE) blk: {
+            const top = near * std.math.tan(@as(f64, camera.fovy) * 0.5 * std.math.rad_per_deg);
+            const right = top * aspect;
+            break :blk rl.MatrixFrustum(-right, right, -top, top, near, far);
+        } else blk: {
+            const top = @as(f64, camera.fovy) / 2.0;
+            const right = top * aspect;
+            break :blk rl.MatrixOrtho(-right, right, -top, top, near, far);
+        };
+
+        const view = rl.MatrixLookAt(camera.position, camera.target, camera.up);
+        const m = rl.MatrixMultiply(view, projection);
+
+        var frustum = Frustum{ .planes = undefined };
+
+        frustum.planes[0] = normalize_plane(m.m3 + m.m0, m.m7 + m.m4, m.m11 + m.m8, m.m15 + m.m12); // left
+        frustum.planes[1] = normalize_plane(m.m3 - m.m0, m.m7 - m.m4, m.m11 - m.m8, m.m15 - m.m12); // right
+        frustum.planes[2] = normalize_plane(m.m3 + m.m1, m.m7 + m.m5, m.m11 + m.m9, m.m15 + m.m13); // bottom
+        frustum.planes[3] = normalize_plane(m.m3 - m.m1, m.m7 - m.m5, m.m11 - m.m9, m.m15 - m.m13); // top
+        frustum.planes[4] = normalize_plane(m.m3 + m.m2, m.m7 + m.m6, m.m11 + m.m10, m.m15 + m.m14); // near
+        frustum.planes[5] = normalize_plane(m.m3 - m.m2, m.m7 - m.m6, m.m11 - m.m10, m.m15 - m.m14); // far
+
+        return frustum;
+    }
+
+    fn normalize_plane(a: f32, b: f32, c: f32, d: f32) rl.Vector4 {
+        const length = @sqrt(a * a + b * b + c * c);
+        if (length == 0) return rl.Vector4{ .x = a, .y = b, .z = c, .w = d };
+        return rl.Vector4{ .x = a / length, .y = b / length, .z = c / length, .w = d / length };
+    }
+
+    /// Check if the box is at least partially inside the frustum
+    pub fn contains_box(self: Frustum, box: rl.BoundingBox) bool {
+        for (self.planes) |plane| {
+            // Box corner farthest along the plane normal
+            const x = if (plane.x >= 0) box.max.x else box.min.x;
+            const y = if (plane.y >= 0) box.max.y else box.min.y;
+            const z = if (plane.z >= 0) box.max.z else box.min.z;
+
+            if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0) return false;
+        }
+        return true;
+    }
+};
+
+/// Transform the bounding box, returns the axis aligned box containing the transformed corners
+pub fn TransformBoundingBox(box: rl.BoundingBox, transform: rl.Matrix) rl.BoundingBox {
+    var result = rl.BoundingBox{
+        .min = rl.Vector3{ .x = std.math.floatMax(f32), .y = std.math.floatMax(f32), .z = std.math.floatMax(f32) },
+        .max = rl.Vector3{ .x = -std.math.floatMax(f32), .y = -std.math.floatMax(f32), .z = -std.math.floatMax(f32) },
+    };
+
+    for (0..8) |i| {
+        const corner = rl.Vector3{
+            .x = if (i & 1 != 0) box.max.x else box.min.x,
+            .y = if (i & 2 != 0) box.max.y else box.min.y,
+            .z = if (i & 4 != 0) box.max.z else box.min.z,
+        };
+        const point = rl.Vector3Transform(corner, transform);
+        result.min = rl.Vector3Min(result.min, point);
+        result.max = rl.Vector3Max(result.max, point);
+    }
+
+    return result;
+}
+
+/// Retained scene graph
+pub const Scene = struct {
+    lock: std.Thread.Mutex = .{},
+    nodes: std.ArrayList(SceneNode),
+    index: std.AutoHashMap(u32, usize),
+    queue: std.ArrayList(SceneDrawItem),
+    chain: std.ArrayList(usize), // Parent chain scratch (world transforms)
+    frame: u64 = 0,
+    stats: SceneStats = .{},
+
+    pub fn init() !*Scene {
+        const scene = try allocator.create(Scene);
+        scene.* = Scene{
+            .nodes = std.ArrayList(SceneNode).init(allocator),
+            .index = std.AutoHashMap(u32, usize).init(allocator),
+            .queue = std.ArrayList(SceneDrawItem).init(allocator),
+            .chain = std.ArrayList(usize).init(allocator),
+        };
+        return scene;
+    }
+
+    pub fn deinit(self: *Scene) void {
+        for (self.nodes.items) |node| node.drawable.release();
+        self.nodes.deinit();
+        self.index.deinit();
+        self.queue.deinit();
+        self.chain.deinit();
+        allocator.destroy(self);
+    }
+
+    /// Insert or replace a node, the drawable resources are kept by the scene
+    pub fn set_node(self: *Scene, node: SceneNode) !void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        var value = node;
+        value.bounds = value.drawable.bounding_box();
+        value.world_frame = 0;
+
+        if (self.index.get(value.id)) |i| {
+            value.drawable.keep();
+            self.nodes.items[i].drawable.release();
+            self.nodes.items[i] = value;
+        } else {
+            try self.nodes.ensureUnusedCapacity(1);
+            try self.index.put(value.id, self.nodes.items.len);
+            value.drawable.keep();
+            self.nodes.appendAssumeCapacity(value);
+        }
+    }
+
+    pub fn set_node_transform(self: *Scene, id: u32, transform: rl.Matrix) bool {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        const i = self.index.get(id) orelse return false;
+        self.nodes.items[i].transform = transform;
+        return true;
+    }
+
+    pub fn set_node_parent(self: *Scene, id: u32, parent: ?u32) bool {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        const i = self.index.get(id) orelse return false;
+        self.nodes.items[i].parent = parent;
+        return true;
+    }
+
+    pub fn set_node_tint(self: *Scene, id: u32, tint: rl.Color) bool {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        const i = self.index.get(id) orelse return false;
+        self.nodes.items[i].tint = tint;
+        return true;
+    }
+
+    pub fn set_node_visible(self: *Scene, id: u32, visible: bool) bool {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        const i = self.index.get(id) orelse return false;
+        self.nodes.items[i].visible = visible;
+        return true;
+    }
+
+    /// Remove the node, the children are kept and become root nodes
+    pub fn remove_node(self: *Scene, id: u32) bool {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        const entry = self.index.fetchRemove(id) orelse return false;
+        const i = entry.value;
+
+        self.nodes.items[i].drawable.release();
+        _ = self.nodes.swapRemove(i);
+
+        if (i < self.nodes.items.len) {
+            self.index.putAssumeCapacity(self.nodes.items[i].id, i);
+        }
+
+        // The children must not be adopted by a node added later with the same id
+        for (self.nodes.items) |*node| {
+            if (node.parent) |parent| {
+                if (parent == id) node.parent = null;
+            }
+        }
+
+        return true;
+    }
+
+    pub fn clear(self: *Scene) void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        for (self.nodes.items) |node| node.drawable.release();
+        self.nodes.clearRetainingCapacity();
+        self.index.clearRetainingCapacity();
+    }
+
+    pub fn get_stats(self: *Scene) SceneStats {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        return self.stats;
+    }
+
+    /// Compute the node world transform and visibility, parents are resolved once per frame
+    ///
+    /// NOTE: The parents are walked with an explicit stack, long chains do not grow the native stack
+    fn resolve_world(self: *Scene, i: usize) !void {
+        const chain = &self.chain;
+        chain.clearRetainingCapacity();
+
+        // Walk up to the first parent already resolved this frame, missing parents and cycles are treated as root
+        var parent_world: ?rl.Matrix = null;
+        var parent_visible = true;
+        var current = i;
+        while (true) {
+            const node = self.nodes.items[current];
+            if (node.world_frame == self.frame) {
+                parent_world = node.world;
+                parent_visible = node.world_visible;
+                break;
+            }
+
+            try chain.append(current);
+            if (chain.items.len >= self.nodes.items.len) break;
+
+            const parent_id = node.parent orelse break;
+            const parent = self.index.get(parent_id) orelse break;
+            if (parent == current) break;
+            current = parent;
+        }
+
+        // Resolve from the topmost parent down to the node
+        var k = chain.items.len;
+        while (k > 0) {
+            k -= 1;
+            const node = &self.nodes.items[chain.items[k]];
+            node.world = if (parent_world) |world| rl.MatrixMultiply(node.transform, world) else node.transform;
+            node.world_visible = node.visible and parent_visible;
+            node.world_frame = self.frame;
+            parent_world = node.world;
+            parent_visible = node.world_visible;
+        }
+    }
+
+    /// Cull against the camera frustum, sort by material state and draw the visible nodes
+    ///
+    /// NOTE: Must be called inside BeginMode3D() with the same camera
+    pub fn draw(self: *Scene, camera: rl.Camera3D) !SceneStats {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        self.frame += 1;
+
+        const frustum = Frustum.from_camera(camera);
+
+        var stats = SceneStats{ .nodes = @intCast(self.nodes.items.len) };
+
+        self.queue.clearRetainingCapacity();
+
+        for (0..self.nodes.items.len) |i| {
+            if (self.nodes.items[i].drawable == .none) continue;
+
+            try self.resolve_world(i);
+            const node = self.nodes.items[i];
+            if (!node.world_visible) continue;
+
+            const world = node.world;
+
+            if (!frustum.contains_box(TransformBoundingBox(node.bounds, world))) {
+                stats.culled += 1;
+                continue;
+            }
+
+            stats.drawn += 1;
+
+            switch (node.drawable) {
+                .none => unreachable,
+                .model => |resource| {
+                    const model: *rl.Model = resource.*;
+                    const transform = rl.MatrixMultiply(model.transform, world);
+                    const mesh_count: usize = @intCast(@max(model.meshCount, 0));
+
+                    try self.queue.ensureUnusedCapacity(mesh_count);
+
+                    for (0..mesh_count) |m| {
+                        const material: *rl.Material = &model.materials[@intCast(model.meshMaterial[m])];
+                        self.queue.appendAssumeCapacity(SceneDrawItem{
+                            .key = material_key(material),
+                            .mesh = model.meshes[m],
+                            .material = material,
+                            .transform = transform,
+                            .tint = node.tint,
+                        });
+                    }
+                },
+                .mesh => |mesh| {
+                    const material: *rl.Material = mesh.material.*;
+                    try self.queue.append(SceneDrawItem{
+                        .key = material_key(material),
+                        .mesh = mesh.mesh.*.*,
+                        .material = material,
+                        .transform = world,
+                        .tint = node.tint,
+                    });
+                },
+            }
+        }
+
+        std.mem.sort(SceneDrawItem, self.queue.items, {}, SceneDrawItem.less_than);
+
+        // Tinted copy of the material maps, the material may be shared with other resources
+        var maps: [rl.MAX_MATERIAL_MAPS]rl.MaterialMap = undefined;
+
+        for (self.queue.items) |item| {
+            if (item.material.maps == null or std.meta.eql(item.tint, color_white)) {
+                rl.DrawMesh(item.mesh, item.material.*, item.transform);
+                continue;
+            }
+
+            @memcpy(&maps, item.material.maps[0..rl.MAX_MATERIAL_MAPS]);
+
+            const diffuse: usize = @intCast(rl.MATERIAL_MAP_DIFFUSE);
+            const color = maps[diffuse].color;
+
+            maps[diffuse].color = rl.Color{
+                .r = @intCast((@as(c_uint, color.r) * @as(c_uint, item.tint.r)) / 255),
+                .g = @intCast((@as(c_uint, color.g) * @as(c_uint, item.tint.g)) / 255),
+                .b = @intCast((@as(c_uint, color.b) * @as(c_uint, item.tint.b)) / 255),
+                .a = @intCast((@as(c_uint, color.a) * @as(c_uint, item.tint.a)) / 255),
+            };
+
+            var material = item.material.*;
+            material.maps = &maps;
+
+            rl.DrawMesh(item.mesh, material, item.transform);
+        }
+
+        stats.draw_calls = @intCast(self.queue.items.len);
+        self.stats = stats;
+
+        return stats;
+    }
+
+    /// Sort key: shader first, then the diffuse texture
+    fn material_key(material: *const rl.Material) u64 {
+        const shader_id: u64 = material.shader.id;
+        const texture_id: u64 = if (material.maps != null) material.maps[@intCast(rl.MATERIAL_MAP_DIFFUSE)].texture.id else 0;
+        return (shader_id << 32) | texture_id;
+    }
+};
+
+pub fn LoadScene() !*Scene {
+    return Scene.init();
+}
+
+pub fn UnloadScene(scene: *Scene) void {
+    scene.deinit();
+}
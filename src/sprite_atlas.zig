@@ -0,0 +1,343 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+const utils = @import("./utils.zig");
+const workers = @import("./workers.zig");
+const image_process = @import("./image_process.zig");
+
+pub const allocator = rl.allocator;
+
+/// Atlas side at most (width and height)
+pub const SPRITE_ATLAS_MAX_SIZE = 16384;
+
+pub const Params = struct {
+    /// Pixels between the sprites and the atlas edges, filled with the sprite edges (no bleeding when filtering)
+    padding: usize = 2,
+    /// Atlas side at most, a power of 2
+    max_size: usize = 4096,
+    mipmaps: bool = false,
+    filter: c_int = rl.TEXTURE_FILTER_POINT,
+};
+
+pub const SpriteAtlasInfo = struct {
+    width: c_int,
+    height: c_int,
+    sprites: usize,
+    mipmaps: c_int,
+    /// Fraction of the atlas covered by the sprites (padding included)
+    occupancy: f32,
+};
+
+const Rect = struct {
+    x: usize = 0,
+    y: usize = 0,
+    width: usize = 0,
+    height: usize = 0,
+
+    fn right(self: Rect) usize {
+        return self.x + self.width;
+    }
+
+    fn bottom(self: Rect) usize {
+        return self.y + self.height;
+    }
+
+    fn contains(self: Rect, other: Rect) bool {
+        return other.x >= self.x and other.y >= self.y and other.right() <= self.right() and other.bottom() <= self.bottom();
+    }
+
+    fn intersects(self: Rect, other: Rect) bool {
+        return self.x < other.right() and other.x < self.right() and self.y < other.bottom() and other.y < self.bottom();
+    }
+};
+
+/// MaxRects packer (best short side fit), the free rectangles overlap and cover all the free space
+const Packer = struct {
+    free: std.ArrayList(Rect),
+
+    fn init(width: usize, height: usize) !Packer {
+        var free = std.ArrayList(Rect).init(allocator);
+        errdefer free.deinit();
+
+        try free.append(.{ .width = width, .height = height });
+
+        return Packer{ .free = free };
+    }
+
+    fn deinit(self: *Packer) void {
+        self.free.deinit();
+    }
+
+    fn insert(self: *Packer, width: usize, height: usize) !?Rect {
+        var best: ?Rect = null;
+        var best_short: usize = std.math.maxInt(usize);
+        var best_long: usize = std.math.maxInt(usize);
+
+        for (self.free.items) |free| {
+            if (free.width < width or free.height < height) continue;
+
+            const leftover_x = free.width - width;
+            const leftover_y = free.height - height;
+            const short = @min(leftover_x, leftover_y);
+            const long = @max(leftover_x, leftover_y);
+
+            if (short < best_short or (short == best_short and long < best_long)) {
+                best = .{ .x = free.x, .y = free.y, .width = width, .height = height };
+                best_short = short;
+                best_long = long;
+            }
+        }
+
+        const used = best orelse return null;
+
+        // Split the free rectangles overlapped by the used one
+        var i: usize = 0;
+        while (i < self.free.items.len) {
+            const free = self.free.items[i];
+            if (!free.intersects(used)) {
+                i += 1;
+                continue;
+            }
+
+            _ = self.free.swapRemove(i);
+
+            if (used.x > free.x) try self.free.append(.{ .x = free.x, .y = free.y, .width = used.x - free.x, .height = free.height });
+            if (used.right() < free.right()) try self.free.append(.{ .x = used.right(), .y = free.y, .width = free.right() - used.right(), .height = free.height });
+            if (used.y > free.y) try self.free.append(.{ .x = free.x, .y = free.y, .width = free.width, .height = used.y - free.y });
+            if (used.bottom() < free.bottom()) try self.free.append(.{ .x = free.x, .y = used.bottom(), .width = free.width, .height = free.bottom() - used.bottom() });
+        }
+
+        self.prune();
+
+        return used;
+    }
+
+    /// Remove the free rectangles contained in another one
+    fn prune(self: *Packer) void {
+        var i: usize = 0;
+        outer: while (i < self.free.items.len) {
+            for (self.free.items, 0..) |other, j| {
+                if (i != j and other.contains(self.free.items[i])) {
+                    _ = self.free.swapRemove(i);
+                    continue :outer;
+                }
+            }
+            i += 1;
+        }
+    }
+};
+
+/// Many images packed in one texture, the sprites are addressed by their index
+///
+/// Drawing sprites of the same atlas keeps the texture bound, the rlgl batch is not flushed between them
+pub const SpriteAtlas = struct {
+    texture: rl.Texture2D,
+    /// Source rectangle of each sprite in the atlas (padding excluded)
+    sprites: []rl.Rectangle,
+    occupancy: f32,
+
+    /// Release the CPU memory, the texture must be unloaded before
+    pub fn deinit(self: *SpriteAtlas) void {
+        allocator.free(self.sprites);
+        allocator.destroy(self);
+    }
+
+    /// Release the texture
+    pub fn unload(self: *SpriteAtlas) void {
+        if (self.texture.id > 0) rl.UnloadTexture(self.texture);
+        self.texture = std.mem.zeroes(rl.Texture2D);
+    }
+
+    pub fn get_sprite(self: *const SpriteAtlas, id: usize) ?rl.Rectangle {
+        if (id >= self.sprites.len) return null;
+        return self.sprites[id];
+    }
+
+    pub fn get_info(self: *const SpriteAtlas) SpriteAtlasInfo {
+        return .{
+            .width = self.texture.width,
+            .height = self.texture.height,
+            .sprites = self.sprites.len,
+            .mipmaps = self.texture.mipmaps,
+            .occupancy = self.occupancy,
+        };
+    }
+
+    /// Draw a sprite scaled at a position, origin and rotation as in DrawTexturePro (origin relative to the scaled sprite)
+    pub fn draw(self: *const SpriteAtlas, id: usize, position: rl.Vector2, origin: rl.Vector2, rotation: f32, scale: f32, tint: rl.Color) !void {
+        const source = self.get_sprite(id) orelse return error.invalid_sprite;
+
+        const dest = rl.Rectangle{
+            .x = position.x,
+            .y = position.y,
+            .width = source.width * scale,
+            .height = source.height * scale,
+        };
+
+        rl.DrawTexturePro(self.texture, source, dest, origin, rotation, tint);
+    }
+};
+
+/// Pack the sprites in the smallest power of 2 atlas (growing the shortest side first), returns the padded cells
+fn pack(images: []const rl.Image, params: Params, cells: []Rect) !Rect {
+    const order = try allocator.alloc(usize, images.len);
+    defer allocator.free(order);
+
+    for (order, 0..) |*index, i| index.* = i;
+
+    // Largest sides first, they are the hardest to place
+    std.mem.sort(usize, order, images, struct {
+        fn less(context: []const rl.Image, a: usize, b: usize) bool {
+            const side_a = @max(context[a].width, context[a].height);
+            const side_b = @max(context[b].width, context[b].height);
+            if (side_a != side_b) return side_a > side_b;
+            return @as(i64, context[a].width) * context[a].height > @as(i64, context[b].width) * context[b].height;
+        }
+    }.less);
+
+    var area: usize = 0;
+    var side: usize = 1;
+    for (images) |image| {
+        const width = @as(usize, @intCast(image.width)) + 2 * params.padding;
+        const height = @as(usize, @intCast(image.height)) + 2 * params.padding;
+        if (width > params.max_size or height > params.max_size) return error.atlas_too_small;
+        area += width * height;
+        side = @max(side, width, height);
+    }
+
+    var width = std.math.ceilPowerOfTwo(usize, @max(side, std.math.sqrt(area))) catch return error.atlas_too_small;
+    var height = width;
+
+    while (width <= params.max_size and height <= params.max_size) {
+        if (try pack_into(images, params.padding, order, width, height, cells)) {
+            return Rect{ .width = width, .height = height };
+        }
+
+        if (height < width) height *= 2 else width *= 2;
+    }
+
+    return error.atlas_too_small;
+}
+
+fn pack_into(images: []const rl.Image, padding: usize, order: []const usize, width: usize, height: usize, cells: []Rect) !bool {
+    var packer = try Packer.init(width, height);
+    defer packer.deinit();
+
+    for (order) |index| {
+        const image = images[index];
+        const cell_width = @as(usize, @intCast(image.width)) + 2 * padding;
+        const cell_height = @as(usize, @intCast(image.height)) + 2 * padding;
+
+        cells[index] = (try packer.insert(cell_width, cell_height)) orelse return false;
+    }
+
+    return true;
+}
+
+const BlitJob = struct {
+    images: []const rl.Image,
+    cells: []const Rect,
+    padding: usize,
+    pixels: [*]rl.Color,
+    stride: usize,
+    failed: std.atomic.Value(bool) = std.atomic.Value(bool).init(false),
+
+    /// Copy the sprites in their cells, the padding repeats the sprite edges
+    fn run(self: *BlitJob, start: usize, end: usize) void {
+        for (self.images[start..end], self.cells[start..end]) |image, cell| {
+            const colors = rl.LoadImageColors(image);
+            if (colors == null) {
+                self.failed.store(true, .monotonic);
+                continue;
+            }
+            defer rl.UnloadImageColors(colors);
+
+            const width: usize = @intCast(image.width);
+            const height: usize = @intCast(image.height);
+
+            for (0..cell.height) |y| {
+                const source_y = @min(y -| self.padding, height - 1);
+                const row = self.pixels + (cell.y + y) * self.stride + cell.x;
+
+                for (0..cell.width) |x| {
+                    const source_x = @min(x -| self.padding, width - 1);
+                    row[x] = colors[source_y * width + source_x];
+                }
+            }
+        }
+    }
+};
+
+/// Pack images in one texture (R8G8B8A8), the sprite ids are the image indexes
+///
+/// NOTE: The sprites are copied in parallel, the texture is uploaded on the calling thread
+pub fn LoadSpriteAtlas(images: []const rl.Image, params: Params) !*SpriteAtlas {
+    if (images.len == 0) return error.invalid_images;
+    if (params.max_size < 1 or params.max_size > SPRITE_ATLAS_MAX_SIZE or !std.math.isPowerOfTwo(params.max_size)) return error.invalid_max_size;
+
+    for (images) |image| {
+        if (image.data == null or image.width <= 0 or image.height <= 0) return error.invalid_images;
+    }
+
+    const cells = try allocator.alloc(Rect, images.len);
+    defer allocator.free(cells);
+
+    const size = try pack(images, params, cells);
+
+    const pixels: [*]rl.Color = @ptrCast(@alignCast(rl.MemAlloc(@intCast(size.width * size.height * @sizeOf(rl.Color))) orelse return error.OutOfMemory));
+
+    var atlas_image = rl.Image{
+        .data = pixels,
+        .width = @intCast(size.width),
+        .height = @intCast(size.height),
+        .mipmaps = 1,
+        .format = rl.PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+    };
+    defer rl.UnloadImage(atlas_image);
+
+    var job = BlitJob{
+        .images = images,
+        .cells = cells,
+        .padding = params.padding,
+        .pixels = pixels,
+        .stride = size.width,
+    };
+    workers.parallel_for(images.len, 1, &job, BlitJob.run);
+    if (job.failed.load(.monotonic)) return error.OutOfMemory;
+
+    if (params.mipmaps) try image_process.ImageMipmaps(&atlas_image);
+
+    const sprites = try allocator.alloc(rl.Rectangle, images.len);
+    errdefer allocator.free(sprites);
+
+    var used: usize = 0;
+    for (sprites, images, cells) |*sprite, image, cell| {
+        sprite.* = .{
+            .x = @floatFromInt(cell.x + params.padding),
+            .y = @floatFromInt(cell.y + params.padding),
+            .width = @floatFromInt(image.width),
+            .height = @floatFromInt(image.height),
+        };
+        used += cell.width * cell.height;
+    }
+
+    const texture = rl.LoadTextureFromImage(atlas_image);
+    if (!rl.IsTextureValid(texture)) return error.invalid_texture;
+    errdefer rl.UnloadTexture(texture);
+
+    rl.SetTextureFilter(texture, params.filter);
+
+    const self = try allocator.create(SpriteAtlas);
+    self.* = .{
+        .texture = texture,
+        .sprites = sprites,
+        .occupancy = @as(f32, @floatFromInt(used)) / @as(f32, @floatFromInt(size.width * size.height)),
+    };
+
+    utils.TRACELOG(rl.LOG_INFO, "TEXTURE: [ID %i] Sprite atlas loaded (%i sprites, %ix%i)", .{ texture.id, @as(c_int, @intCast(images.len)), texture.width, texture.height });
+
+    return self;
+}
+
+pub fn UnloadSpriteAtlas(atlas: *SpriteAtlas) void {
+    atlas.unload();
+}
@@ -0,0 +1,466 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+const utils = @import("./utils.zig");
+const workers = @import("./workers.zig");
+const scene = @import("./scene.zig");
+
+pub const allocator = rl.allocator;
+
+/// Quads per chunk side at most (the chunk vertices must fit 16 bit indices)
+pub const TERRAIN_MAX_CHUNK_SIZE = 128;
+
+/// Level of detail levels at most, each one halves the resolution of the previous one
+pub const TERRAIN_MAX_LOD_LEVELS = 6;
+
+pub const Params = struct {
+    /// Extent of the terrain (x and z) and maximum height (y), as in GenMeshHeightmap
+    size: rl.Vector3,
+    /// Corner of the terrain at height 0
+    position: rl.Vector3 = .{},
+    /// Quads per chunk side at the full resolution, a power of 2
+    chunk_size: usize = 64,
+    lod_levels: usize = 4,
+    /// Depth of the skirts hanging from the chunk edges, they hide the cracks between levels
+    skirt_depth: f32 = 1.0,
+};
+
+/// Terrain draw statistics (last draw)
+pub const TerrainStats = struct {
+    chunks: c_uint = 0,
+    drawn: c_uint = 0,
+    culled: c_uint = 0,
+    triangles: c_uint = 0,
+};
+
+const Chunk = struct {
+    /// First sample (x, z) of the chunk
+    x: usize,
+    z: usize,
+    /// World space bounds
+    bounds: rl.BoundingBox,
+    /// One mesh per level of detail
+    meshes: [TERRAIN_MAX_LOD_LEVELS]rl.Mesh,
+};
+
+/// Heightmap split in chunks with several levels of detail, drawn with frustum culling in one call
+pub const Terrain = struct {
+    params: Params,
+    /// Sample count on x and z
+    width: usize,
+    depth: usize,
+    /// World space heights of the samples (relative to the position)
+    heights: []f32,
+    chunks: []Chunk,
+    chunks_x: usize,
+    chunks_z: usize,
+    stats: TerrainStats = .{},
+    /// The meshes were unloaded (freed), the heights are still there
+    unloaded: bool = false,
+
+    /// Release the CPU memory, the meshes must be unloaded before
+    pub fn deinit(self: *Terrain) void {
+        allocator.free(self.heights);
+        allocator.free(self.chunks);
+        allocator.destroy(self);
+    }
+
+    /// Release the meshes
+    pub fn unload(self: *Terrain) void {
+        for (self.chunks) |*chunk| {
+            for (chunk.meshes[0..self.params.lod_levels]) |*mesh| {
+                rl.UnloadMesh(mesh.*);
+                mesh.* = std.mem.zeroes(rl.Mesh);
+            }
+        }
+        self.unloaded = true;
+    }
+
+    fn get_scale(self: *const Terrain) rl.Vector2 {
+        return .{
+            .x = self.params.size.x / @as(f32, @floatFromInt(self.width - 1)),
+            .y = self.params.size.z / @as(f32, @floatFromInt(self.depth - 1)),
+        };
+    }
+
+    fn sample(self: *const Terrain, x: usize, z: usize) f32 {
+        return self.heights[@min(z, self.depth - 1) * self.width + @min(x, self.width - 1)];
+    }
+
+    /// Normal of a sample from the central differences of the heights
+    fn sample_normal(self: *const Terrain, x: usize, z: usize) rl.Vector3 {
+        const scale = self.get_scale();
+
+        const left = self.sample(x -| 1, z);
+        const right = self.sample(x + 1, z);
+        const back = self.sample(x, z -| 1);
+        const front = self.sample(x, z + 1);
+
+        const dx = @as(f32, @floatFromInt(@min(x + 1, self.width - 1) - (x -| 1))) * scale.x;
+        const dz = @as(f32, @floatFromInt(@min(z + 1, self.depth - 1) - (z -| 1))) * scale.y;
+
+        return rl.Vector3Normalize(.{
+            .x = -(right - left) / dx,
+            .y = 1.0,
+            .z = -(front - back) / dz,
+        });
+    }
+
+    /// Cell of a world position and the position inside it (clamped to the terrain)
+    fn locate(self: *const Terrain, x: f32, z: f32) struct { x: usize, z: usize, fx: f32, fz: f32 } {
+        const scale = self.get_scale();
+
+        const max_x: f32 = @floatFromInt(self.width - 1);
+        const max_z: f32 = @floatFromInt(self.depth - 1);
+        const gx = std.math.clamp((x - self.params.position.x) / scale.x, 0.0, max_x);
+        const gz = std.math.clamp((z - self.params.position.z) / scale.y, 0.0, max_z);
+
+        const cx: usize = @intFromFloat(@min(@floor(gx), max_x - 1.0));
+        const cz: usize = @intFromFloat(@min(@floor(gz), max_z - 1.0));
+
+        return .{ .x = cx, .z = cz, .fx = gx - @as(f32, @floatFromInt(cx)), .fz = gz - @as(f32, @floatFromInt(cz)) };
+    }
+
+    /// World height at a position, on the full resolution triangles (clamped to the terrain edges)
+    pub fn get_height(self: *const Terrain, x: f32, z: f32) f32 {
+        const cell = self.locate(x, z);
+
+        const h00 = self.sample(cell.x, cell.z);
+        const h10 = self.sample(cell.x + 1, cell.z);
+        const h01 = self.sample(cell.x, cell.z + 1);
+        const h11 = self.sample(cell.x + 1, cell.z + 1);
+
+        // Same split as the meshes: (00, 01, 10) and (10, 01, 11)
+        const height = if (cell.fx + cell.fz <= 1.0)
+            h00 + (h10 - h00) * cell.fx + (h01 - h00) * cell.fz
+        else
+            h11 + (h01 - h11) * (1.0 - cell.fx) + (h10 - h11) * (1.0 - cell.fz);
+
+        return self.params.position.y + height;
+    }
+
+    /// Smooth normal at a position (interpolated between the sample normals)
+    pub fn get_normal(self: *const Terrain, x: f32, z: f32) rl.Vector3 {
+        const cell = self.locate(x, z);
+
+        const n00 = self.sample_normal(cell.x, cell.z);
+        const n10 = self.sample_normal(cell.x + 1, cell.z);
+        const n01 = self.sample_normal(cell.x, cell.z + 1);
+        const n11 = self.sample_normal(cell.x + 1, cell.z + 1);
+
+        const top = rl.Vector3Lerp(n00, n10, cell.fx);
+        const bottom = rl.Vector3Lerp(n01, n11, cell.fx);
+
+        return rl.Vector3Normalize(rl.Vector3Lerp(top, bottom, cell.fz));
+    }
+
+    /// Level of detail of a chunk, each level covers twice the distance of the previous one
+    fn select_lod(self: *const Terrain, chunk: *const Chunk, camera_position: rl.Vector3, lod_distance: f32) usize {
+        const nearest = rl.Vector3Clamp(camera_position, chunk.bounds.min, chunk.bounds.max);
+        const distance = rl.Vector3Distance(camera_position, nearest);
+
+        var level: usize = 0;
+        var threshold = lod_distance;
+        while (level + 1 < self.params.lod_levels and distance > threshold) {
+            level += 1;
+            threshold *= 2.0;
+        }
+        return level;
+    }
+
+    /// Cull the chunks against the camera frustum and draw each visible chunk at its level of detail
+    ///
+    /// NOTE: Must be called inside BeginMode3D() with the same camera
+    pub fn draw(self: *Terrain, camera: rl.Camera3D, material: rl.Material, lod_distance: f32) !TerrainStats {
+        if (self.unloaded) return error.terrain_unloaded;
+
+        const frustum = scene.Frustum.from_camera(camera);
+        const transform = rl.MatrixTranslate(self.params.position.x, self.params.position.y, self.params.position.z);
+
+        var stats = TerrainStats{ .chunks = @intCast(self.chunks.len) };
+
+        for (self.chunks) |*chunk| {
+            if (!frustum.contains_box(chunk.bounds)) {
+                stats.culled += 1;
+                continue;
+            }
+
+            const mesh = chunk.meshes[self.select_lod(chunk, camera.position, lod_distance)];
+            rl.DrawMesh(mesh, material, transform);
+
+            stats.drawn += 1;
+            stats.triangles += @intCast(mesh.triangleCount);
+        }
+
+        self.stats = stats;
+
+        return stats;
+    }
+};
+
+////////////////
+//  Building  //
+////////////////
+
+const BuildContext = struct {
+    terrain: *Terrain,
+    meshes: []rl.Mesh,
+    failed: std.atomic.Value(bool) = std.atomic.Value(bool).init(false),
+};
+
+/// Build the CPU side of the meshes (job = chunk * lod_levels + level)
+fn build_meshes(context: *BuildContext, start: usize, end: usize) void {
+    for (start..end) |job| {
+        const terrain = context.terrain;
+        const chunk = &terrain.chunks[job / terrain.params.lod_levels];
+        const level = job % terrain.params.lod_levels;
+
+        context.meshes[job] = build_mesh(terrain, chunk, level) catch {
+            context.failed.store(true, .monotonic);
+            continue;
+        };
+    }
+}
+
+/// Release the CPU side of a mesh, UnloadMesh also releases the GL objects (not allowed on the workers)
+fn free_mesh_data(mesh: *rl.Mesh) void {
+    rl.MemFree(mesh.vertices);
+    rl.MemFree(mesh.normals);
+    rl.MemFree(mesh.texcoords);
+    rl.MemFree(mesh.indices);
+    mesh.vertices = null;
+    mesh.normals = null;
+    mesh.texcoords = null;
+    mesh.indices = null;
+}
+
+/// Grid of the chunk samples at a level, with the skirts (edge vertices lowered by skirt_depth)
+fn build_mesh(terrain: *const Terrain, chunk: *const Chunk, level: usize) !rl.Mesh {
+    const step = @as(usize, 1) << @intCast(level);
+    const side = terrain.params.chunk_size / step + 1;
+    const scale = terrain.get_scale();
+
+    const grid_vertices = side * side;
+    const skirt_vertices = 4 * side;
+    const vertex_count = grid_vertices + skirt_vertices;
+    // Two triangles per quad, four per skirt segment (double sided)
+    const triangle_count = (side - 1) * (side - 1) * 2 + 4 * (side - 1) * 4;
+
+    var mesh = std.mem.zeroes(rl.Mesh);
+    errdefer free_mesh_data(&mesh);
+
+    mesh.vertexCount = @intCast(vertex_count);
+    mesh.triangleCount = @intCast(triangle_count);
+    mesh.vertices = @ptrCast(@alignCast(rl.MemAlloc(@intCast(vertex_count * 3 * @sizeOf(f32))) orelse return error.OutOfMemory));
+    mesh.normals = @ptrCast(@alignCast(rl.MemAlloc(@intCast(vertex_count * 3 * @sizeOf(f32))) orelse return error.OutOfMemory));
+    mesh.texcoords = @ptrCast(@alignCast(rl.MemAlloc(@intCast(vertex_count * 2 * @sizeOf(f32))) orelse return error.OutOfMemory));
+    mesh.indices = @ptrCast(@alignCast(rl.MemAlloc(@intCast(triangle_count * 3 * @sizeOf(c_ushort))) orelse return error.OutOfMemory));
+
+    const max_u: f32 = @floatFromInt(terrain.width - 1);
+    const max_v: f32 = @floatFromInt(terrain.depth - 1);
+
+    const set_vertex = struct {
+        fn call(m: *rl.Mesh, t: *const Terrain, s: rl.Vector2, index: usize, x: usize, z: usize, drop: f32, mu: f32, mv: f32) void {
+            // Samples past the last one are clamped, the extra quads are degenerate
+            const sx = @min(x, t.width - 1);
+            const sz = @min(z, t.depth - 1);
+            const normal = t.sample_normal(sx, sz);
+
+            m.vertices[index * 3 + 0] = @as(f32, @floatFromInt(sx)) * s.x;
+            m.vertices[index * 3 + 1] = t.sample(sx, sz) - drop;
+            m.vertices[index * 3 + 2] = @as(f32, @floatFromInt(sz)) * s.y;
+            m.normals[index * 3 + 0] = normal.x;
+            m.normals[index * 3 + 1] = normal.y;
+            m.normals[index * 3 + 2] = normal.z;
+            m.texcoords[index * 2 + 0] = @as(f32, @floatFromInt(sx)) / mu;
+            m.texcoords[index * 2 + 1] = @as(f32, @floatFromInt(sz)) / mv;
+        }
+    }.call;
+
+    // Grid
+
+    for (0..side) |j| {
+        for (0..side) |i| {
+            set_vertex(&mesh, terrain, scale, j * side + i, chunk.x + i * step, chunk.z + j * step, 0.0, max_u, max_v);
+        }
+    }
+
+    // Skirts: back edge, front edge, left edge, right edge
+
+    const edges = [4][2]usize{ .{ 0, 1 }, .{ (side - 1) * side, 1 }, .{ 0, side }, .{ side - 1, side } };
+    for (edges, 0..) |edge, k| {
+        for (0..side) |i| {
+            const top = edge[0] + i * edge[1];
+            set_vertex(&mesh, terrain, scale, grid_vertices + k * side + i, chunk.x + (top % side) * step, chunk.z + (top / side) * step, terrain.params.skirt_depth, max_u, max_v);
+        }
+    }
+
+    // Indices
+
+    var n: usize = 0;
+    const emit = struct {
+        fn call(indices: [*c]c_ushort, count: *usize, a: usize, b: usize, c: usize) void {
+            indices[count.* + 0] = @intCast(a);
+            indices[count.* + 1] = @intCast(b);
+            indices[count.* + 2] = @intCast(c);
+            count.* += 3;
+        }
+    }.call;
+
+    for (0..side - 1) |j| {
+        for (0..side - 1) |i| {
+            const v00 = j * side + i;
+            const v10 = v00 + 1;
+            const v01 = v00 + side;
+            const v11 = v01 + 1;
+            emit(mesh.indices, &n, v00, v01, v10);
+            emit(mesh.indices, &n, v10, v01, v11);
+        }
+    }
+
+    for (edges, 0..) |edge, k| {
+        for (0..side - 1) |i| {
+            const top_a = edge[0] + i * edge[1];
+            const top_b = top_a + edge[1];
+            const bottom_a = grid_vertices + k * side + i;
+            const bottom_b = bottom_a + 1;
+            emit(mesh.indices, &n, top_a, bottom_a, top_b);
+            emit(mesh.indices, &n, top_b, bottom_a, bottom_b);
+            emit(mesh.indices, &n, top_a, top_b, bottom_a);
+            emit(mesh.indices, &n, top_b, bottom_b, bottom_a);
+        }
+    }
+
+    std.debug.assert(n == triangle_count * 3);
+
+    return mesh;
+}
+
+/// Heights from the image: 32 bit grayscale as is, other formats as the gray value of the colors (as GenMeshHeightmap)
+fn load_heights(image: rl.Image, max_height: f32) ![]f32 {
+    const count: usize = @intCast(image.width * image.height);
+
+    const heights = try allocator.alloc(f32, count);
+    errdefer allocator.free(heights);
+
+    if (image.format == rl.PIXELFORMAT_UNCOMPRESSED_R32) {
+        const values: [*]const f32 = @ptrCast(@alignCast(image.data orelse return error.invalid_heightmap));
+        for (heights, values[0..count]) |*height, value| height.* = value * max_height;
+        return heights;
+    }
+
+    const colors = rl.LoadImageColors(image);
+    if (colors == null) return error.invalid_heightmap;
+    defer rl.UnloadImageColors(colors);
+
+    for (heights, colors[0..count]) |*height, color| {
+        const gray: f32 = @floatFromInt((@as(u32, color.r) + color.g + color.b) / 3);
+        height.* = gray / 255.0 * max_height;
+    }
+
+    return heights;
+}
+
+/// Split a heightmap in chunks and build their levels of detail on the worker pool
+///
+/// NOTE: The meshes are uploaded on the calling thread, their CPU copies are released after
+pub fn LoadTerrain(heightmap: rl.Image, params: Params) !*Terrain {
+    if (heightmap.width < 2 or heightmap.height < 2 or heightmap.data == null) return error.invalid_heightmap;
+    if (params.chunk_size < 2 or params.chunk_size > TERRAIN_MAX_CHUNK_SIZE or !std.math.isPowerOfTwo(params.chunk_size)) return error.invalid_chunk_size;
+    if (params.lod_levels < 1 or params.lod_levels > TERRAIN_MAX_LOD_LEVELS or (params.chunk_size >> @intCast(params.lod_levels - 1)) < 1) return error.invalid_lod_levels;
+
+    const width: usize = @intCast(heightmap.width);
+    const depth: usize = @intCast(heightmap.height);
+
+    const self = try allocator.create(Terrain);
+    errdefer allocator.destroy(self);
+
+    self.* = .{
+        .params = params,
+        .width = width,
+        .depth = depth,
+        .heights = try load_heights(heightmap, params.size.y),
+        .chunks = &.{},
+        .chunks_x = std.math.divCeil(usize, width - 1, params.chunk_size) catch unreachable,
+        .chunks_z = std.math.divCeil(usize, depth - 1, params.chunk_size) catch unreachable,
+    };
+    errdefer allocator.free(self.heights);
+
+    self.chunks = try allocator.alloc(Chunk, self.chunks_x * self.chunks_z);
+    errdefer allocator.free(self.chunks);
+
+    const scale = self.get_scale();
+
+    for (0..self.chunks_z) |cz| {
+        for (0..self.chunks_x) |cx| {
+            const x = cx * params.chunk_size;
+            const z = cz * params.chunk_size;
+            const x_end = @min(x + params.chunk_size, width - 1);
+            const z_end = @min(z + params.chunk_size, depth - 1);
+
+            var min_height = std.math.floatMax(f32);
+            var max_height = -std.math.floatMax(f32);
+            for (z..z_end + 1) |sz| {
+                for (x..x_end + 1) |sx| {
+                    const height = self.sample(sx, sz);
+                    min_height = @min(min_height, height);
+                    max_height = @max(max_height, height);
+                }
+            }
+
+            self.chunks[cz * self.chunks_x + cx] = .{
+                .x = x,
+                .z = z,
+                .bounds = .{
+                    .min = .{
+                        .x = params.position.x + @as(f32, @floatFromInt(x)) * scale.x,
+                        .y = params.position.y + min_height - params.skirt_depth,
+                        .z = params.position.z + @as(f32, @floatFromInt(z)) * scale.y,
+                    },
+                    .max = .{
+                        .x = params.position.x + @as(f32, @floatFromInt(x_end)) * scale.x,
+                        .y = params.position.y + max_height,
+                        .z = params.position.z + @as(f32, @floatFromInt(z_end)) * scale.y,
+                    },
+                },
+                .meshes = std.mem.zeroes([TERRAIN_MAX_LOD_LEVELS]rl.Mesh),
+            };
+        }
+    }
+
+    // CPU side on the worker pool
+
+    const meshes = try allocator.alloc(rl.Mesh, self.chunks.len * params.lod_levels);
+    defer allocator.free(meshes);
+    @memset(meshes, std.mem.zeroes(rl.Mesh));
+
+    var context = BuildContext{ .terrain = self, .meshes = meshes };
+    workers.parallel_for(meshes.len, 1, &context, build_meshes);
+
+    if (context.failed.load(.monotonic)) {
+        for (meshes) |*mesh| free_mesh_data(mesh);
+        return error.OutOfMemory;
+    }
+
+    // Upload on the calling thread, the GPU buffers are all the terrain needs to draw
+
+    var vertex_count: usize = 0;
+    for (meshes, 0..) |*mesh, job| {
+        rl.UploadMesh(mesh, false);
+        vertex_count += @intCast(mesh.vertexCount);
+        free_mesh_data(mesh);
+
+        self.chunks[job / params.lod_levels].meshes[job % params.lod_levels] = mesh.*;
+    }
+
+    utils.TRACELOG(rl.LOG_INFO, "TERRAIN: Loaded %i chunks with %i levels of detail (%i vertices)", .{
+        @as(c_int, @intCast(self.chunks.len)),
+        @as(c_int, @intCast(params.lod_levels)),
+        @as(c_int, @intCast(vertex_count)),
+    });
+
+    return self;
+}
+
+pub fn UnloadTerrain(terrain: *Terrain) void {
+    terrain.unload();
+}
@@ -0,0 +1,349 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+const utils = @import("./utils.zig");
+
+const build_config = @import("config");
+
+pub const allocator = rl.allocator;
+
+/// The OpenGL buffer functions are loaded through GLFW, other platforms use direct uploads
+const is_supported = build_config.platform_glfw;
+
+const glfw = if (is_supported) @cImport({
+    @cDefine("GLFW_INCLUDE_NONE", "1");
+    @cInclude("external/glfw/include/GLFW/glfw3.h");
+}) else struct {};
+
+/// Maximum number of pixel buffers in the ring
+pub const TEXTURE_STREAM_MAX_BUFFERS: usize = 8;
+
+/// Default number of pixel buffers in the ring
+pub const TEXTURE_STREAM_DEFAULT_BUFFERS: usize = 3;
+
+// OpenGL definitions not exposed by rlgl
+const GL_PIXEL_UNPACK_BUFFER: c_uint = 0x88EC;
+const GL_STREAM_DRAW: c_uint = 0x88E0;
+const GL_MAP_WRITE_BIT: c_uint = 0x0002;
+const GL_MAP_INVALIDATE_BUFFER_BIT: c_uint = 0x0008;
+const GL_MAP_UNSYNCHRONIZED_BIT: c_uint = 0x0020;
+const GL_MAP_PERSISTENT_BIT: c_uint = 0x0040;
+const GL_MAP_COHERENT_BIT: c_uint = 0x0080;
+const GL_SYNC_GPU_COMMANDS_COMPLETE: c_uint = 0x9117;
+const GL_SYNC_FLUSH_COMMANDS_BIT: c_uint = 0x0001;
+const GL_ALREADY_SIGNALED: c_uint = 0x911A;
+const GL_CONDITION_SATISFIED: c_uint = 0x911C;
+const GL_WAIT_FAILED: c_uint = 0x911D;
+
+const GLsync = ?*anyopaque;
+
+/// OpenGL functions used by the pixel buffers (field names are the OpenGL names)
+const GlFunctions = struct {
+    glGenBuffers: *const fn (n: c_int, buffers: [*]c_uint) callconv(.C) void,
+    glDeleteBuffers: *const fn (n: c_int, buffers: [*]const c_uint) callconv(.C) void,
+    glBindBuffer: *const fn (target: c_uint, buffer: c_uint) callconv(.C) void,
+    glBufferData: *const fn (target: c_uint, size: isize, data: ?*const anyopaque, usage: c_uint) callconv(.C) void,
+    glMapBufferRange: *const fn (target: c_uint, offset: isize, length: isize, access: c_uint) callconv(.C) ?*anyopaque,
+    glUnmapBuffer: *const fn (target: c_uint) callconv(.C) u8,
+    glFenceSync: *const fn (condition: c_uint, flags: c_uint) callconv(.C) GLsync,
+    glClientWaitSync: *const fn (sync: GLsync, flags: c_uint, timeout: u64) callconv(.C) c_uint,
+    glDeleteSync: *const fn (sync: GLsync) callconv(.C) void,
+};
+
+/// Only available with OpenGL 4.4 or ARB_buffer_storage
+const GlBufferStorage = *const fn (target: c_uint, size: isize, data: ?*const anyopaque, flags: c_uint) callconv(.C) void;
+
+var gl: GlFunctions = undefined;
+var gl_buffer_storage: ?GlBufferStorage = null;
+var gl_state: enum { not_loaded, loaded, unavailable } = .not_loaded;
+
+/// Load the OpenGL functions (requires the OpenGL context)
+fn LoadGlFunctions() bool {
+    if (comptime !is_supported) {
+        return false;
+    } else {
+        if (gl_state != .not_loaded) return gl_state == .loaded;
+        gl_state = .unavailable;
+
+        // Mapped buffers and fences require OpenGL 3.3 or OpenGL ES 3.0
+        switch (rl.rlGetVersion()) {
+            rl.RL_OPENGL_33, rl.RL_OPENGL_43, rl.RL_OPENGL_ES_30 => {},
+            else => return false,
+        }
+
+        inline for (@typeInfo(GlFunctions).@"struct".fields) |field| {
+            const proc = glfw.glfwGetProcAddress(field.name) orelse return false;
+            @field(gl, field.name) = @ptrCast(proc);
+        }
+
+        if (glfw.glfwExtensionSupported("GL_ARB_buffer_storage") != 0) {
+            if (glfw.glfwGetProcAddress("glBufferStorage")) |proc| gl_buffer_storage = @ptrCast(proc);
+        }
+
+        gl_state = .loaded;
+        return true;
+    }
+}
+
+/// How the frames reach the texture
+pub const TextureStreamMode = enum {
+    /// Persistently mapped pixel buffers, the frame is copied once into the buffer
+    persistent,
+    /// Pixel buffers mapped on each update (unsynchronized, the ring is guarded by fences)
+    mapped,
+    /// Synchronous texture update (without pixel buffers)
+    direct,
+};
+
+pub const TextureStreamStats = struct {
+    uploaded: u64 = 0,
+    dropped: u64 = 0,
+    latency_last_us: u64 = 0,
+    latency_total_us: u64 = 0,
+    latency_count: u64 = 0,
+
+    pub fn latency_average_us(self: TextureStreamStats) u64 {
+        if (self.latency_count == 0) return 0;
+        return self.latency_total_us / self.latency_count;
+    }
+};
+
+const TextureStreamBuffer = struct {
+    id: c_uint = 0,
+    mapping: ?[*]u8 = null,
+    fence: GLsync = null,
+    submitted: i128 = 0,
+};
+
+/// Texture updated every frame from a ring of pixel buffers
+///
+/// The frame is written to the next free buffer and copied to the texture by the GPU
+/// asynchronously, a fence per buffer tells when it can be written again.
+/// When all the buffers are still in use the frame is dropped instead of stalling.
+pub const TextureStream = struct {
+    lock: std.Thread.Mutex = .{},
+    texture: rl.Texture2D,
+    frame_size: usize,
+    mode: TextureStreamMode,
+    buffers: [TEXTURE_STREAM_MAX_BUFFERS]TextureStreamBuffer = [_]TextureStreamBuffer{.{}} ** TEXTURE_STREAM_MAX_BUFFERS,
+    buffer_count: usize,
+    next: usize = 0,
+    stats: TextureStreamStats = .{},
+
+    pub fn init(width: c_int, height: c_int, format: c_int, buffer_count: usize) !*TextureStream {
+        if (width <= 0 or height <= 0) return error.invalid_texture_stream;
+        if (format < rl.PIXELFORMAT_UNCOMPRESSED_GRAYSCALE or format >= rl.PIXELFORMAT_COMPRESSED_DXT1_RGB) return error.invalid_texture_stream;
+        if (buffer_count < 1 or buffer_count > TEXTURE_STREAM_MAX_BUFFERS) return error.invalid_texture_stream;
+
+        const id = rl.rlLoadTexture(null, width, height, format, 1);
+        if (id == 0) return error.texture_load_failed;
+        errdefer rl.rlUnloadTexture(id);
+
+        const self = try allocator.create(TextureStream);
+        errdefer allocator.destroy(self);
+
+        self.* = TextureStream{
+            .texture = rl.Texture2D{
+                .id = id,
+                .width = width,
+                .height = height,
+                .mipmaps = 1,
+                .format = format,
+            },
+            .frame_size = @intCast(rl.GetPixelDataSize(width, height, format)),
+            .mode = .direct,
+            .buffer_count = buffer_count,
+        };
+
+        if (LoadGlFunctions()) {
+            if (gl_buffer_storage != null and self.create_buffers(.persistent)) {
+                self.mode = .persistent;
+            } else if (self.create_buffers(.mapped)) {
+                self.mode = .mapped;
+            }
+        }
+
+        utils.TRACELOG(rl.LOG_INFO, "TEXTURE: [ID %i] Texture stream loaded (%i buffers, %s)", .{ id, @as(c_int, @intCast(buffer_count)), @tagName(self.mode).ptr });
+
+        return self;
+    }
+
+    /// Release the CPU memory, the OpenGL objects must be unloaded before
+    pub fn deinit(self: *TextureStream) void {
+        allocator.destroy(self);
+    }
+
+    fn create_buffers(self: *TextureStream, mode: TextureStreamMode) bool {
+        var ids: [TEXTURE_STREAM_MAX_BUFFERS]c_uint = [_]c_uint{0} ** TEXTURE_STREAM_MAX_BUFFERS;
+        gl.glGenBuffers(@intCast(self.buffer_count), &ids);
+
+        const size: isize = @intCast(self.frame_size);
+
+        for (self.buffers[0..self.buffer_count], ids[0..self.buffer_count]) |*buffer, id| {
+            buffer.* = .{ .id = id };
+            if (id == 0) break;
+
+            gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, id);
+
+            if (mode == .persistent) {
+                const flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                gl_buffer_storage.?(GL_PIXEL_UNPACK_BUFFER, size, null, flags);
+                buffer.mapping = @ptrCast(gl.glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags) orelse break);
+            } else {
+                gl.glBufferData(GL_PIXEL_UNPACK_BUFFER, size, null, GL_STREAM_DRAW);
+            }
+        } else {
+            gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            return true;
+        }
+
+        // Failed, the buffers are released to try the next mode
+        self.release_buffers();
+        gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return false;
+    }
+
+    fn release_buffers(self: *TextureStream) void {
+        for (self.buffers[0..self.buffer_count]) |*buffer| {
+            if (buffer.fence != null) gl.glDeleteSync(buffer.fence);
+
+            if (buffer.mapping != null) {
+                gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+                _ = gl.glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            }
+
+            if (buffer.id != 0) gl.glDeleteBuffers(1, @ptrCast(&buffer.id));
+
+            buffer.* = .{};
+        }
+    }
+
+    /// Release the texture and the pixel buffers
+    pub fn unload(self: *TextureStream) void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        if (self.mode != .direct) {
+            self.release_buffers();
+            gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            self.mode = .direct;
+        }
+
+        if (self.texture.id != 0) {
+            rl.rlUnloadTexture(self.texture.id);
+            self.texture.id = 0;
+        }
+    }
+
+    fn record_latency(self: *TextureStream, latency_ns: i128) void {
+        const latency_us: u64 = @intCast(@divTrunc(@max(latency_ns, 0), std.time.ns_per_us));
+        self.stats.latency_last_us = latency_us;
+        self.stats.latency_total_us += latency_us;
+        self.stats.latency_count += 1;
+    }
+
+    /// Texture of the stream (id 0 once unloaded)
+    pub fn get_texture(self: *TextureStream) rl.Texture2D {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        return self.texture;
+    }
+
+    pub fn get_mode(self: *TextureStream) TextureStreamMode {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        return self.mode;
+    }
+
+    /// Poll the buffers and get the statistics
+    pub fn get_stats(self: *TextureStream) TextureStreamStats {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        self.poll();
+        return self.stats;
+    }
+
+    /// Release the buffers the GPU is done with (the stream must be locked)
+    ///
+    /// The latency (from the write until the GPU copied the buffer) is measured here,
+    /// so its precision depends on how often the stream is polled (each update and stats)
+    fn poll(self: *TextureStream) void {
+        if (self.mode == .direct) return;
+
+        const now = std.time.nanoTimestamp();
+
+        for (self.buffers[0..self.buffer_count]) |*buffer| {
+            if (buffer.fence == null) continue;
+
+            const status = gl.glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            if (status == GL_ALREADY_SIGNALED or status == GL_CONDITION_SATISFIED) {
+                self.record_latency(now - buffer.submitted);
+            } else if (status != GL_WAIT_FAILED) {
+                continue;
+            }
+
+            gl.glDeleteSync(buffer.fence);
+            buffer.fence = null;
+        }
+    }
+
+    /// Upload a frame, returns false if the frame was dropped (all the buffers in use)
+    pub fn update(self: *TextureStream, pixels: []const u8) !bool {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        if (self.texture.id == 0) return error.texture_stream_unloaded;
+        if (pixels.len < self.frame_size) return error.invalid_frame_size;
+
+        const start = std.time.nanoTimestamp();
+        const texture = self.texture;
+
+        if (self.mode == .direct) {
+            rl.rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels.ptr);
+            self.record_latency(std.time.nanoTimestamp() - start);
+            self.stats.uploaded += 1;
+            return true;
+        }
+
+        self.poll();
+
+        const buffer = &self.buffers[self.next];
+        if (buffer.fence != null) {
+            self.stats.dropped += 1;
+            return false;
+        }
+
+        gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+        defer gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        if (self.mode == .persistent) {
+            @memcpy(buffer.mapping.?[0..self.frame_size], pixels[0..self.frame_size]);
+        } else {
+            const access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+            const mapping: [*]u8 = @ptrCast(gl.glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, @intCast(self.frame_size), access) orelse return error.buffer_map_failed);
+            @memcpy(mapping[0..self.frame_size], pixels[0..self.frame_size]);
+            _ = gl.glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        }
+
+        // With a pixel buffer bound the data pointer is an offset in the buffer
+        rl.rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, null);
+
+        buffer.fence = gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        buffer.submitted = start;
+
+        self.next = (self.next + 1) % self.buffer_count;
+        self.stats.uploaded += 1;
+
+        return true;
+    }
+};
+
+pub fn LoadTextureStream(width: c_int, height: c_int, format: c_int, buffer_count: usize) !*TextureStream {
+    return TextureStream.init(width, height, format, buffer_count);
+}
+
+pub fn UnloadTextureStream(stream: *TextureStream) void {
+    stream.unload();
+}
@@ -5,6 +5,18 @@ const rl = @import("./raylib.zig");
 const utils = @import("./utils.zig");
 
 const resources = @import("./resources.zig");
+const memory = @import("./memory.zig");
+const reclaim = @import("./reclaim.zig");
+const scene = @import("./scene.zig");
+const uniform_set = @import("./uniform_set.zig");
+const image_anim = @import("./image_anim.zig");
+const asset_pack = @import("./asset_pack.zig");
+const texture_stream = @import("./texture_stream.zig");
+const display_list = @import("./display_list.zig");
+const voice_pool = @import("./voice_pool.zig");
+const terrain = @import("./terrain.zig");
+const sprite_atlas = @import("./sprite_atlas.zig");
+const replay = @import("./replay.zig");
 
 fn get_field_array_length(comptime T: type, field_name: []const u8) usize {
     return @intCast(blk: {
@@ -350,6 +362,14 @@ pub const Binary = struct {
         return @intCast(binary.size);
     }
 
+    /// Read-only view of the binary data, valid while the term is alive (no copy)
+    pub fn get_view(env: ?*e.ErlNifEnv, term: e.ErlNifTerm) ![]const u8 {
+        var binary: e.ErlNifBinary = undefined;
+        if (e.enif_inspect_binary(env, term, &binary) == 0) return error.ArgumentError;
+        if (binary.size == 0) return &[_]u8{};
+        return binary.data[0..binary.size];
+    }
+
     pub fn free(allocator: std.mem.Allocator, value: []u8) void {
         allocator.free(value);
     }
@@ -1158,6 +1178,24 @@ const Resource = struct {
 
 pub fn ResourceBase(comptime T: type) type {
     return struct {
+        /// Resource object: the pointer to the value followed by the memory accounted for it
+        const Object = extern struct {
+            value: *T.data_type,
+            usage: memory.Usage,
+            // The payload is released when the resource is garbage collected (not freed yet)
+            owned: bool,
+            // GL context of the payload (see reclaim.context)
+            context: u32,
+        };
+
+        fn get_object(resource: **T.data_type) *Object {
+            return @fieldParentPtr("value", resource);
+        }
+
+        fn get_usage(resource: **T.data_type) *memory.Usage {
+            return &get_object(resource).usage;
+        }
+
         pub fn make(env: ?*e.ErlNifEnv, resource: **T.data_type) e.ErlNifTerm {
             return Tuple.make(env, &[_]e.ErlNifTerm{ Atom.make(env, T.resource_name ++ "_resource"), Resource.make(env, @ptrCast(@alignCast(resource))) });
         }
@@ -1192,12 +1230,18 @@ pub fn ResourceBase(comptime T: type) type {
             const allocator = resources.ResourceType.allocator;
             const resource_type = @field(resources.resource_type, T.resource_name);
 
-            const resource: **T.data_type = @ptrCast(@alignCast(try Resource.create(resource_type, @sizeOf(*T.data_type))));
+            const object: *Object = @ptrCast(@alignCast(try Resource.create(resource_type, @sizeOf(Object))));
+            const resource = &object.value;
             defer utils.TRACELOGD("RESOURCE: Created %s %s", .{ T.resource_name, ptr_to_c_string(resource) });
 
             resource.* = try allocator.create(T.data_type);
             resource.*.* = value;
 
+            object.usage = memory.estimate(T, value);
+            object.owned = true;
+            object.context = reclaim.context.load(.monotonic);
+            memory.resource_created(T, object.usage);
+
             return resource;
         }
 
@@ -1205,6 +1249,9 @@ pub fn ResourceBase(comptime T: type) type {
             const resource = try get(env, term);
             defer utils.TRACELOGD("RESOURCE: Updated %s %s", .{ T.resource_name, ptr_to_c_string(resource) });
             resource.*.* = value;
+            get_object(resource).owned = true;
+            get_object(resource).context = reclaim.context.load(.monotonic);
+            account(resource);
         }
 
         pub fn replace(env: ?*e.ErlNifEnv, term: e.ErlNifTerm, value: T.data_type) !void {
@@ -1212,21 +1259,128 @@ pub fn ResourceBase(comptime T: type) type {
             defer utils.TRACELOGD("RESOURCE: Replaced %s %s", .{ T.resource_name, ptr_to_c_string(resource) });
             T.free(resource.*.*);
             resource.*.* = value;
+            get_object(resource).owned = true;
+            get_object(resource).context = reclaim.context.load(.monotonic);
+            account(resource);
         }
 
         pub fn destroy(resource: **T.data_type) void {
             defer utils.TRACELOGD("RESOURCE: Destroyed %s %s", .{ T.resource_name, ptr_to_c_string(resource) });
+            const object = get_object(resource);
+
+            memory.resource_destroyed(T, object.usage);
+
+            // The payload is unloaded later, on a thread allowed to release it
+            // (GL payloads of a closed GL context are not, their ids may be reused)
+            if (@hasDecl(T, "reclaim_kind")) {
+                const kind: ?reclaim.Kind = T.reclaim_kind;
+                if (kind) |reclaim_kind| {
+                    if (object.owned and reclaim.push(reclaim_kind, object.context, resource.*, reclaim_value, discard_value)) return;
+                }
+            }
+
+            destroy_value(resource.*);
+        }
+
+        fn reclaim_value(payload: *anyopaque) void {
+            const value: *T.data_type = @ptrCast(@alignCast(payload));
+            defer utils.TRACELOGD("RESOURCE: Reclaimed %s", .{T.resource_name});
+
+            T.unload(value.*);
+            destroy_value(value);
+        }
+
+        fn discard_value(payload: *anyopaque) void {
+            const value: *T.data_type = @ptrCast(@alignCast(payload));
+            defer utils.TRACELOGD("RESOURCE: Discarded %s", .{T.resource_name});
+
+            destroy_value(value);
+        }
+
+        fn destroy_value(value: *T.data_type) void {
             const allocator = resources.ResourceType.allocator;
-            allocator.destroy(resource.*);
+
+            // Native objects only reachable through the resource are owned by it
+            if (@hasDecl(T, "destroy")) {
+                T.destroy(value.*);
+            }
+
+            allocator.destroy(value);
         }
 
         pub fn release(resource: **T.data_type) void {
             Resource.release(@ptrCast(@alignCast(resource)));
         }
 
+        /// The payload is owned elsewhere (raylib internals), it is not reclaimed with the resource
+        pub fn disown(resource: **T.data_type) void {
+            get_object(resource).owned = false;
+        }
+
         pub fn free(resource: **T.data_type) void {
             defer utils.TRACELOGD("RESOURCE: Freed %s %s", .{ T.resource_name, ptr_to_c_string(resource) });
             T.unload(resource.*.*);
+            get_object(resource).owned = false;
+
+            // Nothing left to account for, the value is stale after unloading
+            const usage = get_usage(resource);
+            memory.resource_changed(T, usage.*, .{ .cpu_bytes = @sizeOf(T.data_type) });
+            usage.* = .{ .cpu_bytes = @sizeOf(T.data_type) };
+        }
+
+        /// Estimate the memory held by the value again after it changed
+        pub fn account(resource: **T.data_type) void {
+            const usage = get_usage(resource);
+            const new_usage = memory.estimate(T, resource.*.*);
+            memory.resource_changed(T, usage.*, new_usage);
+            usage.* = new_usage;
+        }
+    };
+}
+
+/// Resource of a native object only reachable through its pointer, it has no term representation
+///
+/// unload_fn releases the payload when the resource is freed, and when it is garbage collected on the kind
+/// reclaim queue (null kind: destroy_fn alone then), destroy_fn releases the object itself
+pub fn HandleResource(
+    comptime T: type,
+    comptime name: []const u8,
+    comptime kind: ?reclaim.Kind,
+    comptime unload_fn: ?fn (*T) void,
+    comptime destroy_fn: fn (*T) void,
+) type {
+    return struct {
+        const Self = @This();
+
+        pub const allocator = rl.allocator;
+        pub const data_type = *T;
+        pub const resource_name = name;
+        pub const reclaim_kind = kind;
+
+        pub const Resource = ResourceBase(Self);
+
+        pub fn make(env: ?*e.ErlNifEnv, value: *T) !e.ErlNifTerm {
+            const resource = try Self.Resource.create(value);
+            defer Self.Resource.release(resource);
+
+            return Self.Resource.make(env, resource);
+        }
+
+        pub fn get(env: ?*e.ErlNifEnv, term: e.ErlNifTerm) !*T {
+            return (try Self.Resource.get(env, term)).*.*;
+        }
+
+        pub fn unload(value: *T) void {
+            if (unload_fn) |unload_value| unload_value(value);
+        }
+
+        // The pointer is only borrowed from the resource
+        pub fn free(value: *T) void {
+            _ = value;
+        }
+
+        pub fn destroy(value: *T) void {
+            destroy_fn(value);
         }
     };
 }
@@ -2593,6 +2747,7 @@ pub const Image = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.Image;
     pub const resource_name = "image";
+    pub const reclaim_kind = reclaim.Kind.cpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -2729,6 +2884,7 @@ pub const Texture = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.Texture;
     pub const resource_name = "texture";
+    pub const reclaim_kind = reclaim.Kind.gpu;
     pub const resource_type_aliases = [_]resources.ResourceTypeKey{ resources.ResourceTypeKey.texture_2d, resources.ResourceTypeKey.texture_cubemap };
 
     pub const Resource = ResourceBase(Self);
@@ -2825,6 +2981,7 @@ pub const Texture2D = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.Texture2D;
     pub const resource_name = "texture_2d";
+    pub const reclaim_kind = reclaim.Kind.gpu;
     pub const resource_type_aliases = [_]resources.ResourceTypeKey{ resources.ResourceTypeKey.texture, resources.ResourceTypeKey.texture_cubemap };
 
     pub const Resource = ResourceBase(Self);
@@ -2921,6 +3078,7 @@ pub const TextureCubemap = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.TextureCubemap;
     pub const resource_name = "texture_cubemap";
+    pub const reclaim_kind = reclaim.Kind.gpu;
     pub const resource_type_aliases = [_]resources.ResourceTypeKey{ resources.ResourceTypeKey.texture, resources.ResourceTypeKey.texture_2d };
 
     pub const Resource = ResourceBase(Self);
@@ -3017,6 +3175,7 @@ pub const RenderTexture = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.RenderTexture;
     pub const resource_name = "render_texture";
+    pub const reclaim_kind = reclaim.Kind.gpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -3096,6 +3255,7 @@ pub const RenderTexture2D = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.RenderTexture2D;
     pub const resource_name = "render_texture_2d";
+    pub const reclaim_kind = reclaim.Kind.gpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -3379,6 +3539,7 @@ pub const Font = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.Font;
     pub const resource_name = "font";
+    pub const reclaim_kind = reclaim.Kind.gpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -3796,6 +3957,7 @@ pub const Mesh = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.Mesh;
     pub const resource_name = "mesh";
+    pub const reclaim_kind = reclaim.Kind.gpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -4112,6 +4274,7 @@ pub const Shader = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.Shader;
     pub const resource_name = "shader";
+    pub const reclaim_kind = reclaim.Kind.gpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -4507,6 +4670,7 @@ pub const Model = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.Model;
     pub const resource_name = "model";
+    pub const reclaim_kind = reclaim.Kind.gpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -4727,6 +4891,7 @@ pub const ModelAnimation = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.ModelAnimation;
     pub const resource_name = "model_animation";
+    pub const reclaim_kind = reclaim.Kind.cpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -5065,6 +5230,7 @@ pub const Wave = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.Wave;
     pub const resource_name = "wave";
+    pub const reclaim_kind = reclaim.Kind.cpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -5522,6 +5688,8 @@ pub const Sound = struct {
     }
 
     pub fn unload(value: rl.Sound) void {
+        // The voices playing the samples are unloaded first, the mixer would read them
+        voice_pool.UnloadSoundVoices(value);
         rl.UnloadSound(value);
     }
 
@@ -6372,6 +6540,7 @@ pub const FilePathList = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.FilePathList;
     pub const resource_name = "file_path_list";
+    pub const reclaim_kind = reclaim.Kind.cpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -6534,6 +6703,7 @@ pub const AutomationEventList = struct {
     pub const allocator = rl.allocator;
     pub const data_type = rl.AutomationEventList;
     pub const resource_name = "automation_event_list";
+    pub const reclaim_kind = reclaim.Kind.cpu;
 
     pub const Resource = ResourceBase(Self);
 
@@ -6607,3 +6777,63 @@ pub const AutomationEventList = struct {
         rl.UnloadAutomationEventList(value);
     }
 };
+
+/////////////
+//  Scene  //
+/////////////
+
+pub const Scene = HandleResource(scene.Scene, "scene", null, scene.Scene.clear, scene.UnloadScene);
+
+//////////////////
+//  UniformSet  //
+//////////////////
+
+pub const UniformSet = HandleResource(uniform_set.UniformSet, "uniform_set", .gpu, uniform_set.UnloadUniformSet, uniform_set.UniformSet.deinit);
+
+///////////////////////
+//  ImageAnimStream  //
+///////////////////////
+
+pub const ImageAnimStream = HandleResource(image_anim.ImageAnimStream, "image_anim_stream", null, image_anim.UnloadImageAnimStreamData, image_anim.UnloadImageAnimStream);
+
+/////////////////
+//  AssetPack  //
+/////////////////
+
+pub const AssetPack = HandleResource(asset_pack.AssetPack, "asset_pack", null, asset_pack.UnloadAssetPackData, asset_pack.UnloadAssetPack);
+
+/////////////////////
+//  TextureStream  //
+/////////////////////
+
+pub const TextureStream = HandleResource(texture_stream.TextureStream, "texture_stream", .gpu, texture_stream.UnloadTextureStream, texture_stream.TextureStream.deinit);
+
+///////////////////
+//  DisplayList  //
+///////////////////
+
+pub const DisplayList = HandleResource(display_list.DisplayList, "display_list", .gpu, display_list.UnloadDisplayList, display_list.DisplayList.deinit);
+
+/////////////////
+//  VoicePool  //
+/////////////////
+
+pub const VoicePool = HandleResource(voice_pool.VoicePool, "voice_pool", .cpu, voice_pool.UnloadVoicePool, voice_pool.VoicePool.deinit);
+
+///////////////
+//  Terrain  //
+///////////////
+
+pub const Terrain = HandleResource(terrain.Terrain, "terrain", .gpu, terrain.UnloadTerrain, terrain.Terrain.deinit);
+
+///////////////////
+//  SpriteAtlas  //
+///////////////////
+
+pub const SpriteAtlas = HandleResource(sprite_atlas.SpriteAtlas, "sprite_atlas", .gpu, sprite_atlas.UnloadSpriteAtlas, sprite_atlas.SpriteAtlas.deinit);
+
+//////////////
+//  Replay  //
+//////////////
+
+pub const Replay = HandleResource(replay.Replay, "replay", .gpu, replay.UnloadReplay, replay.Replay.deinit);
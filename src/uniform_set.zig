@@ -0,0 +1,308 @@
+const std = @import("std");
+const assert = std.debug.assert;
+const rl = @import("./raylib.zig");
+
+pub const allocator = rl.allocator;
+
+/// Uniform type for mat4 uniforms (not part of rlShaderUniformDataType)
+pub const UNIFORM_MATRIX: c_int = -1;
+
+/// Size in bytes of one element of the uniform type (0 if not supported)
+pub fn GetUniformTypeSize(uniform_type: c_int) usize {
+    return switch (uniform_type) {
+        rl.RL_SHADER_UNIFORM_FLOAT, rl.RL_SHADER_UNIFORM_INT, rl.RL_SHADER_UNIFORM_UINT, rl.RL_SHADER_UNIFORM_SAMPLER2D => 4,
+        rl.RL_SHADER_UNIFORM_VEC2, rl.RL_SHADER_UNIFORM_IVEC2, rl.RL_SHADER_UNIFORM_UIVEC2 => 8,
+        rl.RL_SHADER_UNIFORM_VEC3, rl.RL_SHADER_UNIFORM_IVEC3, rl.RL_SHADER_UNIFORM_UIVEC3 => 12,
+        rl.RL_SHADER_UNIFORM_VEC4, rl.RL_SHADER_UNIFORM_IVEC4, rl.RL_SHADER_UNIFORM_UIVEC4 => 16,
+        UNIFORM_MATRIX => @sizeOf(rl.Matrix),
+        else => 0,
+    };
+}
+
+/// Uniform declaration used to build a uniform set
+pub const UniformDesc = struct {
+    name: []const u8,
+    uniform_type: c_int,
+    count: c_int = 1,
+};
+
+/// Uniform with its location resolved once and its slice of the staging buffer
+pub const Uniform = struct {
+    name: [:0]u8,
+    location: c_int,
+    uniform_type: c_int,
+    count: c_int,
+    offset: usize, // Offset in the staging buffer
+    span: usize, // Bytes in the staging buffer (padding included)
+    size: usize, // Bytes of the packed value (count elements)
+    element_size: usize,
+    stride: usize, // Bytes between the elements in the staging buffer
+    dirty: bool,
+};
+
+/// Uniform set statistics
+pub const UniformSetStats = struct {
+    uploads: u64 = 0, // Uniforms uploaded
+    skipped: u64 = 0, // Uniforms not uploaded because they were clean
+};
+
+/// Base alignment and array stride of a uniform type in a std430 shader buffer
+fn std430_layout(element_size: usize) struct { alignment: usize, stride: usize } {
+    return switch (element_size) {
+        4 => .{ .alignment = 4, .stride = 4 },
+        8 => .{ .alignment = 8, .stride = 8 },
+        // vec3 is aligned (and strided in arrays) as a vec4
+        12, 16 => .{ .alignment = 16, .stride = 16 },
+        // mat4 is an array of 4 vec4
+        else => .{ .alignment = 16, .stride = element_size },
+    };
+}
+
+/// Uniform values of a shader, staged in one buffer
+///
+/// The staging buffer is packed, or laid out as std430 when it is uploaded as a shader buffer
+///
+/// NOTE: Only the dirty uniforms are uploaded by apply(), the values stay
+/// in the GL program so they must not be changed behind the set
+pub const UniformSet = struct {
+    lock: std.Thread.Mutex = .{},
+    shader_id: c_uint,
+    uniforms: []Uniform,
+    names: std.StringHashMap(usize),
+    staging: []align(@alignOf(rl.Matrix)) u8,
+
+    /// Shader storage buffer holding the whole staging buffer (0 if not used)
+    buffer_id: c_uint = 0,
+    buffer_binding: c_uint = 0,
+
+    stats: UniformSetStats = .{},
+
+    /// Resolve the uniform locations and allocate the staging buffer
+    ///
+    /// If binding is set and shader buffers are supported (OpenGL 4.3), the staging buffer is
+    /// uploaded to a shader buffer bound to this index instead of per uniform
+    pub fn init(shader: rl.Shader, descs: []const UniformDesc, binding: ?c_uint) !*UniformSet {
+        const set = try allocator.create(UniformSet);
+        errdefer allocator.destroy(set);
+
+        const uniforms = try allocator.alloc(Uniform, descs.len);
+        errdefer allocator.free(uniforms);
+
+        var names = std.StringHashMap(usize).init(allocator);
+        errdefer names.deinit();
+        try names.ensureTotalCapacity(@intCast(descs.len));
+
+        var initialized: usize = 0;
+        errdefer for (uniforms[0..initialized]) |uniform| allocator.free(uniform.name);
+
+        const std430 = binding != null and rl.rlGetVersion() >= rl.RL_OPENGL_43;
+
+        var size: usize = 0;
+        for (descs, 0..) |desc, i| {
+            const type_size = GetUniformTypeSize(desc.uniform_type);
+            if (type_size == 0 or desc.count <= 0) return error.invalid_uniform;
+            if (names.contains(desc.name)) return error.duplicated_uniform;
+
+            const count: usize = @intCast(desc.count);
+
+            var stride = type_size;
+            if (std430) {
+                const layout = std430_layout(type_size);
+                size = std.mem.alignForward(usize, size, layout.alignment);
+                stride = layout.stride;
+            }
+
+            // Null terminated copy for the location lookup
+            const name = try allocator.allocSentinel(u8, desc.name.len, 0);
+            @memcpy(name, desc.name);
+
+            uniforms[i] = Uniform{
+                .name = name,
+                .location = rl.GetShaderLocation(shader, name.ptr),
+                .uniform_type = desc.uniform_type,
+                .count = desc.count,
+                .offset = size,
+                // Arrays take whole strides, a single vec3 can be followed by a scalar
+                .span = if (count > 1) stride * count else type_size,
+                .size = type_size * count,
+                .element_size = type_size,
+                .stride = stride,
+                .dirty = true,
+            };
+            initialized += 1;
+
+            names.putAssumeCapacity(name, i);
+            size += uniforms[i].span;
+        }
+
+        if (std430) size = std.mem.alignForward(usize, size, 16);
+
+        const staging = try allocator.alignedAlloc(u8, @alignOf(rl.Matrix), size);
+        errdefer allocator.free(staging);
+        @memset(staging, 0);
+
+        set.* = UniformSet{
+            .shader_id = shader.id,
+            .uniforms = uniforms,
+            .names = names,
+            .staging = staging,
+        };
+
+        if (std430 and size > 0) {
+            set.buffer_id = rl.rlLoadShaderBuffer(@intCast(size), staging.ptr, rl.RL_DYNAMIC_DRAW);
+            set.buffer_binding = binding.?;
+        }
+
+        return set;
+    }
+
+    /// Unload the shader buffer (GPU), the uniforms are uploaded one by one afterwards
+    pub fn unload(self: *UniformSet) void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        if (self.buffer_id != 0) {
+            rl.rlUnloadShaderBuffer(self.buffer_id);
+            self.buffer_id = 0;
+            for (self.uniforms) |*uniform| uniform.dirty = true;
+        }
+    }
+
+    /// Free the CPU memory
+    ///
+    /// NOTE: The shader buffer must be unloaded before with unload()
+    pub fn deinit(self: *UniformSet) void {
+        for (self.uniforms) |uniform| allocator.free(uniform.name);
+        allocator.free(self.uniforms);
+        self.names.deinit();
+        allocator.free(self.staging);
+        allocator.destroy(self);
+    }
+
+    pub fn index_of(self: *UniformSet, name: []const u8) ?usize {
+        return self.names.get(name);
+    }
+
+    /// Write the packed value of one uniform (count elements), the uniform is marked dirty only if its bytes changed
+    pub fn write(self: *UniformSet, index: usize, value: []const u8) !void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        const uniform = &self.uniforms[index];
+        if (value.len != uniform.size) return error.invalid_size;
+
+        for (0..@intCast(uniform.count)) |k| {
+            const src = value[k * uniform.element_size ..][0..uniform.element_size];
+            const dest = self.staging[uniform.offset + k * uniform.stride ..][0..uniform.element_size];
+            if (!std.mem.eql(u8, dest, src)) {
+                @memcpy(dest, src);
+                uniform.dirty = true;
+            }
+        }
+    }
+
+    /// Replace the whole staging buffer, only the uniforms whose bytes changed are marked dirty
+    pub fn write_all(self: *UniformSet, value: []const u8) !void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        if (value.len != self.staging.len) return error.invalid_size;
+
+        for (self.uniforms) |*uniform| {
+            const src = value[uniform.offset .. uniform.offset + uniform.span];
+            const dest = self.staging[uniform.offset .. uniform.offset + uniform.span];
+            if (!std.mem.eql(u8, dest, src)) {
+                @memcpy(dest, src);
+                uniform.dirty = true;
+            }
+        }
+    }
+
+    /// Mark all the uniforms dirty (e.g. after the shader values were changed elsewhere)
+    pub fn invalidate(self: *UniformSet) void {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        for (self.uniforms) |*uniform| uniform.dirty = true;
+    }
+
+    /// Upload the dirty uniforms, returns the number of uniforms uploaded
+    ///
+    /// NOTE: The shader is enabled by this call, use it after BeginShaderMode()
+    pub fn apply(self: *UniformSet) c_uint {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        var uploaded: c_uint = 0;
+
+        if (self.buffer_id != 0) {
+            // One update covering the dirty uniforms
+            var first: usize = self.staging.len;
+            var last: usize = 0;
+
+            for (self.uniforms) |*uniform| {
+                if (!uniform.dirty) continue;
+                uniform.dirty = false;
+
+                first = @min(first, uniform.offset);
+                last = @max(last, uniform.offset + uniform.span);
+                uploaded += 1;
+            }
+
+            if (uploaded > 0) {
+                rl.rlUpdateShaderBuffer(self.buffer_id, self.staging[first..].ptr, @intCast(last - first), @intCast(first));
+            }
+            rl.rlBindShaderBuffer(self.buffer_id, self.buffer_binding);
+        } else {
+            rl.rlEnableShader(self.shader_id);
+
+            for (self.uniforms) |*uniform| {
+                if (!uniform.dirty) continue;
+                uniform.dirty = false;
+
+                // Uniforms not used by the shader are optimized out by the driver
+                if (uniform.location < 0) continue;
+
+                if (uniform.stride == uniform.element_size) {
+                    set_uniform(uniform.*, uniform.location, self.staging[uniform.offset..].ptr, uniform.count);
+                } else {
+                    // Padded elements (std430 staging without a shader buffer), the array elements have consecutive locations
+                    for (0..@intCast(uniform.count)) |k| {
+                        set_uniform(uniform.*, uniform.location + @as(c_int, @intCast(k)), self.staging[uniform.offset + k * uniform.stride ..].ptr, 1);
+                    }
+                }
+
+                uploaded += 1;
+            }
+        }
+
+        self.stats.uploads += uploaded;
+        self.stats.skipped += self.uniforms.len - @as(usize, uploaded);
+
+        return uploaded;
+    }
+
+    fn set_uniform(uniform: Uniform, location: c_int, data: [*]u8, count: c_int) void {
+        if (uniform.uniform_type == UNIFORM_MATRIX) {
+            rl.rlSetUniformMatrices(location, @ptrCast(@alignCast(data)), count);
+        } else {
+            rl.rlSetUniform(location, data, uniform.uniform_type, count);
+        }
+    }
+
+    pub fn get_stats(self: *UniformSet) UniformSetStats {
+        self.lock.lock();
+        defer self.lock.unlock();
+
+        return self.stats;
+    }
+};
+
+pub fn LoadUniformSet(shader: rl.Shader, descs: []const UniformDesc, binding: ?c_uint) !*UniformSet {
+    return UniformSet.init(shader, descs, binding);
+}
+
+/// Unload the shader buffer, the set is freed with deinit()
+pub fn UnloadUniformSet(set: *UniformSet) void {
+    set.unload();
+}
@@ -0,0 +1,308 @@
+const std = @import("std");
+const e = @import("./erl_nif.zig");
+const rl = @import("./raylib.zig");
+const utils = @import("./utils.zig");
+
+pub const allocator = rl.allocator;
+
+/// Maximum number of voices of a pool
+pub const VOICE_POOL_MAX_VOICES = 256;
+
+/// Voices quieter than this are not started
+const inaudible_volume: f32 = 0.001;
+
+/// Sound alias of the sound it plays, aliased again when it plays another sound
+///
+/// NOTE: The sound resource is kept alive by the voice, it is released when the voice plays another sound or is unloaded
+const Voice = struct {
+    /// Empty (null buffer) when the samples of the sound were unloaded
+    alias: rl.Sound = std.mem.zeroes(rl.Sound),
+    /// Sound resource of the samples, null for sound values
+    source: ?**rl.Sound = null,
+    priority: i32 = 0,
+    /// Play sequence number, the lowest is the oldest
+    started: u64 = 0,
+
+    fn get_data(self: *const Voice) ?*anyopaque {
+        const buffer: ?*const rl.AudioBuffer = @ptrCast(@alignCast(self.alias.stream.buffer));
+        return if (buffer) |b| b.data else null;
+    }
+
+    fn is_playing(self: *const Voice) bool {
+        return rl.IsSoundPlaying(self.alias);
+    }
+
+    /// Alias a sound on the voice
+    ///
+    /// NOTE: raylib tracks and untracks the alias buffers under the audio lock, the buffer
+    /// of an alias is never changed while the mixer may read it
+    fn retarget(self: *Voice, sound: rl.Sound, source: ?**rl.Sound) !void {
+        if (self.get_data() != (try get_source(sound)).data) {
+            const alias = rl.LoadSoundAlias(sound);
+            if (alias.stream.buffer == null) return error.voice_load_failed;
+
+            rl.UnloadSoundAlias(self.alias);
+            self.alias = alias;
+        }
+
+        if (source) |resource| e.enif_keep_resource(@ptrCast(resource));
+        if (self.source) |resource| e.enif_release_resource(@ptrCast(resource));
+        self.source = source;
+    }
+
+    /// Unload the alias and release the sound resource
+    fn clear(self: *Voice) void {
+        rl.UnloadSoundAlias(self.alias);
+        self.alias = std.mem.zeroes(rl.Sound);
+
+        if (self.source) |resource| e.enif_release_resource(@ptrCast(resource));
+        self.source = null;
+    }
+};
+
+pub const PlayParams = struct {
+    volume: f32 = 1.0,
+    pitch: f32 = 1.0,
+    pan: f32 = 0.5,
+    /// Voices only steal voices of the same or a lower priority
+    priority: i32 = 0,
+};
+
+pub const Stats = struct {
+    voices: usize,
+    active: usize,
+    played: u64,
+    stolen: u64,
+    dropped: u64,
+    culled: u64,
+};
+
+/// Fixed number of sound aliases sharing the sample data of the sounds they play
+///
+/// An idle voice is used, or the lowest priority voice (the oldest first) is stolen,
+/// or the sound is dropped. Only a voice playing another sound than its last one
+/// allocates (its alias buffer)
+pub const VoicePool = struct {
+    voices: []Voice,
+    loaded: bool = true,
+    sequence: u64 = 0,
+    played: u64 = 0,
+    stolen: u64 = 0,
+    dropped: u64 = 0,
+    culled: u64 = 0,
+    mutex: std.Thread.Mutex = .{},
+
+    /// Release the CPU memory, the aliases must be unloaded before
+    pub fn deinit(self: *VoicePool) void {
+        allocator.free(self.voices);
+        allocator.destroy(self);
+    }
+
+    /// Release the aliases and the sound resources
+    pub fn unload(self: *VoicePool) void {
+        // Before locking the pool, UnloadSoundVoices locks the pools in the other order
+        unregister(self);
+
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        if (!self.loaded) return;
+        self.loaded = false;
+
+        for (self.voices) |*voice| voice.clear();
+    }
+
+    /// Play a sound on a voice, returns the voice index or null when the sound is dropped
+    ///
+    /// The sound resource (null for a sound value) is kept while the voice uses its samples
+    pub fn play(self: *VoicePool, sound: rl.Sound, source: ?**rl.Sound, params: PlayParams) !?usize {
+        _ = try get_source(sound);
+
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        if (!self.loaded) return error.voice_pool_unloaded;
+
+        if (params.volume < inaudible_volume) {
+            self.culled += 1;
+            return null;
+        }
+
+        const index = self.pick_voice(params.priority) orelse {
+            self.dropped += 1;
+            return null;
+        };
+        const voice = &self.voices[index];
+
+        if (voice.is_playing()) {
+            rl.StopSound(voice.alias);
+            self.stolen += 1;
+        }
+
+        try voice.retarget(sound, source);
+        voice.priority = params.priority;
+        voice.started = self.sequence;
+        self.sequence += 1;
+
+        rl.SetSoundVolume(voice.alias, params.volume);
+        rl.SetSoundPitch(voice.alias, params.pitch);
+        rl.SetSoundPan(voice.alias, params.pan);
+        rl.PlaySound(voice.alias);
+
+        self.played += 1;
+
+        return index;
+    }
+
+    /// Play a sound at a position, attenuated and panned for the audio 3D mode listener
+    pub fn play_3d(self: *VoicePool, sound: rl.Sound, source: ?**rl.Sound, position: rl.Vector3, params: PlayParams) !?usize {
+        const computed_position = rl.ComputeAudioPositionMode3D(position);
+
+        var spatial_params = params;
+        spatial_params.volume = params.volume * computed_position.volume;
+        spatial_params.pan = computed_position.pan;
+
+        return self.play(sound, source, spatial_params);
+    }
+
+    /// Idle voice, or playing voice of the lowest priority (the oldest first) not above priority
+    fn pick_voice(self: *const VoicePool, priority: i32) ?usize {
+        var candidate: ?usize = null;
+
+        for (self.voices, 0..) |*voice, i| {
+            if (!voice.is_playing()) return i;
+            if (voice.priority > priority) continue;
+
+            if (candidate) |c| {
+                const best = &self.voices[c];
+                if (voice.priority > best.priority) continue;
+                if (voice.priority == best.priority and voice.started > best.started) continue;
+            }
+
+            candidate = i;
+        }
+
+        return candidate;
+    }
+
+    pub fn stop(self: *VoicePool) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        if (!self.loaded) return;
+
+        for (self.voices) |voice| rl.StopSound(voice.alias);
+    }
+
+    pub fn get_stats(self: *VoicePool) Stats {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        var active: usize = 0;
+        if (self.loaded) {
+            for (self.voices) |*voice| {
+                if (voice.is_playing()) active += 1;
+            }
+        }
+
+        return .{
+            .voices = self.voices.len,
+            .active = active,
+            .played = self.played,
+            .stolen = self.stolen,
+            .dropped = self.dropped,
+            .culled = self.culled,
+        };
+    }
+
+    pub fn reset_stats(self: *VoicePool) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        self.played = 0;
+        self.stolen = 0;
+        self.dropped = 0;
+        self.culled = 0;
+    }
+};
+
+/// Buffer holding the sample data of a sound (not an audio stream)
+fn get_source(sound: rl.Sound) !*const rl.AudioBuffer {
+    if (sound.stream.buffer == null) return error.invalid_sound;
+
+    const source: *const rl.AudioBuffer = @ptrCast(@alignCast(sound.stream.buffer));
+    if (source.data == null) return error.invalid_sound;
+
+    return source;
+}
+
+/// Loaded pools, their voices are unloaded with the samples they play
+var pools: std.ArrayListUnmanaged(*VoicePool) = .{};
+var pools_mutex: std.Thread.Mutex = .{};
+
+fn register(pool: *VoicePool) !void {
+    pools_mutex.lock();
+    defer pools_mutex.unlock();
+
+    try pools.append(allocator, pool);
+}
+
+fn unregister(pool: *VoicePool) void {
+    pools_mutex.lock();
+    defer pools_mutex.unlock();
+
+    for (pools.items, 0..) |item, i| {
+        if (item != pool) continue;
+        _ = pools.swapRemove(i);
+        break;
+    }
+
+    if (pools.items.len == 0) pools.clearAndFree(allocator);
+}
+
+/// Unload the voices using the samples of a sound, must be called before the sound is unloaded
+pub fn UnloadSoundVoices(sound: rl.Sound) void {
+    const source = get_source(sound) catch return;
+
+    pools_mutex.lock();
+    defer pools_mutex.unlock();
+
+    for (pools.items) |pool| {
+        pool.mutex.lock();
+        defer pool.mutex.unlock();
+
+        for (pool.voices) |*voice| {
+            if (voice.get_data() == source.data) voice.clear();
+        }
+    }
+}
+
+/// Load a pool of voices, created as aliases of a sound (any sound can be played on them)
+///
+/// The sound resource (null for a sound value) is kept by each voice while it uses its samples
+pub fn LoadVoicePool(sound: rl.Sound, source: ?**rl.Sound, voice_count: usize) !*VoicePool {
+    if (voice_count < 1 or voice_count > VOICE_POOL_MAX_VOICES) return error.invalid_voice_count;
+
+    _ = try get_source(sound);
+
+    const self = try allocator.create(VoicePool);
+    errdefer allocator.destroy(self);
+
+    const voices = try allocator.alloc(Voice, voice_count);
+    errdefer allocator.free(voices);
+    for (voices) |*voice| voice.* = .{};
+    errdefer for (voices) |*voice| voice.clear();
+
+    for (voices) |*voice| try voice.retarget(sound, source);
+
+    self.* = .{ .voices = voices };
+    try register(self);
+
+    utils.TRACELOG(rl.LOG_INFO, "VOICE POOL: Loaded %i voices", .{@as(c_int, @intCast(voice_count))});
+
+    return self;
+}
+
+pub fn UnloadVoicePool(pool: *VoicePool) void {
+    pool.unload();
+}
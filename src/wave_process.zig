@@ -0,0 +1,685 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+const workers = @import("./workers.zig");
+
+pub const allocator = rl.allocator;
+
+/// Samples processed per vector step
+const lanes = 8;
+
+/// Minimum frames per chunk of work sent to the worker pool
+const frames_per_chunk = 16 * 1024;
+
+const F32 = @Vector(lanes, f32);
+
+/// Zero crossings on each side of the windowed sinc kernel (at the source rate)
+const sinc_zero_crossings = 8;
+
+/// Kernel table entries per zero crossing, the kernel is interpolated linearly between them
+const sinc_resolution = 512;
+
+/// Windowed sinc kernel (Blackman window) from 0 to sinc_zero_crossings
+const sinc_table = blk: {
+    @setEvalBranchQuota(100_000);
+
+    var table: [sinc_zero_crossings * sinc_resolution + 2]f32 = undefined;
+    for (&table, 0..) |*value, i| {
+        const u = @as(f64, @floatFromInt(i)) / sinc_resolution;
+        const x = u / sinc_zero_crossings;
+
+        const window: f64 = if (x >= 1.0) 0.0 else 0.42 + 0.5 * @cos(std.math.pi * x) + 0.08 * @cos(2.0 * std.math.pi * x);
+        const sinc: f64 = if (i == 0) 1.0 else @sin(std.math.pi * u) / (std.math.pi * u);
+
+        value.* = @floatCast(sinc * window);
+    }
+
+    break :blk table;
+};
+
+pub const Quality = enum {
+    /// Linear interpolation between the two nearest frames
+    linear,
+    /// Catmull-Rom spline over the four nearest frames
+    cubic,
+    /// Windowed sinc, band limited to the lowest rate (no aliasing when downsampling)
+    sinc,
+};
+
+pub const Levels = struct {
+    /// Highest absolute sample value, 1.0 is full scale
+    peak: f32,
+    /// Root mean square of all the samples
+    rms: f32,
+};
+
+/// Samples decoded to floats, split by channel (the frames of a channel are contiguous)
+const Planar = struct {
+    data: []f32,
+    frames: usize,
+    channels: usize,
+
+    fn init(frames: usize, channels: usize) !Planar {
+        return Planar{
+            .data = try allocator.alloc(f32, frames * channels),
+            .frames = frames,
+            .channels = channels,
+        };
+    }
+
+    fn deinit(self: Planar) void {
+        allocator.free(self.data);
+    }
+
+    fn channel(self: Planar, index: usize) []f32 {
+        return self.data[index * self.frames ..][0..self.frames];
+    }
+};
+
+fn is_valid(wave: *const rl.Wave) bool {
+    return wave.data != null and wave.frameCount > 0 and wave.sampleRate > 0 and wave.channels > 0 and switch (wave.sampleSize) {
+        8, 16, 32 => true,
+        else => false,
+    };
+}
+
+fn bytes_per_frame(wave: *const rl.Wave) usize {
+    return @as(usize, wave.channels) * @as(usize, wave.sampleSize / 8);
+}
+
+///////////////
+//  Kernels  //
+///////////////
+
+/// Same scales as LoadWaveSamples and WaveFormat in raylib, 8 bit samples are unsigned
+fn decode_vector(comptime T: type, comptime n: usize, v: @Vector(n, T)) @Vector(n, f32) {
+    return switch (T) {
+        u8 => (@as(@Vector(n, f32), @floatFromInt(v)) - @as(@Vector(n, f32), @splat(128.0))) / @as(@Vector(n, f32), @splat(128.0)),
+        i16 => @as(@Vector(n, f32), @floatFromInt(v)) / @as(@Vector(n, f32), @splat(32767.0)),
+        f32 => v,
+        else => @compileError("unsupported sample type"),
+    };
+}
+
+/// Integer samples are clamped to full scale, float samples are kept as they are
+fn encode_vector(comptime T: type, comptime n: usize, v: @Vector(n, f32)) @Vector(n, T) {
+    const clamped = @min(@max(v, @as(@Vector(n, f32), @splat(-1.0))), @as(@Vector(n, f32), @splat(1.0)));
+
+    return switch (T) {
+        u8 => @intFromFloat(@round(clamped * @as(@Vector(n, f32), @splat(127.0)) + @as(@Vector(n, f32), @splat(128.0)))),
+        i16 => @intFromFloat(@round(clamped * @as(@Vector(n, f32), @splat(32767.0)))),
+        f32 => v,
+        else => @compileError("unsupported sample type"),
+    };
+}
+
+fn decode_samples(comptime T: type, source: [*]align(1) const T, target: []f32) void {
+    var i: usize = 0;
+    while (i + lanes <= target.len) : (i += lanes) {
+        const v: @Vector(lanes, T) = source[i..][0..lanes].*;
+        target[i..][0..lanes].* = decode_vector(T, lanes, v);
+    }
+    while (i < target.len) : (i += 1) {
+        target[i] = decode_vector(T, 1, .{source[i]})[0];
+    }
+}
+
+fn encode_samples(comptime T: type, source: []const f32, target: [*]align(1) T) void {
+    var i: usize = 0;
+    while (i + lanes <= source.len) : (i += lanes) {
+        const v: F32 = source[i..][0..lanes].*;
+        target[i..][0..lanes].* = encode_vector(T, lanes, v);
+    }
+    while (i < source.len) : (i += 1) {
+        target[i] = encode_vector(T, 1, .{source[i]})[0];
+    }
+}
+
+/// target += source * gain
+fn add_scaled(target: []f32, source: []const f32, gain: f32) void {
+    const g: F32 = @splat(gain);
+
+    var i: usize = 0;
+    while (i + lanes <= target.len) : (i += lanes) {
+        const t: F32 = target[i..][0..lanes].*;
+        const s: F32 = source[i..][0..lanes].*;
+        target[i..][0..lanes].* = t + s * g;
+    }
+    while (i < target.len) : (i += 1) target[i] += source[i] * gain;
+}
+
+fn scale(samples: []f32, gain: f32) void {
+    const g: F32 = @splat(gain);
+
+    var i: usize = 0;
+    while (i + lanes <= samples.len) : (i += lanes) {
+        const s: F32 = samples[i..][0..lanes].*;
+        samples[i..][0..lanes].* = s * g;
+    }
+    while (i < samples.len) : (i += 1) samples[i] *= gain;
+}
+
+fn get_levels(samples: []const f32) Levels {
+    var peak: F32 = @splat(0.0);
+    var squares: F32 = @splat(0.0);
+
+    var i: usize = 0;
+    while (i + lanes <= samples.len) : (i += lanes) {
+        const s: F32 = samples[i..][0..lanes].*;
+        peak = @max(peak, @abs(s));
+        squares += s * s;
+    }
+
+    var tail_peak: f32 = 0.0;
+    var tail_squares: f32 = 0.0;
+    while (i < samples.len) : (i += 1) {
+        tail_peak = @max(tail_peak, @abs(samples[i]));
+        tail_squares += samples[i] * samples[i];
+    }
+
+    const sum = @as(f64, @reduce(.Add, squares)) + @as(f64, tail_squares);
+
+    return Levels{
+        .peak = @max(@reduce(.Max, peak), tail_peak),
+        .rms = if (samples.len > 0) @floatCast(@sqrt(sum / @as(f64, @floatFromInt(samples.len)))) else 0.0,
+    };
+}
+
+/// First sample at or above the threshold (samples.len when there is none)
+fn find_first_loud(samples: []const f32, threshold: f32) usize {
+    const t: F32 = @splat(threshold);
+
+    var i: usize = 0;
+    while (i + lanes <= samples.len) : (i += lanes) {
+        const s: F32 = samples[i..][0..lanes].*;
+        if (@reduce(.Or, @abs(s) >= t)) break;
+    }
+    while (i < samples.len) : (i += 1) {
+        if (@abs(samples[i]) >= threshold) return i;
+    }
+
+    return samples.len;
+}
+
+/// One past the last sample at or above the threshold (0 when there is none)
+fn find_last_loud(samples: []const f32, threshold: f32) usize {
+    const t: F32 = @splat(threshold);
+
+    var i: usize = samples.len;
+    while (i >= lanes) : (i -= lanes) {
+        const s: F32 = samples[i - lanes ..][0..lanes].*;
+        if (@reduce(.Or, @abs(s) >= t)) break;
+    }
+    while (i > 0) : (i -= 1) {
+        if (@abs(samples[i - 1]) >= threshold) return i;
+    }
+
+    return 0;
+}
+
+/// Frames at the source positions index + offset, clamped to the edges
+fn gather(source: []const f32, index: [lanes]i64, comptime offset: i64) F32 {
+    const last: i64 = @intCast(source.len - 1);
+
+    var result: [lanes]f32 = undefined;
+    for (&result, index) |*value, i| {
+        value.* = source[@intCast(std.math.clamp(i + offset, 0, last))];
+    }
+
+    return result;
+}
+
+fn sinc_weight(u: f32) f32 {
+    const position = u * sinc_resolution;
+    if (position >= sinc_zero_crossings * sinc_resolution) return 0.0;
+
+    const i: usize = @intFromFloat(position);
+    const t = position - @as(f32, @floatFromInt(i));
+
+    return sinc_table[i] + (sinc_table[i + 1] - sinc_table[i]) * t;
+}
+
+/// Resample the frames [start, end) of one channel, a vector of output frames at a time
+fn resample_range(comptime quality: Quality, source: []const f32, target: []f32, start: usize, end: usize, step: f64, cutoff: f32) void {
+    // Source frames on each side of the position covered by the sinc kernel
+    const half_width: i64 = @intFromFloat(@ceil(sinc_zero_crossings / cutoff));
+
+    var i = start;
+    while (i < end) : (i += lanes) {
+        var index: [lanes]i64 = undefined;
+        var fraction: [lanes]f32 = undefined;
+        for (0..lanes) |j| {
+            const position = @as(f64, @floatFromInt(i + j)) * step;
+            const floor = @floor(position);
+            index[j] = @intFromFloat(floor);
+            fraction[j] = @floatCast(position - floor);
+        }
+
+        const t: F32 = fraction;
+
+        const result: F32 = switch (quality) {
+            .linear => blk: {
+                const p0 = gather(source, index, 0);
+                const p1 = gather(source, index, 1);
+                break :blk p0 + (p1 - p0) * t;
+            },
+            .cubic => blk: {
+                const p0 = gather(source, index, -1);
+                const p1 = gather(source, index, 0);
+                const p2 = gather(source, index, 1);
+                const p3 = gather(source, index, 2);
+
+                const half: F32 = @splat(0.5);
+                const two: F32 = @splat(2.0);
+                const three: F32 = @splat(3.0);
+                const four: F32 = @splat(4.0);
+                const five: F32 = @splat(5.0);
+
+                const c3 = three * (p1 - p2) + p3 - p0;
+                const c2 = two * p0 - five * p1 + four * p2 - p3;
+                const c1 = p2 - p0;
+
+                break :blk p1 + half * t * (c1 + t * (c2 + t * c3));
+            },
+            .sinc => blk: {
+                const last: i64 = @intCast(source.len - 1);
+
+                var sum: F32 = @splat(0.0);
+                var weights: F32 = @splat(0.0);
+
+                var offset: i64 = 1 - half_width;
+                while (offset <= half_width) : (offset += 1) {
+                    var samples: [lanes]f32 = undefined;
+                    var weight: [lanes]f32 = undefined;
+                    for (0..lanes) |j| {
+                        samples[j] = source[@intCast(std.math.clamp(index[j] + offset, 0, last))];
+                        weight[j] = sinc_weight(@abs(@as(f32, @floatFromInt(offset)) - fraction[j]) * cutoff);
+                    }
+
+                    const w: F32 = weight;
+                    const s: F32 = samples;
+                    sum += s * w;
+                    weights += w;
+                }
+
+                // The weights are normalized, the gain stays flat whatever the phase
+                break :blk sum / weights;
+            },
+        };
+
+        const values: [lanes]f32 = result;
+        const count = @min(lanes, end - i);
+        @memcpy(target[i..][0..count], values[0..count]);
+    }
+}
+
+//////////////////
+//  Conversion  //
+//////////////////
+
+fn decode(wave: *const rl.Wave) !Planar {
+    const frames: usize = wave.frameCount;
+    const channels: usize = wave.channels;
+
+    const planar = try Planar.init(frames, channels);
+    errdefer planar.deinit();
+
+    // Mono samples are already planar
+    const interleaved = if (channels == 1) planar.data else try allocator.alloc(f32, frames * channels);
+    defer if (channels != 1) allocator.free(interleaved);
+
+    switch (wave.sampleSize) {
+        8 => decode_samples(u8, @ptrCast(wave.data.?), interleaved),
+        16 => decode_samples(i16, @ptrCast(wave.data.?), interleaved),
+        32 => decode_samples(f32, @ptrCast(wave.data.?), interleaved),
+        else => return error.invalid_sample_size,
+    }
+
+    if (channels != 1) {
+        for (0..channels) |c| {
+            const target = planar.channel(c);
+            for (target, 0..) |*sample, frame| sample.* = interleaved[frame * channels + c];
+        }
+    }
+
+    return planar;
+}
+
+/// Replace the wave data with the planar samples, encoded with the same sample size
+fn encode(wave: *rl.Wave, planar: Planar, sample_rate: c_uint) !void {
+    const frames = planar.frames;
+    const channels = planar.channels;
+    const count = frames * channels;
+
+    const interleaved = if (channels == 1) planar.data else try allocator.alloc(f32, count);
+    defer if (channels != 1) allocator.free(interleaved);
+
+    if (channels != 1) {
+        for (0..channels) |c| {
+            const source = planar.channel(c);
+            for (source, 0..) |sample, frame| interleaved[frame * channels + c] = sample;
+        }
+    }
+
+    const data: [*]u8 = @ptrCast(rl.MemAlloc(@intCast(count * @as(usize, wave.sampleSize / 8))) orelse return error.OutOfMemory);
+
+    switch (wave.sampleSize) {
+        8 => encode_samples(u8, interleaved, @ptrCast(data)),
+        16 => encode_samples(i16, interleaved, @ptrCast(data)),
+        32 => encode_samples(f32, interleaved, @ptrCast(data)),
+        else => unreachable,
+    }
+
+    if (wave.data != null) rl.MemFree(wave.data);
+    wave.data = data;
+    wave.frameCount = @intCast(frames);
+    wave.sampleRate = sample_rate;
+    wave.channels = @intCast(channels);
+}
+
+//////////////////
+//  Processing  //
+//////////////////
+
+const ResampleJob = struct {
+    source: *const Planar,
+    target: *const Planar,
+    quality: Quality,
+    step: f64,
+    cutoff: f32,
+
+    fn run(self: *ResampleJob, start: usize, end: usize) void {
+        for (0..self.source.channels) |c| {
+            const source = self.source.channel(c);
+            const target = self.target.channel(c);
+
+            switch (self.quality) {
+                inline else => |quality| resample_range(quality, source, target, start, end, self.step, self.cutoff),
+            }
+        }
+    }
+};
+
+/// Resample a wave, the frames of long waves are split across the worker pool
+pub fn WaveResample(wave: *rl.Wave, sample_rate: c_uint, quality: Quality) !void {
+    if (!is_valid(wave)) return error.invalid_wave;
+    if (sample_rate == 0) return error.invalid_sample_rate;
+    if (wave.sampleRate == sample_rate) return;
+
+    const source = try decode(wave);
+    defer source.deinit();
+
+    const ratio = @as(f64, @floatFromInt(sample_rate)) / @as(f64, @floatFromInt(wave.sampleRate));
+    const frames: usize = @max(@as(usize, @intFromFloat(@as(f64, @floatFromInt(source.frames)) * ratio)), 1);
+
+    const target = try Planar.init(frames, source.channels);
+    defer target.deinit();
+
+    var job = ResampleJob{
+        .source = &source,
+        .target = &target,
+        .quality = quality,
+        .step = 1.0 / ratio,
+        .cutoff = @floatCast(@min(ratio, 1.0)),
+    };
+    workers.parallel_for(frames, frames_per_chunk, &job, ResampleJob.run);
+
+    try encode(wave, target, sample_rate);
+}
+
+/// Change the channel count of a wave: upmixing repeats the source channels in order,
+/// downmixing averages the source channels folded onto each target channel (all of them for mono)
+pub fn WaveRemix(wave: *rl.Wave, channels: c_uint) !void {
+    if (!is_valid(wave)) return error.invalid_wave;
+    if (channels == 0) return error.invalid_channels;
+    if (wave.channels == channels) return;
+
+    const source = try decode(wave);
+    defer source.deinit();
+
+    const target = try Planar.init(source.frames, channels);
+    defer target.deinit();
+
+    for (0..target.channels) |c| {
+        const samples = target.channel(c);
+
+        if (target.channels > source.channels) {
+            @memcpy(samples, source.channel(c % source.channels));
+            continue;
+        }
+
+        @memset(samples, 0.0);
+
+        var folded: usize = 0;
+        var k = c;
+        while (k < source.channels) : (k += target.channels) folded += 1;
+
+        k = c;
+        while (k < source.channels) : (k += target.channels) {
+            add_scaled(samples, source.channel(k), 1.0 / @as(f32, @floatFromInt(folded)));
+        }
+    }
+
+    try encode(wave, target, wave.sampleRate);
+}
+
+/// Get the peak and the RMS level of a wave
+pub fn GetWaveLevels(wave: *const rl.Wave) !Levels {
+    if (!is_valid(wave)) return error.invalid_wave;
+
+    const samples = try decode(wave);
+    defer samples.deinit();
+
+    return get_levels(samples.data);
+}
+
+/// Scale a wave so that its peak reaches the given level, a silent wave is left as is
+pub fn WaveNormalize(wave: *rl.Wave, peak: f32) !void {
+    if (!is_valid(wave)) return error.invalid_wave;
+
+    const samples = try decode(wave);
+    defer samples.deinit();
+
+    const levels = get_levels(samples.data);
+    if (levels.peak <= 0.0 or levels.peak == peak) return;
+
+    scale(samples.data, peak / levels.peak);
+
+    try encode(wave, samples, wave.sampleRate);
+}
+
+/// Remove the frames below the threshold (on all the channels) at the start and the end of a wave
+///
+/// NOTE: The samples are cropped as they are, a silent wave keeps its first frame
+pub fn WaveTrimSilence(wave: *rl.Wave, threshold: f32) !void {
+    if (!is_valid(wave)) return error.invalid_wave;
+
+    const samples = try decode(wave);
+    defer samples.deinit();
+
+    var first: usize = samples.frames;
+    var last: usize = 0;
+    for (0..samples.channels) |c| {
+        first = @min(first, find_first_loud(samples.channel(c), threshold));
+        last = @max(last, find_last_loud(samples.channel(c), threshold));
+    }
+
+    if (first >= last) {
+        first = 0;
+        last = 1;
+    }
+
+    if (first == 0 and last == samples.frames) return;
+
+    const frame_size = bytes_per_frame(wave);
+    const data: [*]u8 = @ptrCast(rl.MemAlloc(@intCast((last - first) * frame_size)) orelse return error.OutOfMemory);
+
+    const source: [*]const u8 = @ptrCast(wave.data.?);
+    @memcpy(data[0 .. (last - first) * frame_size], source[first * frame_size .. last * frame_size]);
+
+    rl.MemFree(wave.data);
+    wave.data = data;
+    wave.frameCount = @intCast(last - first);
+}
+
+const MixJob = struct {
+    source: *const Planar,
+    target: *const Planar,
+    gain: f32,
+
+    fn run(self: *MixJob, start: usize, end: usize) void {
+        for (0..self.source.channels) |c| {
+            const source = self.source.channel(c);
+            if (start >= source.len) continue;
+
+            const stop = @min(end, source.len);
+            add_scaled(self.target.channel(c)[start..stop], source[start..stop], self.gain);
+        }
+    }
+};
+
+/// Mix waves into a new wave as long as the longest one, each wave is scaled by its gain
+///
+/// NOTE: The waves must share the sample rate and the channel count, the sample size of the first one is used
+pub fn WaveMix(waves: []const *rl.Wave, gains: []const f32) !rl.Wave {
+    if (waves.len == 0 or waves.len != gains.len) return error.invalid_waves;
+
+    var frames: usize = 0;
+    for (waves) |wave| {
+        if (!is_valid(wave)) return error.invalid_wave;
+        if (wave.sampleRate != waves[0].sampleRate or wave.channels != waves[0].channels) return error.invalid_waves;
+        frames = @max(frames, wave.frameCount);
+    }
+
+    const target = try Planar.init(frames, waves[0].channels);
+    defer target.deinit();
+    @memset(target.data, 0.0);
+
+    for (waves, gains) |wave, gain| {
+        const source = try decode(wave);
+        defer source.deinit();
+
+        var job = MixJob{ .source = &source, .target = &target, .gain = gain };
+        workers.parallel_for(source.frames, frames_per_chunk, &job, MixJob.run);
+    }
+
+    var result = rl.Wave{
+        .frameCount = 0,
+        .sampleRate = waves[0].sampleRate,
+        .sampleSize = waves[0].sampleSize,
+        .channels = waves[0].channels,
+        .data = null,
+    };
+    try encode(&result, target, result.sampleRate);
+
+    return result;
+}
+
+/////////////
+//  Batch  //
+/////////////
+
+const WaveBatch = struct {
+    waves: []const *rl.Wave,
+    sample_rate: c_uint = 0,
+    quality: Quality = .linear,
+    channels: c_uint = 0,
+    level: f32 = 0.0,
+    levels: []Levels = &.{},
+    failed: std.atomic.Value(bool) = std.atomic.Value(bool).init(false),
+
+    fn resample(self: *WaveBatch, start: usize, end: usize) void {
+        for (self.waves[start..end]) |wave| {
+            WaveResample(wave, self.sample_rate, self.quality) catch self.failed.store(true, .monotonic);
+        }
+    }
+
+    fn remix(self: *WaveBatch, start: usize, end: usize) void {
+        for (self.waves[start..end]) |wave| {
+            WaveRemix(wave, self.channels) catch self.failed.store(true, .monotonic);
+        }
+    }
+
+    fn normalize(self: *WaveBatch, start: usize, end: usize) void {
+        for (self.waves[start..end]) |wave| {
+            WaveNormalize(wave, self.level) catch self.failed.store(true, .monotonic);
+        }
+    }
+
+    fn trim_silence(self: *WaveBatch, start: usize, end: usize) void {
+        for (self.waves[start..end]) |wave| {
+            WaveTrimSilence(wave, self.level) catch self.failed.store(true, .monotonic);
+        }
+    }
+
+    fn measure(self: *WaveBatch, start: usize, end: usize) void {
+        for (self.waves[start..end], self.levels[start..end]) |wave, *levels| {
+            levels.* = GetWaveLevels(wave) catch blk: {
+                self.failed.store(true, .monotonic);
+                break :blk .{ .peak = 0.0, .rms = 0.0 };
+            };
+        }
+    }
+
+    /// The waves are validated before, a wave fails only when out of memory (and is left as is)
+    fn run(self: *WaveBatch, comptime func: fn (*WaveBatch, usize, usize) void) !void {
+        workers.parallel_for(self.waves.len, 1, self, func);
+        if (self.failed.load(.monotonic)) return error.OutOfMemory;
+    }
+};
+
+/// Check all the waves before any is processed
+fn validate(waves: []const *rl.Wave) !void {
+    for (waves) |wave| {
+        if (!is_valid(wave)) return error.invalid_wave;
+    }
+}
+
+/// Resample many waves to the same sample rate, the waves are processed in parallel
+///
+/// NOTE: On error.OutOfMemory, some waves may be processed and the others are left as is
+pub fn WaveResampleBatch(waves: []const *rl.Wave, sample_rate: c_uint, quality: Quality) !void {
+    try validate(waves);
+    if (sample_rate == 0) return error.invalid_sample_rate;
+
+    var batch = WaveBatch{ .waves = waves, .sample_rate = sample_rate, .quality = quality };
+    try batch.run(WaveBatch.resample);
+}
+
+/// Change the channel count of many waves, the waves are processed in parallel
+///
+/// NOTE: On error.OutOfMemory, some waves may be processed and the others are left as is
+pub fn WaveRemixBatch(waves: []const *rl.Wave, channels: c_uint) !void {
+    try validate(waves);
+    if (channels == 0) return error.invalid_channels;
+
+    var batch = WaveBatch{ .waves = waves, .channels = channels };
+    try batch.run(WaveBatch.remix);
+}
+
+/// Normalize many waves to the same peak, the waves are processed in parallel
+///
+/// NOTE: On error.OutOfMemory, some waves may be processed and the others are left as is
+pub fn WaveNormalizeBatch(waves: []const *rl.Wave, peak: f32) !void {
+    try validate(waves);
+
+    var batch = WaveBatch{ .waves = waves, .level = peak };
+    try batch.run(WaveBatch.normalize);
+}
+
+/// Trim the silence of many waves, the waves are processed in parallel
+///
+/// NOTE: On error.OutOfMemory, some waves may be processed and the others are left as is
+pub fn WaveTrimSilenceBatch(waves: []const *rl.Wave, threshold: f32) !void {
+    try validate(waves);
+
+    var batch = WaveBatch{ .waves = waves, .level = threshold };
+    try batch.run(WaveBatch.trim_silence);
+}
+
+/// Get the levels of many waves, the waves are processed in parallel
+pub fn GetWaveLevelsBatch(waves: []const *rl.Wave, levels: []Levels) !void {
+    try validate(waves);
+
+    var batch = WaveBatch{ .waves = waves, .levels = levels };
+    try batch.run(WaveBatch.measure);
+}
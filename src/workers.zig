@@ -0,0 +1,73 @@
+const std = @import("std");
+const rl = @import("./raylib.zig");
+
+pub const allocator = rl.allocator;
+
+///////////////////
+//  Worker pool  //
+///////////////////
+
+/// Shared pool for CPU bound work split across threads (started on first use)
+var pool: std.Thread.Pool = undefined;
+var pool_ready: bool = false;
+var pool_mutex: std.Thread.Mutex = .{};
+
+fn get_pool() ?*std.Thread.Pool {
+    pool_mutex.lock();
+    defer pool_mutex.unlock();
+
+    if (!pool_ready) {
+        pool.init(.{ .allocator = allocator }) catch return null;
+        pool_ready = true;
+    }
+
+    return &pool;
+}
+
+/// Stop the worker threads, the pool is started again on the next use
+pub fn deinit() void {
+    pool_mutex.lock();
+    defer pool_mutex.unlock();
+
+    if (pool_ready) {
+        pool.deinit();
+        pool_ready = false;
+    }
+}
+
+/// Number of threads working on a parallel_for (the workers plus the calling thread)
+pub fn get_thread_count() usize {
+    const p = get_pool() orelse return 1;
+    return p.threads.len + 1;
+}
+
+/// Call func(context, start, end) over [0, count) split in chunks of at least min_chunk items
+///
+/// The chunks run on the worker pool and the calling thread, it returns when all the chunks are done
+///
+/// NOTE: Can be nested, a waiting thread runs the pending chunks
+pub fn parallel_for(count: usize, min_chunk: usize, context: anytype, comptime func: fn (@TypeOf(context), usize, usize) void) void {
+    if (count == 0) return;
+
+    const chunk_min = @max(min_chunk, 1);
+    if (count <= chunk_min) return func(context, 0, count);
+
+    const p = get_pool() orelse return func(context, 0, count);
+
+    // A few chunks per thread to balance uneven work
+    const chunk_count = @min(std.math.divCeil(usize, count, chunk_min) catch unreachable, (p.threads.len + 1) * 4);
+    if (chunk_count <= 1) return func(context, 0, count);
+
+    const chunk_size = std.math.divCeil(usize, count, chunk_count) catch unreachable;
+
+    var wait_group: std.Thread.WaitGroup = .{};
+
+    var start: usize = chunk_size;
+    while (start < count) : (start += chunk_size) {
+        p.spawnWg(&wait_group, func, .{ context, start, @min(start + chunk_size, count) });
+    }
+
+    func(context, 0, @min(chunk_size, count));
+
+    p.waitAndWork(&wait_group);
+}
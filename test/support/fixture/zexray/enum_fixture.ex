@@ -7,10 +7,12 @@ defmodule Zexray.EnumFixture do
     CameraProjection,
     ConfigFlag,
     CubemapLayout,
+    EventType,
     FontType,
     GamepadAxis,
     GamepadButton,
     Gesture,
+    InputSnapshotPart,
     KeyboardKey,
     MaterialMapIndex,
     MouseButton,
@@ -23,7 +25,8 @@ defmodule Zexray.EnumFixture do
     ShaderUniformDataType,
     TextureFilter,
     TextureWrap,
-    TraceLogLevel
+    TraceLogLevel,
+    VertexLayout
   }
 
   def blend_mode_fixture(attrs \\ %{}) do
@@ -91,6 +94,19 @@ defmodule Zexray.EnumFixture do
     |> Map.merge(attrs)
   end
 
+  def event_type_fixture(attrs \\ %{}) do
+    {name, value} =
+      EventType.values_by_name()
+      |> Enum.to_list()
+      |> List.first()
+
+    %{
+      name: name,
+      value: value
+    }
+    |> Map.merge(attrs)
+  end
+
   def font_type_fixture(attrs \\ %{}) do
     {name, value} =
       FontType.values_by_name()
@@ -143,6 +159,19 @@ defmodule Zexray.EnumFixture do
     |> Map.merge(attrs)
   end
 
+  def input_snapshot_part_fixture(attrs \\ %{}) do
+    {name, value} =
+      InputSnapshotPart.values_by_name()
+      |> Enum.to_list()
+      |> List.first()
+
+    %{
+      name: name,
+      value: value
+    }
+    |> Map.merge(attrs)
+  end
+
   def keyboard_key_fixture(attrs \\ %{}) do
     {name, value} =
       KeyboardKey.values_by_name()
@@ -311,4 +340,17 @@ defmodule Zexray.EnumFixture do
     }
     |> Map.merge(attrs)
   end
+
+  def vertex_layout_fixture(attrs \\ %{}) do
+    {name, value} =
+      VertexLayout.values_by_name()
+      |> Enum.to_list()
+      |> List.first()
+
+    %{
+      name: name,
+      value: value
+    }
+    |> Map.merge(attrs)
+  end
 end
@@ -0,0 +1,136 @@
+defmodule Zexray.AssetPackTest do
+  use Zexray.WindowAllCase
+
+  use Zexray.Enum
+  use Zexray.Type
+
+  @moduletag :nif
+  @moduletag :window
+  @moduletag :tmp_dir
+
+  alias Zexray.AssetPack
+  alias Zexray.Image
+  alias Zexray.Resource
+
+  # The first payload follows the pack header, aligned to 64 bytes
+  @payload_offset 64
+
+  defp export(%{tmp_dir: tmp_dir}, entries) do
+    file_name = Path.join(tmp_dir, "assets.pack")
+    :ok = AssetPack.export(file_name, entries)
+    file_name
+  end
+
+  defp patch(file_name, offset, value) do
+    <<head::binary-size(offset), _::binary-size(byte_size(value)), rest::binary>> =
+      File.read!(file_name)
+
+    File.write!(file_name, [head, value, rest])
+  end
+
+  defp mesh(indices) do
+    type_mesh(
+      vertex_count: 3,
+      triangle_count: 1,
+      vertices: [0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0],
+      indices: indices,
+      vbo_id: List.duplicate(0, Zexray.Constant.mesh_max_vertex_buffers())
+    )
+  end
+
+  defp wave do
+    type_wave(
+      frame_count: 4,
+      sample_rate: 22_050,
+      sample_size: 16,
+      channels: 1,
+      data: <<0::size(4 * 16)>>
+    )
+  end
+
+  test "texture", context do
+    image = Image.gen_color(4, 4, enum_color(:red), :value)
+    file_name = export(context, [{"texture", :texture, image}])
+
+    pack = AssetPack.load(file_name)
+
+    assert [{"texture", :texture}] = AssetPack.entries(pack)
+    assert type_texture_2d(width: 4, height: 4) = AssetPack.load_texture(pack, "texture", :value)
+    assert_raise ArgumentError, fn -> AssetPack.load_mesh(pack, "texture") end
+  end
+
+  test "use after free", context do
+    image = Image.gen_color(4, 4, enum_color(:red), :value)
+    file_name = export(context, [{"texture", :texture, image}])
+
+    pack = AssetPack.load(file_name)
+    texture = AssetPack.load_texture(pack, "texture", :value)
+
+    assert :ok = Resource.free!(pack)
+
+    assert_raise ArgumentError, fn -> AssetPack.entries(pack) end
+    assert_raise ArgumentError, fn -> AssetPack.load_texture(pack, "texture") end
+    assert type_texture_2d(width: 4, height: 4) = texture
+  end
+
+  test "entry count larger than the index", context do
+    image = Image.gen_color(4, 4, enum_color(:red), :value)
+    file_name = export(context, [{"texture", :texture, image}])
+
+    # AssetPackHeader.entry_count
+    patch(file_name, 8, <<0xFFFFFFFF::little-32>>)
+
+    assert_raise RuntimeError, fn -> AssetPack.load(file_name) end
+  end
+
+  test "texture data size smaller than its mipmap levels", context do
+    image = Image.gen_color(4, 4, enum_color(:red), :value)
+    file_name = export(context, [{"texture", :texture, image}])
+
+    # AssetTextureHeader.data_size
+    patch(file_name, @payload_offset + 16, <<15::little-64>>)
+
+    pack = AssetPack.load(file_name)
+
+    assert_raise RuntimeError, fn -> AssetPack.load_texture(pack, "texture") end
+  end
+
+  test "mesh", context do
+    file_name = export(context, [{"mesh", :mesh, mesh([0, 1, 2])}])
+
+    pack = AssetPack.load(file_name)
+
+    assert type_mesh(vertex_count: 3, triangle_count: 1) =
+             AssetPack.load_mesh(pack, "mesh", :value)
+  end
+
+  test "mesh indices out of the vertices", context do
+    file_name = export(context, [{"mesh", :mesh, mesh([0, 1, 3])}])
+
+    pack = AssetPack.load(file_name)
+
+    assert_raise RuntimeError, fn -> AssetPack.load_mesh(pack, "mesh") end
+  end
+
+  test "sound data size smaller than its frames", context do
+    file_name = export(context, [{"sound", :sound, wave()}])
+
+    # AssetSoundHeader.data_size
+    patch(file_name, @payload_offset + 16, <<7::little-64>>)
+
+    pack = AssetPack.load(file_name)
+
+    assert_raise RuntimeError, fn -> AssetPack.load_sound(pack, "sound") end
+  end
+
+  test "sound sample size", context do
+    file_name = export(context, [{"sound", :sound, wave()}])
+
+    # AssetSoundHeader.sample_size
+    patch(file_name, @payload_offset + 8, <<24::little-32>>)
+
+    pack = AssetPack.load(file_name)
+
+    assert_raise RuntimeError, fn -> AssetPack.load_sound(pack, "sound") end
+  end
+end
@@ -0,0 +1,68 @@
+defmodule Zexray.DisplayListTest do
+  use Zexray.WindowAllCase
+
+  use Zexray.Enum
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.DisplayList
+  alias Zexray.Drawing
+  alias Zexray.Shape
+
+  defp drawing(function) do
+    Drawing.begin_drawing()
+
+    try do
+      function.()
+    after
+      Drawing.end_drawing()
+    end
+  end
+
+  defp draw_rectangles(count) do
+    for i <- 1..count, do: Shape.draw_rectangle(i, i, 10, 10, enum_color(:red))
+  end
+
+  test "record and draw" do
+    drawing(fn ->
+      assert :ok = DisplayList.begin_record()
+      assert DisplayList.recording?()
+      draw_rectangles(4)
+      list = DisplayList.end_record(static: true)
+      refute DisplayList.recording?()
+
+      assert %{vertex_count: vertex_count, draw_call_count: draw_call_count} =
+               DisplayList.info(list)
+
+      assert vertex_count > 0
+      assert draw_call_count > 0
+      assert :ok = DisplayList.draw(list)
+    end)
+  end
+
+  test "end without recording" do
+    assert_raise RuntimeError, fn -> DisplayList.end_record() end
+  end
+
+  test "recording batch flushed past max vertices" do
+    drawing(fn ->
+      DisplayList.begin_record(8)
+      draw_rectangles(16)
+
+      assert_raise RuntimeError, fn -> DisplayList.end_record() end
+      refute DisplayList.recording?()
+    end)
+  end
+
+  test "recording batch flushed by scissor mode" do
+    drawing(fn ->
+      DisplayList.begin_record()
+      draw_rectangles(1)
+      Drawing.begin_scissor_mode(0, 0, 10, 10)
+      Drawing.end_scissor_mode()
+
+      assert_raise RuntimeError, fn -> DisplayList.end_record() end
+    end)
+  end
+end
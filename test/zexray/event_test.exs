@@ -0,0 +1,57 @@
+defmodule Zexray.EventTest do
+  use Zexray.WindowCase
+  doctest Zexray.Event
+
+  use Zexray.Enum
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Event
+  alias Zexray.Window
+
+  test "subscribe" do
+    assert :ok = Event.subscribe(self(), [:resize, :focus])
+
+    Window.set_state(enum_config_flag(:window_resizable))
+    Window.set_size(640, 480)
+
+    assert :ok = Event.wait(0.5)
+
+    assert_receive {:zexray_events, events}, 1_000
+    assert {:resize, 640, 480} in events
+
+    assert %{events: sent, messages: messages} = Event.stats()
+    assert sent > 0
+    assert messages > 0
+
+    assert :ok = Event.unsubscribe()
+  end
+
+  test "unsubscribe" do
+    assert :ok = Event.subscribe(self(), :resize)
+    assert :ok = Event.unsubscribe()
+
+    Window.set_state(enum_config_flag(:window_resizable))
+    Window.set_size(640, 480)
+    assert :ok = Event.wait(0.1)
+
+    refute_receive {:zexray_events, _events}, 200
+  end
+
+  test "wait" do
+    assert :ok = Event.wait(0.0)
+    assert :ok = Event.wait(0.01)
+
+    task = Task.async(fn -> Event.wait() end)
+
+    Process.sleep(50)
+    assert :ok = Event.wake()
+
+    assert :ok = Task.await(task, 1_000)
+  end
+
+  test "invalid mask" do
+    assert_raise ArgumentError, fn -> Event.subscribe(self(), 0x10000) end
+  end
+end
@@ -0,0 +1,85 @@
+defmodule Zexray.FramePacerTest do
+  # The frame pacer is global
+  use ExUnit.Case, async: false
+
+  @moduletag :nif
+
+  alias Zexray.FramePacer
+
+  setup do
+    on_exit(fn ->
+      FramePacer.configure()
+      FramePacer.reset_stats()
+    end)
+
+    FramePacer.reset_stats()
+  end
+
+  defp end_frame do
+    FramePacer.end_frame(swap: false, poll: false)
+  end
+
+  test "first frame starts the schedule" do
+    FramePacer.configure(target_fps: 100, fixed_fps: 100)
+
+    assert %{steps: 0, alpha: +0.0, frame_time: +0.0} = end_frame()
+    assert %{frames: 0} = FramePacer.stats()
+  end
+
+  test "frames paced to the target" do
+    FramePacer.configure(target_fps: 100, fixed_fps: 0)
+    end_frame()
+
+    for _ <- 1..5 do
+      assert %{steps: 0, frame_time: frame_time} = end_frame()
+      assert frame_time >= 0.009
+    end
+
+    assert %{frames: 5, window_frames: 5, min: min, histogram: histogram} = FramePacer.stats()
+    assert min >= 0.009
+    assert 5 = histogram |> Enum.map(&elem(&1, 1)) |> Enum.sum()
+    assert {bucket_width, _} = hd(histogram)
+    assert_in_delta bucket_width, 0.01 / 8, 1.0e-9
+  end
+
+  test "fixed timestep" do
+    FramePacer.configure(target_fps: 50, fixed_fps: 100)
+    end_frame()
+
+    frames = Enum.map(1..5, fn _ -> end_frame() end)
+
+    for %{alpha: alpha} <- frames, do: assert(alpha >= 0.0 and alpha < 1.0)
+
+    steps = frames |> Enum.map(& &1.steps) |> Enum.sum()
+    assert steps in 9..11
+  end
+
+  test "steps over max_steps are dropped" do
+    FramePacer.configure(target_fps: 0, fixed_fps: 1000, max_steps: 1)
+    end_frame()
+
+    Process.sleep(20)
+
+    assert %{steps: 1} = end_frame()
+    assert %{dropped_steps: dropped_steps} = FramePacer.stats()
+    assert dropped_steps > 0
+  end
+
+  test "reset stats" do
+    FramePacer.configure(target_fps: 0, fixed_fps: 0)
+    end_frame()
+    end_frame()
+
+    assert %{frames: 1} = FramePacer.stats()
+    assert :ok = FramePacer.reset_stats()
+
+    assert %{frames: 0, window_frames: 0, mean: +0.0, histogram: histogram} = FramePacer.stats()
+    assert Enum.all?(histogram, fn {_, count} -> count == 0 end)
+  end
+
+  test "invalid arguments" do
+    assert_raise ArgumentError, fn -> FramePacer.configure(target_fps: -1) end
+    assert_raise ArgumentError, fn -> FramePacer.configure(spin_us: 1.0) end
+    assert_raise ArgumentError, fn -> FramePacer.end_frame(swap: :yes) end
+  end
+end
@@ -0,0 +1,77 @@
+defmodule Zexray.GlTest do
+  use Zexray.WindowAllCase
+  doctest Zexray.Gl
+
+  use Zexray.Enum
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Drawing
+  alias Zexray.Gl
+
+  import Bitwise
+
+  defp vertex(x, y, color) do
+    <<x::float-32-native, y::float-32-native, color::binary-size(4)>>
+  end
+
+  defp draw(fun) do
+    Drawing.begin_drawing()
+
+    try do
+      fun.()
+    after
+      Drawing.end_drawing()
+    end
+  end
+
+  describe "vertices" do
+    test "packed binary" do
+      layout = enum_vertex_layout(:position2) ||| enum_vertex_layout(:color)
+      color = <<255, 0, 0, 255>>
+
+      data =
+        [vertex(0.0, 0.0, color), vertex(10.0, 0.0, color), vertex(0.0, 10.0, color)]
+        |> IO.iodata_to_binary()
+
+      assert 3 = draw(fn -> Gl.vertices(enum_draw_mode(:triangles), layout, data) end)
+    end
+
+    test "batch overflow" do
+      layout = enum_vertex_layout(:position2) ||| enum_vertex_layout(:color)
+      data = :binary.copy(vertex(1.0, 1.0, <<0, 0, 0, 255>>), 30_000)
+
+      assert 30_000 = draw(fn -> Gl.vertices(enum_draw_mode(:triangles), layout, data) end)
+    end
+
+    test "invalid layout" do
+      mode = enum_draw_mode(:lines)
+      # Two valid position2 vertices
+      data = :binary.copy(<<0.0::float-32-native>>, 4)
+
+      position2 = enum_vertex_layout(:position2)
+      position3 = enum_vertex_layout(:position3)
+      color = enum_vertex_layout(:color)
+
+      draw(fn ->
+        # No position, both positions, unknown bits
+        assert_raise ArgumentError, fn -> Gl.vertices(mode, color, data) end
+        assert_raise ArgumentError, fn -> Gl.vertices(mode, position2 ||| position3, data) end
+        assert_raise ArgumentError, fn -> Gl.vertices(mode, position2 ||| 0x100, data) end
+      end)
+    end
+
+    test "invalid data" do
+      mode = enum_draw_mode(:triangles)
+      layout = enum_vertex_layout(:position2)
+      vertex = <<0.0::float-32-native, 0.0::float-32-native>>
+
+      draw(fn ->
+        # Partial vertex, partial primitive
+        assert_raise ArgumentError, fn -> Gl.vertices(mode, layout, <<0, 0, 0>>) end
+        assert_raise ArgumentError, fn -> Gl.vertices(mode, layout, vertex) end
+      end)
+    end
+  end
+end
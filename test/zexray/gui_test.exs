@@ -0,0 +1,81 @@
+defmodule Zexray.GuiTest do
+  use Zexray.WindowAllCase
+
+  use Zexray.Enum
+  use Zexray.Type
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Drawing
+  alias Zexray.Gui
+
+  defp rec(x, y) do
+    type_rectangle(x: x, y: y, width: 100.0, height: 20.0)
+  end
+
+  defp frame(items) do
+    Drawing.begin_drawing()
+
+    try do
+      Gui.frame(items)
+    after
+      Drawing.end_drawing()
+    end
+  end
+
+  setup do
+    Gui.reset_frame()
+    on_exit(fn -> Gui.reset_frame() end)
+  end
+
+  describe "frame" do
+    test "items without interactions" do
+      assert [] =
+               frame([
+                 :disable,
+                 {:label, rec(0.0, 0.0), "label"},
+                 {:button, :button, rec(0.0, 30.0), "button"},
+                 :enable,
+                 {:panel, rec(0.0, 60.0), "panel",
+                  [{:check_box, :check_box, rec(0.0, 60.0), "check", false}]},
+                 {:text_box, {:text_box, 1}, rec(0.0, 90.0), "one", 16},
+                 {:text_box, {:text_box, 2}, rec(0.0, 120.0), "two", 16}
+               ])
+    end
+
+    test "states dropped after unused frames" do
+      ids = Enum.map(1..200, &{:text_box, &1})
+
+      assert [] =
+               frame(Enum.map(ids, fn id -> {:text_box, id, rec(0.0, 0.0), "text", 8} end))
+
+      # Every state goes stale at once, more than a sweep chunk
+      for _ <- 1..240, do: assert([] = frame([]))
+
+      assert [] = frame([{:text_box, hd(ids), rec(0.0, 0.0), "text", 8}])
+    end
+
+    test "invalid item restores the gui state" do
+      normal = enum_gui_state(:normal)
+
+      assert_raise ArgumentError, fn ->
+        frame([:disable, :lock, {:label, rec(0.0, 0.0), "label"}, {:unknown, 1}])
+      end
+
+      assert ^normal = Gui.get_state()
+      refute Gui.locked?()
+    end
+
+    test "invalid item keeps the gui state set before the frame" do
+      disabled = enum_gui_state(:disabled)
+
+      Gui.disable()
+
+      assert_raise ArgumentError, fn -> frame([:enable, {:button, :b, :bounds, "b"}]) end
+
+      assert ^disabled = Gui.get_state()
+      Gui.enable()
+    end
+  end
+end
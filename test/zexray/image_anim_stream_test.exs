@@ -0,0 +1,112 @@
+defmodule Zexray.ImageAnimStreamTest do
+  use ExUnit.Case, async: true
+
+  @moduletag :nif
+
+  alias Zexray.Image
+  alias Zexray.Resource
+  alias Zexray.Type.Image, as: ImageType
+
+  require ImageType
+
+  # Palette: red, blue, green, white
+  @palette <<255, 0, 0, 0, 0, 255, 0, 255, 0, 255, 255, 255>>
+
+  @red <<255, 0, 0, 255>>
+  @blue <<0, 0, 255, 255>>
+  @green <<0, 255, 0, 255>>
+
+  # 2x2 GIF: a red frame, a blue pixel at (1, 1) and a green frame
+  defp gif do
+    IO.iodata_to_binary([
+      "GIF89a",
+      <<2::little-16, 2::little-16, 0xF1, 0, 0>>,
+      @palette,
+      frame({0, 0, 2, 2}, [0, 0, 0, 0], 5),
+      frame({1, 1, 1, 1}, [1], 10),
+      frame({0, 0, 2, 2}, [2, 2, 2, 2], 0),
+      0x3B
+    ])
+  end
+
+  defp frame({left, top, width, height}, indices, delay) do
+    [
+      <<0x21, 0xF9, 4, 0, delay::little-16, 0, 0>>,
+      <<0x2C, left::little-16, top::little-16, width::little-16, height::little-16, 0>>,
+      lzw(indices)
+    ]
+  end
+
+  # LZW data with a clear code before every index, so the code size stays at 3 bits
+  defp lzw(indices) do
+    codes = Enum.flat_map(indices, &[4, &1]) ++ [5]
+
+    {value, _} =
+      Enum.reduce(codes, {0, 0}, fn code, {value, shift} ->
+        {value + Bitwise.bsl(code, shift), shift + 3}
+      end)
+
+    size = div(3 * length(codes) + 7, 8)
+
+    <<2, size, value::little-size(size * 8), 0>>
+  end
+
+  defp pixels(stream) do
+    ImageType.t(data: data, width: 2, height: 2) = Image.anim_stream_image(stream, :value)
+    data
+  end
+
+  test "info and delays" do
+    stream = Image.load_anim_stream_from_memory(".gif", gif())
+
+    assert %{width: 2, height: 2, frames: 3, frame: 0} = Image.anim_stream_info(stream)
+    assert [50, 100, 0] = Image.anim_stream_delays(stream)
+  end
+
+  test "next frame composites and loops" do
+    stream = Image.load_anim_stream_from_memory(".gif", gif(), 2)
+
+    assert @red <> @red <> @red <> @red == pixels(stream)
+
+    assert 1 = Image.anim_stream_next_frame(stream)
+    assert @red <> @red <> @red <> @blue == pixels(stream)
+
+    assert 2 = Image.anim_stream_next_frame(stream)
+    assert @green <> @green <> @green <> @green == pixels(stream)
+
+    assert 0 = Image.anim_stream_next_frame(stream)
+    assert @red <> @red <> @red <> @red == pixels(stream)
+    assert %{frame: 0} = Image.anim_stream_info(stream)
+  end
+
+  test "seek out of the ring" do
+    stream = Image.load_anim_stream_from_memory(".gif", gif(), 1)
+
+    assert :ok = Image.anim_stream_seek(stream, 2)
+    assert @green <> @green <> @green <> @green == pixels(stream)
+
+    assert :ok = Image.anim_stream_seek(stream, 1)
+    assert @red <> @red <> @red <> @blue == pixels(stream)
+    assert %{frame: 1} = Image.anim_stream_info(stream)
+
+    assert_raise ArgumentError, fn -> Image.anim_stream_seek(stream, 3) end
+  end
+
+  test "use after free" do
+    stream = Image.load_anim_stream_from_memory(".gif", gif())
+
+    assert :ok = Resource.free!(stream)
+
+    assert_raise ArgumentError, fn -> Image.anim_stream_info(stream) end
+    assert_raise ArgumentError, fn -> Image.anim_stream_delays(stream) end
+    assert_raise ArgumentError, fn -> Image.anim_stream_next_frame(stream) end
+    assert_raise ArgumentError, fn -> Image.anim_stream_seek(stream, 0) end
+    assert_raise ArgumentError, fn -> Image.anim_stream_image(stream) end
+  end
+
+  test "invalid data" do
+    assert_raise ArgumentError, fn -> Image.load_anim_stream_from_memory(".gif", "GIF89a") end
+    assert_raise ArgumentError, fn -> Image.load_anim_stream_from_memory(".png", gif()) end
+    assert_raise ArgumentError, fn -> Image.load_anim_stream_from_memory(".gif", gif(), 0) end
+  end
+end
@@ -0,0 +1,68 @@
+defmodule Zexray.ImageBatchTest do
+  use ExUnit.Case, async: true
+
+  use Zexray.Enum
+  use Zexray.Type
+
+  @moduletag :nif
+
+  alias Zexray.Image
+  alias Zexray.Resource
+
+  defp image(return \\ :value) do
+    Image.gen_color(4, 4, enum_color(:red), return)
+  end
+
+  describe "format_batch" do
+    test "values" do
+      r8g8b8 = enum_pixel_format(:uncompressed_r8g8b8)
+
+      assert [
+               type_image(format: ^r8g8b8, data: data),
+               type_image(format: ^r8g8b8)
+             ] = Image.format_batch([image(), image()], r8g8b8)
+
+      assert byte_size(data) == 4 * 4 * 3
+    end
+
+    test "resources" do
+      r8g8b8 = enum_pixel_format(:uncompressed_r8g8b8)
+      resources = [image(:resource), image(:resource)]
+
+      assert [_, _] = Image.format_batch(resources, r8g8b8, :resource)
+
+      assert [type_image(format: ^r8g8b8), type_image(format: ^r8g8b8)] =
+               Resource.content!(resources)
+    end
+
+    test "duplicate resource" do
+      r8g8b8a8 = enum_pixel_format(:uncompressed_r8g8b8a8)
+      resource = image(:resource)
+
+      assert_raise ArgumentError, fn ->
+        Image.format_batch([resource, image(), resource], enum_pixel_format(:uncompressed_r8g8b8))
+      end
+
+      assert type_image(format: ^r8g8b8a8) = Resource.content!(resource)
+    end
+  end
+
+  describe "mipmaps_batch" do
+    test "values and resources" do
+      resource = image(:resource)
+
+      assert [type_image(mipmaps: 3), ^resource] =
+               Image.mipmaps_batch([image(), resource], :auto)
+
+      assert type_image(mipmaps: 3) = Resource.content!(resource)
+    end
+
+    test "duplicate resource" do
+      resource = image(:resource)
+
+      assert_raise ArgumentError, fn -> Image.mipmaps_batch([resource, resource]) end
+
+      assert type_image(mipmaps: 1) = Resource.content!(resource)
+    end
+  end
+end
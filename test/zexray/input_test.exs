@@ -0,0 +1,109 @@
+defmodule Zexray.InputTest do
+  use ExUnit.Case, async: true
+  doctest Zexray.Input
+
+  use Zexray.Enum
+
+  alias Zexray.Input
+
+  import Bitwise
+
+  defp bitset(indexes) do
+    bits = Enum.reduce(indexes, 0, fn index, acc -> acc ||| 1 <<< index end)
+    <<bits::little-size(512)>>
+  end
+
+  defp snapshot(down, previous) do
+    %{
+      keys_down: bitset(down),
+      keys_down_previous: bitset(previous),
+      mouse: {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0b101, 0},
+      gamepads: [{1, 0b10, 0, []}]
+    }
+  end
+
+  test "keys" do
+    space = enum_keyboard_key(:space)
+    enter = enum_keyboard_key(:enter)
+    escape = enum_keyboard_key(:escape)
+
+    snapshot = snapshot([space, enter], [enter, escape])
+
+    assert Input.key_down?(snapshot, space)
+    assert Input.key_down?(snapshot, enter)
+    assert not Input.key_down?(snapshot, escape)
+
+    assert Input.key_pressed?(snapshot, space)
+    assert not Input.key_pressed?(snapshot, enter)
+
+    assert Input.key_released?(snapshot, escape)
+    assert not Input.key_released?(snapshot, enter)
+
+    # Out of the bitset
+    assert not Input.key_down?(snapshot, 10_000)
+  end
+
+  test "buttons" do
+    snapshot = snapshot([], [])
+
+    assert Input.mouse_button_down?(snapshot, 0)
+    assert not Input.mouse_button_down?(snapshot, 1)
+    assert Input.mouse_button_down?(snapshot, 2)
+
+    assert Input.gamepad_button_down?(snapshot, 1, 1)
+    assert not Input.gamepad_button_down?(snapshot, 1, 0)
+    assert not Input.gamepad_button_down?(snapshot, 0, 1)
+  end
+end
+
+defmodule Zexray.InputSnapshotTest do
+  use Zexray.WindowAllCase
+
+  use Zexray.Enum
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Input
+  alias Zexray.NIF
+
+  test "all parts" do
+    snapshot = Input.snapshot()
+
+    assert %{
+             keys_down: keys_down,
+             keys_down_previous: keys_down_previous,
+             keys_pressed: keys_pressed,
+             chars_pressed: chars_pressed,
+             mouse: mouse,
+             gamepads: gamepads,
+             touch: touch
+           } = snapshot
+
+    assert byte_size(keys_down) == byte_size(keys_down_previous)
+    assert is_list(keys_pressed)
+    assert is_list(chars_pressed)
+    assert tuple_size(mouse) == 8
+    assert is_list(gamepads)
+    assert is_list(touch)
+
+    assert not Input.key_down?(snapshot, enum_keyboard_key(:space))
+  end
+
+  test "selected parts" do
+    assert [:mouse] = Input.snapshot([:mouse]) |> Map.keys()
+    assert [:chars_pressed, :touch] =
+             Input.snapshot([:chars, :touch]) |> Map.keys() |> Enum.sort()
+
+    assert [:keys_down, :keys_down_previous, :keys_pressed] =
+             Input.snapshot(enum_input_snapshot_part(:keyboard)) |> Map.keys() |> Enum.sort()
+
+    assert %{} == Input.snapshot([])
+  end
+
+  test "unknown parts" do
+    # Checked by the NIF too, the enum only accepts the known parts
+    assert_raise ArgumentError, fn -> NIF.get_input_snapshot(0x20) end
+    assert_raise ArgumentError, fn -> NIF.get_input_snapshot(0x104) end
+  end
+end
@@ -0,0 +1,74 @@
+defmodule Zexray.MemoryTest do
+  # The counters are global, other tests would change them
+  use ExUnit.Case, async: false
+
+  use Zexray.Enum
+
+  @moduletag :nif
+
+  alias Zexray.Image
+  alias Zexray.Memory
+  alias Zexray.Resource
+
+  @census %{live: 0, peak_live: 0, created: 0, cpu_bytes: 0, gpu_bytes: 0}
+
+  defp image_census do
+    Map.get(Memory.stats().resources, :image, @census)
+  end
+
+  test "stats" do
+    assert %{
+             allocations: %{native: native, zig: zig},
+             resources: resources,
+             gpu: %{bytes: gpu_bytes, peak_bytes: gpu_peak_bytes},
+             reclaim: %{gpu: %{pending: _, reclaimed: _}, cpu: %{pending: _, reclaimed: _}}
+           } = Memory.stats()
+
+    for counter <- [native, zig] do
+      assert %{bytes: bytes, peak_bytes: peak_bytes, count: count, peak_count: peak_count} =
+               counter
+
+      assert peak_bytes >= bytes
+      assert peak_count >= count
+    end
+
+    assert is_map(resources)
+    assert gpu_peak_bytes >= gpu_bytes
+  end
+
+  test "native allocations" do
+    %{allocations: %{native: %{total: total}}} = Memory.stats()
+
+    _image = Image.gen_color(16, 16, enum_color(:red), :resource)
+
+    assert %{allocations: %{native: %{total: new_total}}} = Memory.stats()
+    assert new_total > total
+  end
+
+  test "image census" do
+    before = image_census()
+
+    image = Image.gen_color(4, 4, enum_color(:red), :resource)
+
+    created = image_census()
+    assert created.live == before.live + 1
+    assert created.created == before.created + 1
+    assert created.cpu_bytes - before.cpu_bytes > 4 * 4 * 4
+    assert created.gpu_bytes == before.gpu_bytes
+
+    # The pixels are released, the struct stays accounted until garbage collected
+    Resource.free!(image)
+
+    freed = image_census()
+    assert freed.cpu_bytes == created.cpu_bytes - 4 * 4 * 4
+  end
+
+  test "reset peaks" do
+    _images = Enum.map(1..4, fn _ -> Image.gen_color(4, 4, enum_color(:red), :resource) end)
+
+    assert :ok = Memory.reset_peaks()
+
+    assert %{live: live, peak_live: peak_live} = image_census()
+    assert peak_live == live
+  end
+end
@@ -325,6 +325,33 @@ defmodule Zexray.NIF.ResourceTest do
     end
   end
 
+  describe "handle resource" do
+    parameterized_test "", %{}, [
+      [prefix: "scene"],
+      [prefix: "uniform_set"],
+      [prefix: "image_anim_stream"],
+      [prefix: "asset_pack"],
+      [prefix: "texture_stream"],
+      [prefix: "display_list"],
+      [prefix: "voice_pool"],
+      [prefix: "terrain"],
+      [prefix: "sprite_atlas"],
+      [prefix: "replay"]
+    ] do
+      # Not a resource of the type, the handles cannot be made from values
+      resource = {String.to_atom("#{prefix}_resource"), make_ref()}
+
+      assert Resource.resource?(resource)
+      assert not Resource.resourceable?(resource)
+
+      assert_raise ArgumentError, fn ->
+        apply(NIF, String.to_atom("#{prefix}_free_resource"), [resource])
+      end
+
+      assert_raise ArgumentError, fn -> Resource.free!(resource) end
+    end
+  end
+
   describe "invalid resource" do
     defp dataset_invalid_resource(_) do
       datasets = %{
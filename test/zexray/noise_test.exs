@@ -0,0 +1,64 @@
+defmodule Zexray.NoiseTest do
+  use ExUnit.Case, async: true
+
+  use Zexray.Enum
+  use Zexray.Type
+
+  @moduletag :nif
+
+  alias Zexray.Noise
+
+  @max_size 2_147_483_647
+
+  describe "gen_field" do
+    test "2D and 3D" do
+      field = Noise.gen_field(4, 3)
+      assert byte_size(field) == 4 * 3 * 4
+
+      field = Noise.gen_field(4, 3, 2, seed: 7, octaves: 2)
+      assert byte_size(field) == 4 * 3 * 2 * 4
+
+      for <<value::float-32-native <- field>>, do: assert(value >= -1.0 and value <= 1.0)
+    end
+
+    test "coordinates past the lattice range" do
+      for kind <- [:perlin, :simplex, :value, :cellular], dimensions <- [2, 3] do
+        opts = [kind: kind, dimensions: dimensions, offset: {1.0e12, -1.0e12, 1.0e30}]
+        assert byte_size(Noise.gen_field(4, 4, 2, opts)) == 4 * 4 * 2 * 4
+
+        opts = [kind: kind, fractal: :fbm, octaves: 16, lacunarity: 1.0e6, frequency: 1.0e30]
+        assert byte_size(Noise.gen_field(4, 4, 2, opts)) == 4 * 4 * 2 * 4
+      end
+
+      assert type_image(width: 4, height: 4) =
+               Noise.gen_image(4, 4, [frequency: 1.0e30, warp_amplitude: 1.0e30], :value)
+    end
+
+    test "params out of the f32 range" do
+      assert_raise ArgumentError, fn -> Noise.gen_field(4, 4, 1, frequency: 1.0e300) end
+      assert_raise ArgumentError, fn -> Noise.gen_field(4, 4, 1, offset: {0.0, -1.0e300, 0.0}) end
+    end
+
+    test "invalid sizes" do
+      assert_raise ArgumentError, fn -> Noise.gen_field(0, 4) end
+      assert_raise ArgumentError, fn -> Noise.gen_field(4, @max_size + 1) end
+      assert_raise ArgumentError, fn -> Noise.gen_field(@max_size, @max_size, @max_size) end
+    end
+  end
+
+  describe "gen_image" do
+    test "grayscale" do
+      grayscale = enum_pixel_format(:uncompressed_grayscale)
+
+      assert type_image(width: 8, height: 4, format: ^grayscale, data: data) =
+               Noise.gen_image(8, 4, [], :value)
+
+      assert byte_size(data) == 8 * 4
+    end
+
+    test "size overflowing an allocation" do
+      assert_raise ArgumentError, fn -> Noise.gen_image(65_536, 65_536, [], :value) end
+      assert_raise ArgumentError, fn -> Noise.gen_image(@max_size, @max_size, [], :value) end
+    end
+  end
+end
@@ -0,0 +1,113 @@
+defmodule Zexray.ReclaimTest do
+  use Zexray.WindowCase
+
+  use Zexray.Enum
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Drawing
+  alias Zexray.Image
+  alias Zexray.Memory
+  alias Zexray.Resource
+  alias Zexray.Shape3D
+  alias Zexray.Texture
+  alias Zexray.Window
+
+  import Zexray.Util, only: [wait_fn: 1]
+
+  defp reclaim_stats(kind) do
+    Map.fetch!(Memory.stats().reclaim, kind)
+  end
+
+  # The resource is only referenced by the spawned process
+  defp garbage_collect(function) do
+    {pid, ref} = spawn_monitor(fn -> function.() end)
+    assert_receive {:DOWN, ^ref, :process, ^pid, :normal}
+  end
+
+  defp draw_frame do
+    Drawing.begin_drawing()
+    Drawing.end_drawing()
+  end
+
+  defp image do
+    Image.gen_color(4, 4, enum_color(:red), :value)
+  end
+
+  test "cpu payloads" do
+    %{reclaimed: reclaimed} = reclaim_stats(:cpu)
+
+    garbage_collect(fn -> Image.gen_color(4, 4, enum_color(:red), :resource) end)
+
+    assert :ok =
+             wait_fn(fn ->
+               Memory.reclaim()
+               reclaim_stats(:cpu).reclaimed > reclaimed
+             end)
+  end
+
+  test "gpu payloads" do
+    %{reclaimed: reclaimed} = reclaim_stats(:gpu)
+
+    garbage_collect(fn -> Texture.load_from_image(image(), :resource) end)
+
+    assert :ok =
+             wait_fn(fn ->
+               draw_frame()
+               reclaim_stats(:gpu).reclaimed > reclaimed
+             end)
+  end
+
+  test "model made from a mesh resource" do
+    %{reclaimed: reclaimed} = reclaim_stats(:gpu)
+
+    # The model has its own copy of the mesh, both are reclaimed once
+    garbage_collect(fn ->
+      mesh = Shape3D.gen_mesh_cube(1.0, 1.0, 1.0, :resource)
+      Shape3D.load_model_from_mesh(mesh, :resource)
+    end)
+
+    assert :ok =
+             wait_fn(fn ->
+               draw_frame()
+               reclaim_stats(:gpu).reclaimed >= reclaimed + 2
+             end)
+
+    draw_frame()
+  end
+
+  test "resources made from values are not reclaimed" do
+    texture = Texture.load_from_image(image(), :value)
+    %{pending: pending, reclaimed: reclaimed} = reclaim_stats(:gpu)
+
+    garbage_collect(fn -> Resource.new!(texture) end)
+    draw_frame()
+
+    assert %{pending: ^pending, reclaimed: ^reclaimed} = reclaim_stats(:gpu)
+  end
+
+  test "gpu payloads of a closed window are discarded" do
+    parent = self()
+
+    {pid, ref} =
+      spawn_monitor(fn ->
+        texture = Texture.load_from_image(image(), :resource)
+        send(parent, :loaded)
+
+        receive do
+          :exit -> texture
+        end
+      end)
+
+    assert_receive :loaded
+
+    Window.close()
+    %{pending: pending, reclaimed: reclaimed} = reclaim_stats(:gpu)
+
+    send(pid, :exit)
+    assert_receive {:DOWN, ^ref, :process, ^pid, :normal}
+
+    assert %{pending: ^pending, reclaimed: ^reclaimed} = reclaim_stats(:gpu)
+  end
+end
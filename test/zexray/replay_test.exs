@@ -0,0 +1,144 @@
+defmodule Zexray.ReplayTest do
+  use Zexray.WindowAllCase
+
+  use Zexray.Enum
+  use Zexray.Type
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Drawing
+  alias Zexray.Keyboard
+  alias Zexray.Replay
+
+  # Automation event types of rcore
+  @input_key_up 1
+  @input_key_down 2
+
+  defp event(frame, type, key) do
+    type_automation_event(frame: frame, type: type, params: [key, 0, 0, 0])
+  end
+
+  defp events(events, count \\ nil) do
+    type_automation_event_list(
+      capacity: length(events),
+      count: count || length(events),
+      events: events
+    )
+  end
+
+  # Key A down on frame 1, up on frame 3 (recorded out of order)
+  defp key_events do
+    key = enum_keyboard_key(:a)
+    events([event(3, @input_key_up, key), event(1, @input_key_down, key)])
+  end
+
+  defp key_state(_frame, _dt) do
+    key = enum_keyboard_key(:a)
+    {Keyboard.down?(key), Keyboard.pressed?(key), Keyboard.released?(key)}
+  end
+
+  defp draw(frame, _dt) do
+    Drawing.clear_background(if rem(frame, 2) == 0, do: enum_color(:red), else: enum_color(:blue))
+  end
+
+  defp run_frames(replay, fun) do
+    case Replay.begin_frame(replay) do
+      :done ->
+        []
+
+      {frame, dt} ->
+        result = fun.(frame, dt)
+        Replay.end_frame(replay)
+        [{frame, dt, result} | run_frames(replay, fun)]
+    end
+  end
+
+  describe "run" do
+    test "events played on their frame" do
+      replay = Replay.load(key_events(), 16, 16, fixed_fps: 50)
+
+      assert [
+               {0, 0.02, {false, false, false}},
+               {1, 0.02, {true, true, false}},
+               {2, 0.02, {true, false, false}},
+               {3, 0.02, {false, false, true}}
+             ] = run_frames(replay, &key_state/2)
+
+      assert :done = Replay.begin_frame(replay)
+    end
+
+    test "frame count" do
+      replay = Replay.load(key_events(), 16, 16, frame_count: 6)
+
+      assert 6 = replay |> run_frames(&key_state/2) |> length()
+    end
+
+    test "stats" do
+      replay = Replay.load(key_events(), 16, 16)
+
+      assert %{frames: 4, events: 2, total: total, min: min, max: max, p50: p50} =
+               Replay.run(replay, &draw/2)
+
+      assert min <= p50 and p50 <= max
+      assert total >= max
+      assert [{_, nil}, {_, nil}, {_, nil}, {_, nil}] = Replay.frames(replay)
+    end
+
+    test "frame not ended or not begun" do
+      replay = Replay.load(key_events(), 16, 16)
+
+      assert_raise RuntimeError, fn -> Replay.end_frame(replay) end
+
+      assert {0, _} = Replay.begin_frame(replay)
+      assert_raise RuntimeError, fn -> Replay.begin_frame(replay) end
+      assert is_float(Replay.end_frame(replay))
+    end
+  end
+
+  describe "rewind" do
+    test "same input and checksums" do
+      replay = Replay.load(key_events(), 16, 16, checksums: true, seed: 42)
+
+      states = run_frames(replay, &key_state/2)
+      Replay.rewind(replay)
+      assert %{frames: 0, events: 0} = Replay.stats(replay)
+      assert ^states = run_frames(replay, &key_state/2)
+
+      Replay.rewind(replay)
+      Replay.run(replay, &draw/2)
+      checksums = replay |> Replay.frames() |> Enum.map(&elem(&1, 1))
+
+      Replay.rewind(replay)
+      Replay.run(replay, &draw/2)
+      assert ^checksums = replay |> Replay.frames() |> Enum.map(&elem(&1, 1))
+
+      assert [red, blue, red, blue] = checksums
+      assert is_integer(red) and red != blue
+    end
+
+    test "in the middle of a frame" do
+      replay = Replay.load(key_events(), 16, 16)
+
+      assert {0, _} = Replay.begin_frame(replay)
+      assert :ok = Replay.rewind(replay)
+      assert {0, _} = Replay.begin_frame(replay)
+      Replay.end_frame(replay)
+    end
+  end
+
+  describe "load" do
+    test "invalid arguments" do
+      key = enum_keyboard_key(:a)
+
+      assert_raise RuntimeError, fn ->
+        Replay.load(events([event(0, @input_key_down, key)], 0), 16, 16)
+      end
+
+      assert_raise RuntimeError, fn -> Replay.load(key_events(), 0, 16) end
+      assert_raise RuntimeError, fn -> Replay.load(key_events(), 16, -1) end
+      assert_raise ArgumentError, fn -> Replay.load(key_events(), 16, 16, seed: -1) end
+      assert_raise ArgumentError, fn -> Replay.load(key_events(), 16, 16, fixed_fps: :fast) end
+    end
+  end
+end
@@ -0,0 +1,133 @@
+defmodule Zexray.SceneTest do
+  use Zexray.WindowAllCase
+  doctest Zexray.Scene
+
+  use Zexray.Enum
+  use Zexray.Type
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Drawing
+  alias Zexray.Math
+  alias Zexray.Resource
+  alias Zexray.Scene
+  alias Zexray.Shape3D
+
+  import Zexray.Guard
+
+  defp camera() do
+    type_camera_3d(
+      position: type_vector3(x: 0.0, y: 0.0, z: 10.0),
+      target: type_vector3(x: 0.0, y: 0.0, z: 0.0),
+      up: type_vector3(x: 0.0, y: 1.0, z: 0.0),
+      fovy: 45.0,
+      projection: enum_camera_projection(:perspective)
+    )
+  end
+
+  defp draw(scene) do
+    Drawing.begin_drawing()
+    Drawing.begin_mode_3d(camera())
+    Scene.draw(scene, camera())
+    Drawing.end_mode_3d()
+    Drawing.end_drawing()
+
+    Scene.stats(scene)
+  end
+
+  defp set_node(scene, id, parent, transform, %{mesh: mesh, material: material}) do
+    Scene.set_node_mesh(scene, id, parent, transform, mesh, material, enum_color(:white))
+  end
+
+  setup do
+    mesh = Shape3D.gen_mesh_cube(1.0, 1.0, 1.0, :resource)
+    material = Shape3D.load_material_default(:resource)
+
+    on_exit(fn ->
+      Resource.free_async(mesh)
+      Resource.free_async(material)
+    end)
+
+    %{mesh: mesh, material: material}
+  end
+
+  test "load" do
+    scene = Scene.load()
+    assert is_scene(scene)
+
+    assert %{nodes: 0, drawn: 0, culled: 0, draw_calls: 0} = draw(scene)
+  end
+
+  test "frustum culling", context do
+    scene = Scene.load()
+
+    assert :ok = set_node(scene, 1, nil, Math.matrix_identity(), context)
+    assert :ok = set_node(scene, 2, nil, Math.matrix_translate(0.0, 0.0, 50.0), context)
+
+    assert %{nodes: 2, drawn: 1, culled: 1, draw_calls: 1} = draw(scene)
+  end
+
+  test "parent transforms", context do
+    scene = Scene.load()
+
+    step = Math.matrix_translate(0.0, 0.0, 1.0)
+
+    assert :ok = set_node(scene, 0, nil, Math.matrix_translate(0.0, 0.0, -100.0), context)
+
+    # Long parent chain, the last nodes end up behind the camera
+    Enum.each(1..20_000, fn id ->
+      assert :ok = set_node(scene, id, id - 1, step, context)
+    end)
+
+    assert %{nodes: 20_001, drawn: drawn, culled: culled} = draw(scene)
+    assert drawn > 0
+    assert culled > 0
+  end
+
+  test "hidden parents", context do
+    scene = Scene.load()
+
+    assert :ok = set_node(scene, 1, nil, Math.matrix_identity(), context)
+    assert :ok = set_node(scene, 2, 1, Math.matrix_identity(), context)
+    assert :ok = set_node(scene, 3, 2, Math.matrix_identity(), context)
+
+    assert Scene.set_node_visible(scene, 1, false)
+    assert %{nodes: 3, drawn: 0} = draw(scene)
+
+    assert Scene.set_node_visible(scene, 1, true)
+    assert Scene.set_node_visible(scene, 2, false)
+    assert %{nodes: 3, drawn: 1} = draw(scene)
+  end
+
+  test "model bounds", context do
+    scene = Scene.load()
+
+    model = Shape3D.load_model_from_mesh(context.mesh, :value)
+    model = Resource.new!(type_model(model, transform: Math.matrix_translate(0.0, 0.0, 6.0)))
+    white = enum_color(:white)
+
+    # The model transform is applied once, the box stays in front of the camera
+    assert :ok = Scene.set_node_model(scene, 1, nil, Math.matrix_identity(), model, white)
+    assert %{drawn: 1, culled: 0} = draw(scene)
+  end
+
+  test "remove node", context do
+    scene = Scene.load()
+
+    assert :ok = set_node(scene, 1, nil, Math.matrix_identity(), context)
+    assert :ok = set_node(scene, 2, 1, Math.matrix_identity(), context)
+
+    assert Scene.remove_node(scene, 1)
+    assert not Scene.remove_node(scene, 1)
+
+    # The child is a root node now, a new node with the removed id does not adopt it
+    assert :ok = set_node(scene, 1, nil, Math.matrix_identity(), context)
+    assert Scene.set_node_visible(scene, 1, false)
+
+    assert %{nodes: 2, drawn: 1} = draw(scene)
+
+    assert :ok = Scene.clear(scene)
+    assert %{nodes: 0} = draw(scene)
+  end
+end
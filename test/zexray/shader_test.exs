@@ -0,0 +1,142 @@
+defmodule Zexray.ShaderTest do
+  use Zexray.WindowAllCase
+  doctest Zexray.Shader
+
+  use Zexray.Enum
+  use Zexray.Type
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Drawing
+  alias Zexray.Resource
+  alias Zexray.Shader
+
+  import Zexray.Guard
+
+  @vs_code """
+  #version 330
+  in vec3 vertexPosition;
+  in vec2 vertexTexCoord;
+  in vec4 vertexColor;
+  uniform mat4 mvp;
+  out vec2 fragTexCoord;
+  out vec4 fragColor;
+  void main() {
+    fragTexCoord = vertexTexCoord;
+    fragColor = vertexColor;
+    gl_Position = mvp * vec4(vertexPosition, 1.0);
+  }
+  """
+
+  @fs_code """
+  #version 330
+  in vec2 fragTexCoord;
+  in vec4 fragColor;
+  uniform vec4 tint;
+  uniform vec3 offsets[3];
+  out vec4 finalColor;
+  void main() {
+    finalColor = fragColor * tint + vec4(offsets[0] + offsets[1] + offsets[2], 0.0);
+  }
+  """
+
+  setup do
+    shader = Shader.load_from_memory(@vs_code, @fs_code, :resource)
+
+    on_exit(fn -> Resource.free_async(shader) end)
+
+    %{shader: shader}
+  end
+
+  defp uniforms() do
+    [
+      {"tint", enum_shader_uniform_data_type(:vec4)},
+      {"offsets", enum_shader_uniform_data_type(:vec3), 3}
+    ]
+  end
+
+  defp apply_uniform_set(shader, uniform_set) do
+    Drawing.begin_drawing()
+    Drawing.begin_shader_mode(shader)
+
+    try do
+      Shader.apply_uniform_set(uniform_set)
+    after
+      Drawing.end_shader_mode()
+      Drawing.end_drawing()
+    end
+  end
+
+  describe "uniform set" do
+    test "packed layout", %{shader: shader} do
+      uniform_set = Shader.load_uniform_set(shader, uniforms())
+      assert is_uniform_set(uniform_set)
+
+      assert [{"tint", tint, 0, 16}, {"offsets", offsets, 16, 36}] =
+               Shader.get_uniform_set_layout(uniform_set)
+
+      assert tint >= 0
+      assert offsets >= 0
+    end
+
+    test "std430 layout", %{shader: shader} do
+      uniform_set = Shader.load_uniform_set(shader, uniforms(), 0)
+
+      # Shader buffers need OpenGL 4.3, the set falls back to packed uniforms otherwise
+      assert [{"tint", _, 0, 16}, {"offsets", _, 16, offsets_size}] =
+               Shader.get_uniform_set_layout(uniform_set)
+
+      assert offsets_size in [36, 48]
+    end
+
+    test "dirty uploads", %{shader: shader} do
+      uniform_set = Shader.load_uniform_set(shader, uniforms())
+
+      # All the uniforms are dirty after loading
+      assert 2 = apply_uniform_set(shader, uniform_set)
+      assert 0 = apply_uniform_set(shader, uniform_set)
+
+      offsets = [
+        type_vector3(x: 1.0, y: 0.0, z: 0.0),
+        type_vector3(x: 0.0, y: 1.0, z: 0.0),
+        type_vector3(x: 0.0, y: 0.0, z: 1.0)
+      ]
+
+      assert :ok = Shader.set_uniform_set_values(uniform_set, %{"offsets" => offsets})
+      assert 1 = apply_uniform_set(shader, uniform_set)
+
+      # Same values, nothing changed
+      assert :ok = Shader.set_uniform_set_values(uniform_set, %{"offsets" => offsets})
+      assert 0 = apply_uniform_set(shader, uniform_set)
+
+      assert :ok = Shader.invalidate_uniform_set(uniform_set)
+      assert 2 = apply_uniform_set(shader, uniform_set)
+
+      assert %{uploads: 5, skipped: 5} = Shader.get_uniform_set_stats(uniform_set)
+    end
+
+    test "invalid values", %{shader: shader} do
+      uniform_set = Shader.load_uniform_set(shader, uniforms())
+
+      assert_raise ArgumentError, fn ->
+        Shader.set_uniform_set_values(uniform_set, %{"unknown" => 1.0})
+      end
+
+      assert_raise ArgumentError, fn ->
+        Shader.set_uniform_set_values(uniform_set, %{"offsets" => [1.0, 2.0]})
+      end
+
+      assert_raise ArgumentError, fn -> Shader.update_uniform_set(uniform_set, <<0, 0>>) end
+    end
+
+    test "other shader", %{shader: shader} do
+      uniform_set = Shader.load_uniform_set(shader, uniforms())
+      other = Shader.load_from_memory(@vs_code, @fs_code, :resource)
+
+      assert_raise ArgumentError, fn -> Drawing.begin_shader_mode(other, uniform_set) end
+
+      Resource.free!(other)
+    end
+  end
+end
@@ -0,0 +1,105 @@
+defmodule Zexray.SpriteAtlasTest do
+  use Zexray.WindowAllCase
+
+  use Zexray.Enum
+  use Zexray.Type
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Drawing
+  alias Zexray.Image
+  alias Zexray.SpriteAtlas
+
+  defp images do
+    [
+      Image.gen_color(8, 8, enum_color(:red), :value),
+      Image.gen_color(16, 8, enum_color(:green), :value),
+      Image.gen_color(4, 4, enum_color(:blue), :value)
+    ]
+  end
+
+  defp overlap?(type_rectangle(x: x1, y: y1, width: w1, height: h1), rec) do
+    type_rectangle(x: x2, y: y2, width: w2, height: h2) = rec
+    x1 < x2 + w2 and x2 < x1 + w1 and y1 < y2 + h2 and y2 < y1 + h1
+  end
+
+  describe "load" do
+    test "packed sprites" do
+      {atlas, recs} = SpriteAtlas.load(images(), padding: 2)
+
+      assert %{width: width, height: height, sprites: 3, mipmaps: 1, occupancy: occupancy} =
+               SpriteAtlas.info(atlas)
+
+      assert width in [16, 32, 64] and height in [16, 32, 64]
+      assert occupancy > 0.0 and occupancy <= 1.0
+
+      sizes = Enum.map(images(), fn type_image(width: w, height: h) -> {w * 1.0, h * 1.0} end)
+
+      for {type_rectangle(x: x, y: y, width: w, height: h), {image_w, image_h}} <-
+            Enum.zip(recs, sizes) do
+        assert {w, h} == {image_w, image_h}
+        assert x >= 2.0 and y >= 2.0
+        assert x + w + 2.0 <= width and y + h + 2.0 <= height
+      end
+
+      for {a, i} <- Enum.with_index(recs), {b, j} <- Enum.with_index(recs), i < j do
+        refute overlap?(a, b)
+      end
+
+      for {rec, id} <- Enum.with_index(recs) do
+        assert ^rec = SpriteAtlas.get_rec(atlas, id, :value)
+      end
+    end
+
+    test "mipmaps" do
+      {atlas, _recs} = SpriteAtlas.load(images(), mipmaps: true, filter: :trilinear)
+
+      assert %{mipmaps: mipmaps} = SpriteAtlas.info(atlas)
+      assert mipmaps > 1
+    end
+
+    test "invalid" do
+      assert_raise RuntimeError, fn -> SpriteAtlas.load([]) end
+      assert_raise RuntimeError, fn -> SpriteAtlas.load(images(), max_size: 24) end
+      assert_raise RuntimeError, fn -> SpriteAtlas.load(images(), max_size: 16) end
+      assert_raise ArgumentError, fn -> SpriteAtlas.load([:image]) end
+      assert_raise ArgumentError, fn -> SpriteAtlas.load(images(), padding: 0xFFFFFFFF) end
+      assert_raise ArgumentError, fn -> SpriteAtlas.load(images(), padding: 2049) end
+    end
+  end
+
+  test "draw" do
+    {atlas, _recs} = SpriteAtlas.load(images())
+    white = enum_color(:white)
+
+    Drawing.begin_drawing()
+
+    try do
+      assert :ok = SpriteAtlas.draw(atlas, 0, type_vector2(x: 10.0, y: 10.0), white)
+
+      assert :ok =
+               SpriteAtlas.draw(atlas, 1, type_vector2(x: 40.0, y: 10.0), white,
+                 origin: type_vector2(x: 8.0, y: 4.0),
+                 rotation: 45.0,
+                 scale: 2.0
+               )
+
+      assert :ok =
+               SpriteAtlas.draw_batch(atlas, [
+                 {0, 100.0, 100.0, 0.0, 1.0, white},
+                 {2, 120.0, 100.0, 90.0, 0.5, enum_color(:gold)}
+               ])
+
+      assert_raise ArgumentError, fn ->
+        SpriteAtlas.draw(atlas, 3, type_vector2(x: 0.0, y: 0.0), white)
+      end
+
+      assert_raise ArgumentError, fn ->
+        SpriteAtlas.draw_batch(atlas, [{3, 0.0, 0.0, 0.0, 1.0, white}])
+      end
+    after
+      Drawing.end_drawing()
+    end
+  end
+end
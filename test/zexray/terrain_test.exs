@@ -0,0 +1,136 @@
+defmodule Zexray.TerrainTest do
+  use Zexray.WindowAllCase
+
+  use Zexray.Enum
+  use Zexray.Type
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Drawing
+  alias Zexray.Image
+  alias Zexray.Resource
+  alias Zexray.Terrain
+
+  defp flat_heightmap do
+    Image.gen_color(17, 17, enum_color(:white), :value)
+  end
+
+  # 3x3 heights rising along x: 0.0, 0.5, 1.0
+  defp slope_heightmap do
+    data = for _z <- 1..3, x <- [0.0, 0.5, 1.0], into: <<>>, do: <<x::float-32-native>>
+
+    type_image(
+      data: data,
+      width: 3,
+      height: 3,
+      mipmaps: 1,
+      format: enum_pixel_format(:uncompressed_r32)
+    )
+  end
+
+  defp vector3(x, y, z), do: type_vector3(x: x, y: y, z: z)
+
+  describe "queries" do
+    test "flat terrain" do
+      terrain = Terrain.load(flat_heightmap(), vector3(16.0, 8.0, 16.0), chunk_size: 8)
+
+      assert_in_delta Terrain.get_height(terrain, 3.5, 12.25), 8.0, 1.0e-5
+      assert type_vector3(x: x, y: y, z: z) = Terrain.get_normal(terrain, 3.5, 12.25, :value)
+      assert_in_delta x, 0.0, 1.0e-5
+      assert_in_delta y, 1.0, 1.0e-5
+      assert_in_delta z, 0.0, 1.0e-5
+    end
+
+    test "slope with a position" do
+      terrain =
+        Terrain.load(slope_heightmap(), vector3(2.0, 2.0, 2.0),
+          position: vector3(10.0, 5.0, 0.0),
+          chunk_size: 2,
+          lod_levels: 1
+        )
+
+      assert_in_delta Terrain.get_height(terrain, 10.5, 1.0), 5.5, 1.0e-5
+      assert_in_delta Terrain.get_height(terrain, 11.75, 0.5), 6.75, 1.0e-5
+
+      # Clamped to the edges
+      assert_in_delta Terrain.get_height(terrain, 0.0, -4.0), 5.0, 1.0e-5
+      assert_in_delta Terrain.get_height(terrain, 20.0, 4.0), 7.0, 1.0e-5
+
+      assert type_vector3(x: x, y: y, z: z) = Terrain.get_normal(terrain, 11.0, 1.0, :value)
+      assert_in_delta x, -:math.sqrt(0.5), 1.0e-5
+      assert_in_delta y, :math.sqrt(0.5), 1.0e-5
+      assert_in_delta z, 0.0, 1.0e-5
+    end
+  end
+
+  defp camera do
+    type_camera_3d(
+      position: vector3(8.0, 20.0, 30.0),
+      target: vector3(8.0, 0.0, 8.0),
+      up: vector3(0.0, 1.0, 0.0),
+      fovy: 45.0,
+      projection: enum_camera_projection(:perspective)
+    )
+  end
+
+  defp draw(terrain) do
+    Drawing.begin_drawing()
+    Drawing.begin_mode_3d(camera())
+
+    try do
+      Terrain.draw(terrain, camera())
+    after
+      Drawing.end_mode_3d()
+      Drawing.end_drawing()
+    end
+  end
+
+  test "draw" do
+    terrain = Terrain.load(flat_heightmap(), vector3(16.0, 8.0, 16.0), chunk_size: 8)
+
+    assert :ok = draw(terrain)
+
+    assert %{chunks: 4, drawn: drawn, culled: culled, triangles: triangles} =
+             Terrain.stats(terrain)
+
+    assert drawn + culled == 4
+    assert drawn > 0
+    assert triangles > 0
+  end
+
+  test "draw after free" do
+    terrain = Terrain.load(flat_heightmap(), vector3(16.0, 8.0, 16.0), chunk_size: 8)
+
+    assert :ok = Resource.free!(terrain)
+
+    assert_raise ArgumentError, fn -> draw(terrain) end
+    assert_in_delta Terrain.get_height(terrain, 3.5, 12.25), 8.0, 1.0e-5
+  end
+
+  describe "invalid" do
+    test "heightmap" do
+      heightmap = Image.gen_color(1, 1, enum_color(:white), :value)
+
+      assert_raise RuntimeError, fn -> Terrain.load(heightmap, vector3(1.0, 1.0, 1.0)) end
+    end
+
+    test "chunks" do
+      heightmap = flat_heightmap()
+      size = vector3(16.0, 8.0, 16.0)
+
+      assert_raise RuntimeError, fn -> Terrain.load(heightmap, size, chunk_size: 3) end
+      assert_raise RuntimeError, fn -> Terrain.load(heightmap, size, chunk_size: 256) end
+      assert_raise RuntimeError, fn -> Terrain.load(heightmap, size, lod_levels: 0) end
+
+      assert_raise RuntimeError, fn ->
+        Terrain.load(heightmap, size, chunk_size: 2, lod_levels: 3)
+      end
+    end
+
+    test "arguments" do
+      assert_raise ArgumentError, fn -> Terrain.load(:heightmap, vector3(1.0, 1.0, 1.0)) end
+      assert_raise ArgumentError, fn -> Terrain.load(flat_heightmap(), :size) end
+    end
+  end
+end
@@ -0,0 +1,97 @@
+defmodule Zexray.TextureTest do
+  use Zexray.WindowAllCase
+
+  use Zexray.Enum
+  use Zexray.Type
+
+  import ExUnitParameterize
+
+  @moduletag :nif
+  @moduletag :window
+
+  alias Zexray.Image
+  alias Zexray.Resource
+  alias Zexray.Texture
+
+  defp texture do
+    4
+    |> Image.gen_color(4, enum_color(:red), :value)
+    |> Texture.load_from_image(:resource)
+  end
+
+  defp rec(x, y, width, height) do
+    type_rectangle(x: x, y: y, width: width, height: height)
+  end
+
+  describe "update_rec" do
+    test "inside the texture" do
+      texture = texture()
+
+      assert :ok = Texture.update_rec(texture, rec(0.0, 0.0, 4.0, 4.0), <<0::size(4 * 4 * 32)>>)
+      assert :ok = Texture.update_rec(texture, rec(2.0, 1.0, 2.0, 3.0), <<0::size(2 * 3 * 32)>>)
+    end
+
+    parameterized_test "invalid rec", %{}, [
+      [x: -1.0, y: 0.0, width: 2.0, height: 2.0],
+      [x: 0.0, y: 0.0, width: -2.0, height: 2.0],
+      [x: 3.0, y: 0.0, width: 2.0, height: 2.0],
+      [x: 0.0, y: 0.0, width: 2.0, height: 1.0e30],
+      [x: 1.0e30, y: 1.0e30, width: 1.0e30, height: 1.0e30]
+    ] do
+      texture = texture()
+
+      assert_raise ArgumentError, fn ->
+        Texture.update_rec(texture, rec(x, y, width, height), <<0::size(4 * 4 * 32)>>)
+      end
+    end
+
+    test "pixels smaller than the rec" do
+      texture = texture()
+
+      assert_raise ArgumentError, fn ->
+        Texture.update_rec(texture, rec(0.0, 0.0, 4.0, 4.0), <<0::size(4 * 3 * 32)>>)
+      end
+    end
+  end
+
+  describe "stream" do
+    test "update" do
+      format = enum_pixel_format(:uncompressed_r8g8b8a8)
+      stream = Texture.load_stream(4, 4, format)
+
+      assert type_texture_2d(width: 4, height: 4, format: ^format) =
+               Texture.stream_texture(stream)
+
+      uploaded =
+        Enum.count(1..5, fn _ -> Texture.update_stream(stream, <<0::size(4 * 4 * 32)>>) end)
+
+      assert %{mode: mode, uploaded: ^uploaded, dropped: dropped} = Texture.stream_stats(stream)
+      assert mode in [:persistent, :mapped, :direct]
+      assert uploaded + dropped == 5
+    end
+
+    test "use after free" do
+      format = enum_pixel_format(:uncompressed_r8g8b8a8)
+      stream = Texture.load_stream(4, 4, format)
+
+      assert :ok = Resource.free!(stream)
+
+      assert_raise ArgumentError, fn -> Texture.stream_texture(stream) end
+      assert_raise ArgumentError, fn -> Texture.update_stream(stream, <<0::size(4 * 4 * 32)>>) end
+      assert %{mode: :direct} = Texture.stream_stats(stream)
+    end
+
+    test "invalid arguments" do
+      format = enum_pixel_format(:uncompressed_r8g8b8a8)
+
+      assert_raise ArgumentError, fn -> Texture.load_stream(4, 4, format, 0) end
+      assert_raise ArgumentError, fn -> Texture.load_stream(4, 4, format, 9) end
+
+      stream = Texture.load_stream(4, 4, format)
+
+      assert_raise ArgumentError, fn ->
+        Texture.update_stream(stream, <<0::size(4 * 3 * 32)>>)
+      end
+    end
+  end
+end
@@ -0,0 +1,81 @@
+defmodule Zexray.VoicePoolTest do
+  # The audio device is global
+  use ExUnit.Case, async: false
+
+  use Zexray.Type
+
+  @moduletag :nif
+
+  alias Zexray.Audio
+  alias Zexray.Memory
+  alias Zexray.Resource
+  alias Zexray.VoicePool
+
+  import Zexray.Util, only: [wait_fn: 1]
+
+  setup_all do
+    Audio.init()
+    on_exit(fn -> Audio.close() end)
+  end
+
+  # One second of silence
+  defp sound do
+    type_wave(
+      frame_count: 22_050,
+      sample_rate: 22_050,
+      sample_size: 16,
+      channels: 1,
+      data: <<0::size(22_050 * 16)>>
+    )
+    |> Audio.load_sound_from_wave(:resource)
+  end
+
+  test "steal the oldest voice" do
+    sound = sound()
+    pool = VoicePool.load(sound, 2)
+
+    assert 0 = VoicePool.play(pool, sound)
+    assert 1 = VoicePool.play(pool, sound(), priority: 1)
+    assert 0 = VoicePool.play(pool, sound())
+    assert nil == VoicePool.play(pool, sound(), priority: -1)
+    assert nil == VoicePool.play(pool, sound(), volume: 0.0)
+
+    assert %{voices: 2, active: 2, played: 3, stolen: 1, dropped: 1, culled: 1} =
+             VoicePool.stats(pool)
+
+    assert :ok = VoicePool.stop(pool)
+    assert %{active: 0} = VoicePool.stats(pool)
+  end
+
+  test "sound freed while playing" do
+    pool = VoicePool.load(sound(), 2)
+    sound = sound()
+
+    assert 0 = VoicePool.play(pool, sound)
+    assert 1 = VoicePool.play(pool, sound)
+    assert %{active: 2} = VoicePool.stats(pool)
+
+    Resource.free!(sound)
+
+    assert %{active: 0} = VoicePool.stats(pool)
+    assert 0 = VoicePool.play(pool, sound())
+  end
+
+  test "garbage collected pool" do
+    %{reclaimed: reclaimed} = Memory.stats().reclaim.cpu
+
+    {pid, ref} = spawn_monitor(fn -> VoicePool.load(sound(), 4) end)
+    assert_receive {:DOWN, ^ref, :process, ^pid, :normal}
+
+    assert :ok =
+             wait_fn(fn ->
+               Memory.reclaim()
+               Memory.stats().reclaim.cpu.reclaimed > reclaimed
+             end)
+  end
+
+  test "invalid voice count" do
+    assert_raise RuntimeError, fn -> VoicePool.load(sound(), 0) end
+    assert_raise RuntimeError, fn -> VoicePool.load(sound(), 257) end
+  end
+end
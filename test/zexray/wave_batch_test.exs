@@ -0,0 +1,90 @@
+defmodule Zexray.WaveBatchTest do
+  use ExUnit.Case, async: true
+
+  use Zexray.Type
+
+  @moduletag :nif
+
+  alias Zexray.Audio
+  alias Zexray.Resource
+
+  # Mono 16 bit ramp from 0 to half scale
+  defp wave(return \\ :value) do
+    data = for i <- 0..99, into: <<>>, do: <<i * 163::signed-16-native>>
+
+    wave =
+      type_wave(
+        frame_count: 100,
+        sample_rate: 22_050,
+        sample_size: 16,
+        channels: 1,
+        data: data
+      )
+
+    if return == :resource, do: Resource.new!(wave), else: wave
+  end
+
+  defp invalid_wave do
+    type_wave(wave(), sample_rate: 0)
+  end
+
+  describe "in place" do
+    test "values and resources" do
+      resource = wave(:resource)
+
+      assert [type_wave(sample_rate: 44_100, frame_count: frame_count), ^resource] =
+               Audio.wave_resample_batch([wave(), resource], 44_100)
+
+      assert frame_count == 200
+      assert type_wave(sample_rate: 44_100) = Resource.content!(resource)
+
+      assert [type_wave(channels: 2)] = Audio.wave_remix_batch([wave()], 2)
+      assert [type_wave(frame_count: 100)] = Audio.wave_normalize_batch([wave()], 1.0)
+      assert [type_wave(frame_count: 99)] = Audio.wave_trim_silence_batch([wave()], 0.001)
+    end
+
+    test "duplicate resource" do
+      resource = wave(:resource)
+
+      assert_raise ArgumentError, fn ->
+        Audio.wave_remix_batch([resource, wave(), resource], 2)
+      end
+
+      assert type_wave(channels: 1, data: data) = Resource.content!(resource)
+      assert byte_size(data) == 100 * 2
+    end
+
+    test "invalid wave leaves every wave as is" do
+      resource = wave(:resource)
+
+      assert_raise ArgumentError, fn ->
+        Audio.wave_resample_batch([resource, invalid_wave()], 44_100)
+      end
+
+      assert type_wave(sample_rate: 22_050, frame_count: 100) = Resource.content!(resource)
+    end
+
+    test "invalid arguments" do
+      resource = wave(:resource)
+
+      assert_raise ArgumentError, fn -> Audio.wave_resample_batch([resource], 0) end
+      assert_raise ArgumentError, fn -> Audio.wave_remix_batch([resource], 0) end
+
+      assert type_wave(sample_rate: 22_050, channels: 1) = Resource.content!(resource)
+    end
+  end
+
+  describe "read only" do
+    test "same resource listed twice" do
+      resource = wave(:resource)
+
+      assert [%{peak: peak, rms: rms}, %{peak: peak, rms: rms}] =
+               Audio.get_wave_levels_batch([resource, resource])
+
+      assert_in_delta peak, 99 * 163 / 32_767, 1.0e-3
+      assert rms > 0.0
+
+      assert_raise ArgumentError, fn -> Audio.get_wave_levels_batch([invalid_wave()]) end
+    end
+  end
+end